@@ -13,6 +13,88 @@ static integer c__0 = 0;
 static integer c__3 = 3;
 static doublereal c_b199 = 1e-12;
 
+/* Symmetrical-Enigma: bounding sphere pre-classification for ZZOCCED. */
+
+/*     Classify the occultation of BACK by FRONT, as ZZOCCED would, */
+/*     using only the positions of the targets relative to the observer */
+/*     and their smallest and largest semi-axis lengths. The orientation */
+/*     of the targets isn't needed, so the frame lookups for the */
+/*     semi-axis matrices are skipped along with ZZOCCED itself. */
+
+/*     The cases which are decided are those in which the cones from */
+/*     the observer that bound the targets' circumscribed spheres are */
+/*     disjoint (no occultation), and those in which one target's */
+/*     circumscribed cone lies within the other's inscribed cone while */
+/*     the circumscribed spheres are separated in depth (a total or */
+/*     annular occultation, depending on which target is nearer). Every */
+/*     comparison carries a relative margin of ZZOCMARG, so that */
+/*     rounding can't make the result differ from that of ZZOCCED. All */
+/*     other cases, including those in which the observer is inside a */
+/*     circumscribed sphere, are left to ZZOCCED, and the function */
+/*     returns FALSE. The function isn't static, so that it can be */
+/*     checked against ZZOCCED. */
+
+#define ZZOCMARG 1e-10
+
+logical zzocsph_(doublereal *bckpos, doublereal *bckmin, 
+	doublereal *bckmax, doublereal *frtpos, doublereal *frtmin, 
+	doublereal *frtmax, integer *occode)
+{
+    double asin(doublereal);
+    doublereal bdist, fdist, bminang, bmaxang, fminang, fmaxang, trgsep;
+    extern doublereal vsep_(doublereal *, doublereal *);
+    extern doublereal vnorm_(doublereal *);
+
+    bdist = vnorm_(bckpos);
+    fdist = vnorm_(frtpos);
+    if (*bckmax >= bdist || *frtmax >= fdist) {
+	return FALSE_;
+    }
+    bminang = asin(*bckmin / bdist);
+    bmaxang = asin(*bckmax / bdist);
+    fminang = asin(*frtmin / fdist);
+    fmaxang = asin(*frtmax / fdist);
+    trgsep = vsep_(bckpos, frtpos);
+
+/*     The circumscribed cones are disjoint. */
+
+    if (trgsep > (bmaxang + fmaxang) * (ZZOCMARG + 1.)) {
+	*occode = 0;
+	return TRUE_;
+    }
+
+/*     BACK's circumscribed cone lies within FRONT's inscribed cone. */
+/*     BACK is totally occulted if it lies behind FRONT, and in */
+/*     transit across FRONT if it lies in front. */
+
+    if ((trgsep + bmaxang) * (ZZOCMARG + 1.) < fminang) {
+	if (bdist - *bckmax > (fdist + *frtmax) * (ZZOCMARG + 1.)) {
+	    *occode = -3;
+	    return TRUE_;
+	}
+	if ((bdist + *bckmax) * (ZZOCMARG + 1.) < fdist - *frtmax) {
+	    *occode = 2;
+	    return TRUE_;
+	}
+    }
+
+/*     FRONT's circumscribed cone lies within BACK's inscribed cone. */
+/*     BACK is annularly occulted if FRONT lies in front of it, and */
+/*     FRONT is totally occulted by BACK otherwise. */
+
+    if ((trgsep + fmaxang) * (ZZOCMARG + 1.) < bminang) {
+	if ((fdist + *frtmax) * (ZZOCMARG + 1.) < bdist - *bckmax) {
+	    *occode = -2;
+	    return TRUE_;
+	}
+	if (fdist - *frtmax > (bdist + *bckmax) * (ZZOCMARG + 1.)) {
+	    *occode = 3;
+	    return TRUE_;
+	}
+    }
+    return FALSE_;
+} /* zzocsph_ */
+
 /* $Procedure ZZGFOCU ( GF, occultation utilities ) */
 /* Subroutine */ int zzgfocu_0_(int n__, char *occtyp, char *front, char *
 	fshape, char *fframe, char *back, char *bshape, char *bframe, char *
@@ -1842,53 +1924,61 @@ L_zzgfocst:
 /*        The caller has selected a test for a partial, annular or full */
 /*        occultation using ellipsoidal shape models. */
 
-/*        Look up the axes of each target body in the J2000 frame at the */
-/*        light time corrected epoch for that body. */
+/*        Symmetrical-Enigma: most epochs can be classified from the */
+/*        targets' bounding spheres alone (see ZZOCSPH above). Only the */
+/*        remaining ones need the frame lookups and ZZOCCED. */
 
-	zzcorepc_(svcorr, time, &ltback, &etbcor, (ftnlen)5);
-	pxform_(svbfrm, "J2000", &etbcor, mtemp, (ftnlen)32, (ftnlen)5);
-	if (failed_()) {
-	    chkout_("ZZGFOCST", (ftnlen)8);
-	    return 0;
-	}
+	if (! zzocsph_(bckpos, &svmnbr, &svmxbr, frtpos, &svmnfr, &svmxfr, &
+		occode)) {
 
-/*        Scale the columns of MTEMP by the axis lengths of the back */
-/*        target. */
+/*           Look up the axes of each target body in the J2000 frame at the */
+/*           light time corrected epoch for that body. */
 
-	for (i__ = 1; i__ <= 3; ++i__) {
-	    vscl_(&svbrad[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge(
-		    "svbrad", i__1, "zzgfocu_", (ftnlen)1633)], &mtemp[(i__2 =
-		     i__ * 3 - 3) < 9 && 0 <= i__2 ? i__2 : s_rnge("mtemp", 
-		    i__2, "zzgfocu_", (ftnlen)1633)], &bsmaxs[(i__3 = i__ * 3 
-		    - 3) < 9 && 0 <= i__3 ? i__3 : s_rnge("bsmaxs", i__3, 
-		    "zzgfocu_", (ftnlen)1633)]);
-	}
-	zzcorepc_(svcorr, time, &ltfrnt, &etfcor, (ftnlen)5);
-	pxform_(svffrm, "J2000", &etfcor, mtemp, (ftnlen)32, (ftnlen)5);
-	if (failed_()) {
-	    chkout_("ZZGFOCST", (ftnlen)8);
-	    return 0;
-	}
+	    zzcorepc_(svcorr, time, &ltback, &etbcor, (ftnlen)5);
+	    pxform_(svbfrm, "J2000", &etbcor, mtemp, (ftnlen)32, (ftnlen)5);
+	    if (failed_()) {
+		chkout_("ZZGFOCST", (ftnlen)8);
+		return 0;
+	    }
 
-/*        Scale the columns of MTEMP by the axis lengths of the second */
-/*        target. */
+/*           Scale the columns of MTEMP by the axis lengths of the back */
+/*           target. */
 
-	for (i__ = 1; i__ <= 3; ++i__) {
-	    vscl_(&svfrad[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge(
-		    "svfrad", i__1, "zzgfocu_", (ftnlen)1649)], &mtemp[(i__2 =
-		     i__ * 3 - 3) < 9 && 0 <= i__2 ? i__2 : s_rnge("mtemp", 
-		    i__2, "zzgfocu_", (ftnlen)1649)], &fsmaxs[(i__3 = i__ * 3 
-		    - 3) < 9 && 0 <= i__3 ? i__3 : s_rnge("fsmaxs", i__3, 
-		    "zzgfocu_", (ftnlen)1649)]);
-	}
+	    for (i__ = 1; i__ <= 3; ++i__) {
+		vscl_(&svbrad[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge(
+			"svbrad", i__1, "zzgfocu_", (ftnlen)1633)], &mtemp[(i__2 =
+			 i__ * 3 - 3) < 9 && 0 <= i__2 ? i__2 : s_rnge("mtemp", 
+			i__2, "zzgfocu_", (ftnlen)1633)], &bsmaxs[(i__3 = i__ * 3 
+			- 3) < 9 && 0 <= i__3 ? i__3 : s_rnge("bsmaxs", i__3, 
+			"zzgfocu_", (ftnlen)1633)]);
+	    }
+	    zzcorepc_(svcorr, time, &ltfrnt, &etfcor, (ftnlen)5);
+	    pxform_(svffrm, "J2000", &etfcor, mtemp, (ftnlen)32, (ftnlen)5);
+	    if (failed_()) {
+		chkout_("ZZGFOCST", (ftnlen)8);
+		return 0;
+	    }
 
-/*        Classify the occultation state of BACK by FRONT as seen from */
-/*        the observer. */
+/*           Scale the columns of MTEMP by the axis lengths of the second */
+/*           target. */
 
-	occode = zzocced_(svorig, bckpos, bsmaxs, frtpos, fsmaxs);
-	if (failed_()) {
-	    chkout_("ZZGFOCST", (ftnlen)8);
-	    return 0;
+	    for (i__ = 1; i__ <= 3; ++i__) {
+		vscl_(&svfrad[(i__1 = i__ - 1) < 3 && 0 <= i__1 ? i__1 : s_rnge(
+			"svfrad", i__1, "zzgfocu_", (ftnlen)1649)], &mtemp[(i__2 =
+			 i__ * 3 - 3) < 9 && 0 <= i__2 ? i__2 : s_rnge("mtemp", 
+			i__2, "zzgfocu_", (ftnlen)1649)], &fsmaxs[(i__3 = i__ * 3 
+			- 3) < 9 && 0 <= i__3 ? i__3 : s_rnge("fsmaxs", i__3, 
+			"zzgfocu_", (ftnlen)1649)]);
+	    }
+
+/*           Classify the occultation state of BACK by FRONT as seen from */
+/*           the observer. */
+
+	    occode = zzocced_(svorig, bckpos, bsmaxs, frtpos, fsmaxs);
+	    if (failed_()) {
+		chkout_("ZZGFOCST", (ftnlen)8);
+		return 0;
+	    }
 	}
 	if (occode == 0) {
 
@@ -0,0 +1,480 @@
+// clang-format off
+/*
+
+- Source_File DASUtils.cpp (DAS utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   DAS
+   DSK
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (DASUtils.hpp). The directory is read as
+   dasa2l reads it:
+
+      The file record is record 1, and holds the number of reserved and
+      comment records, which precede the first directory record, and
+      the binary format of the file.
+
+      A directory record holds the numbers of the previous and next
+      directory records, the lowest and highest address of each type of
+      data which its clusters hold, the type of its first cluster, and
+      then the number of records in each cluster. A positive count means
+      the cluster's type follows that of the cluster before it, in the
+      order character, double precision, integer, and a negative count
+      that it precedes it.
+
+      The clusters which a directory describes directly follow it.
+
+   A record holds 128 double precision words, 256 integer words, or 1024
+   characters, and only the last record of each type may be partly full.
+
+- Literature_References
+
+   CSPICE's documentation for the DAS required reading, and for dasa2l.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, algorithm for the cluster search, the C
+headers for the words of the file, and the headers of whichever system call
+maps the file.
+*/
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined( _WIN32 )
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "DASUtils.hpp"
+
+/*
+This constructor creates a reader with no file mapped.
+*/
+cppspice::MappedDASFile::MappedDASFile() :
+   contents( nullptr ), size( 0 ), file( nullptr ), mapping( nullptr ) {}
+
+/*
+This constructor maps a file, which isOpen reports the success of.
+*/
+cppspice::MappedDASFile::MappedDASFile( const std::string& fileName ) :
+   MappedDASFile() {
+   open( fileName );
+}
+
+/*
+Moves hand the mapping over, leaving the other reader closed.
+*/
+cppspice::MappedDASFile::MappedDASFile( MappedDASFile&& other ) noexcept :
+   MappedDASFile() {
+   swap( other );
+}
+
+cppspice::MappedDASFile& cppspice::MappedDASFile::operator=(
+   MappedDASFile&& other ) noexcept {
+   close();
+   swap( other );
+   return *this;
+}
+
+cppspice::MappedDASFile::~MappedDASFile() {
+   close();
+}
+
+void cppspice::MappedDASFile::swap( MappedDASFile& other ) noexcept {
+   std::swap( contents, other.contents );
+   std::swap( size, other.size );
+   std::swap( file, other.file );
+   std::swap( mapping, other.mapping );
+   doubleClusters.swap( other.doubleClusters );
+   integerClusters.swap( other.integerClusters );
+}
+
+/*
+This function maps a DAS file into memory.
+*/
+bool cppspice::MappedDASFile::open( const std::string& fileName ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The path of the file.
+
+   - Detailed_Input
+
+      fileName    the path of a DAS file, such as a DSK.
+
+   - Detailed_Output
+
+      Returns true if the file was mapped and its directory read. Otherwise
+   false is returned, and the reader is left closed.
+
+   - Error Handling
+
+      A file which can't be mapped isn't an error, since it can still be
+   read through CSPICE, so nothing is reported.
+
+   - Particulars
+
+      The file is mapped read-only, and shares its pages with the operating
+   system's file cache, so nothing is read from the file until it is used.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   close();
+
+#if defined( _WIN32 )
+   HANDLE fileHandle = CreateFileA(
+      fileName.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ | FILE_SHARE_WRITE,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr );
+   if ( fileHandle == INVALID_HANDLE_VALUE ) {
+      return false;
+   }
+   file = fileHandle;
+   LARGE_INTEGER fileSize;
+   if ( !GetFileSizeEx( fileHandle, &fileSize ) ||
+        fileSize.QuadPart < DASRECORDBYTES )
+   {
+      close();
+      return false;
+   }
+   size = fileSize.QuadPart;
+   mapping =
+      CreateFileMappingA( fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+   if ( mapping == nullptr ) {
+      close();
+      return false;
+   }
+   contents = static_cast<const unsigned char*>(
+      MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+#else
+   int descriptor = ::open( fileName.c_str(), O_RDONLY );
+   if ( descriptor < 0 ) {
+      return false;
+   }
+   struct stat status;
+   if ( fstat( descriptor, &status ) != 0 ||
+        status.st_size < DASRECORDBYTES )
+   {
+      ::close( descriptor );
+      return false;
+   }
+   size         = status.st_size;
+   void* region = mmap( nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0 );
+   ::close( descriptor );
+   if ( region != MAP_FAILED ) {
+      contents = static_cast<const unsigned char*>( region );
+   }
+#endif
+   if ( contents == nullptr ) {
+      close();
+      return false;
+   }
+
+   /*
+   The file must be a DAS file in the native binary format, which is
+   named in the file record.
+   */
+   const std::uint16_t probe = 1;
+   unsigned char       lowByte{ 0 };
+   std::memcpy( &lowByte, &probe, 1 );
+   const char* format = lowByte == 1 ? "LTL-IEEE" : "BIG-IEEE";
+   if ( std::memcmp( contents, "DAS/", 4 ) != 0 ||
+        std::memcmp( contents + DASFORMATOFFSET, format, 8 ) != 0 ||
+        !readDirectory() )
+   {
+      close();
+      return false;
+   }
+   return true;
+}
+
+/*
+This function unmaps the file.
+*/
+void cppspice::MappedDASFile::close() {
+#if defined( _WIN32 )
+   if ( contents != nullptr ) {
+      UnmapViewOfFile( contents );
+   }
+   if ( mapping != nullptr ) {
+      CloseHandle( mapping );
+   }
+   if ( file != nullptr ) {
+      CloseHandle( file );
+   }
+#else
+   if ( contents != nullptr ) {
+      munmap( const_cast<unsigned char*>( contents ), size );
+   }
+#endif
+   contents = nullptr;
+   size     = 0;
+   file     = nullptr;
+   mapping  = nullptr;
+   doubleClusters.clear();
+   integerClusters.clear();
+}
+
+bool cppspice::MappedDASFile::isOpen() const {
+   return contents != nullptr;
+}
+
+SpiceInt cppspice::MappedDASFile::getLastDouble() const {
+   return doubleClusters.empty() ? 0 : doubleClusters.back().Last;
+}
+
+SpiceInt cppspice::MappedDASFile::getLastInteger() const {
+   return integerClusters.empty() ? 0 : integerClusters.back().Last;
+}
+
+/*
+This helper reads the directory records, and lists the clusters of double
+precision and integer data.
+*/
+bool cppspice::MappedDASFile::readDirectory() {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      None.
+
+   - Detailed_Input
+
+      None. The file must be mapped.
+
+   - Detailed_Output
+
+      Returns true if the directory was read. The clusters are listed in
+   order of their addresses.
+
+   - Error Handling
+
+      A directory which is inconsistent with the size of the file, or
+   which doesn't end, is treated as a file which can't be mapped.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   const long long records = size / DASRECORDBYTES;
+   auto            word    = [&]( long long record, SpiceInt index ) {
+      std::int32_t value;
+      std::memcpy(
+         &value,
+         contents + ( record - 1 ) * DASRECORDBYTES + 4 * ( index - 1 ),
+         sizeof( value ) );
+      return static_cast<SpiceInt>( value );
+   };
+   std::int32_t counts[4];
+   std::memcpy( counts, contents + DASCOUNTOFFSET, sizeof( counts ) );
+
+   /*
+   Walk the chain of directories, counting the addresses of each type of
+   data through its clusters. A chain which loops back on itself is caught
+   by counting the directories.
+   */
+   const SpiceInt wordsPerRecord[3] = { DASRECORDBYTES,
+                                        DASDPWORDS,
+                                        DASINTWORDS };
+   long long      directory         = 2LL + counts[0] + counts[2];
+   long long      visited           = 0;
+   while ( directory > 0 ) {
+      if ( directory > records || ++visited > records ) {
+         return false;
+      }
+      SpiceInt address[3] = { word( directory, 3 ),
+                              word( directory, 5 ),
+                              word( directory, 7 ) };
+      SpiceInt highest[3] = { word( directory, 4 ),
+                              word( directory, 6 ),
+                              word( directory, 8 ) };
+      SpiceInt type       = word( directory, 9 );
+      if ( type < DASCHARTYPE || type > DASINTTYPE ) {
+         return false;
+      }
+
+      /*
+      The first count is positive, so start from the type which precedes
+      that of the first cluster.
+      */
+      type           = ( type + 1 ) % 3 + 1;
+      long long base = directory + 1;
+      for ( SpiceInt i = DASFIRSTDESCRIPTOR; i <= DASINTWORDS; i++ ) {
+         SpiceInt count = word( directory, i );
+         if ( count == 0 ) {
+            break;
+         }
+         type  = count > 0 ? type % 3 + 1 : ( type + 1 ) % 3 + 1;
+         count = std::abs( count );
+         if ( base + count - 1 > records ) {
+            return false;
+         }
+         SpiceInt words = count * wordsPerRecord[type - 1];
+         Cluster  cluster{
+            address[type - 1],
+            std::min( address[type - 1] + words - 1, highest[type - 1] ),
+            ( base - 1 ) * DASRECORDBYTES };
+         if ( type == DASDPTYPE ) {
+            doubleClusters.push_back( cluster );
+         }
+         else if ( type == DASINTTYPE ) {
+            integerClusters.push_back( cluster );
+         }
+         address[type - 1] += words;
+         base += count;
+      }
+      directory = word( directory, 2 );
+   }
+   return true;
+}
+
+/*
+This helper finds the cluster holding an address, or returns a null pointer
+if no cluster holds it.
+*/
+const cppspice::MappedDASFile::Cluster* cppspice::MappedDASFile::findCluster(
+   const std::vector<Cluster>& clusters,
+   const SpiceInt              address ) const {
+   auto after = std::upper_bound(
+      clusters.begin(),
+      clusters.end(),
+      address,
+      []( const SpiceInt value, const Cluster& cluster ) {
+         return value < cluster.First;
+      } );
+   if ( after == clusters.begin() || address > ( after - 1 )->Last ) {
+      return nullptr;
+   }
+   return &*( after - 1 );
+}
+
+/*
+These functions return data in place, when it lies within one cluster.
+*/
+const SpiceDouble* cppspice::MappedDASFile::getDoubles(
+   const SpiceInt first,
+   const SpiceInt last ) const {
+   const Cluster* cluster = findCluster( doubleClusters, first );
+   if ( cluster == nullptr || last < first || last > cluster->Last ) {
+      return nullptr;
+   }
+   return reinterpret_cast<const SpiceDouble*>(
+      contents + cluster->Offset +
+      sizeof( SpiceDouble ) * ( first - cluster->First ) );
+}
+
+const SpiceInt* cppspice::MappedDASFile::getIntegers(
+   const SpiceInt first,
+   const SpiceInt last ) const {
+   if ( sizeof( SpiceInt ) != sizeof( std::int32_t ) ) {
+      return nullptr;
+   }
+   const Cluster* cluster = findCluster( integerClusters, first );
+   if ( cluster == nullptr || last < first || last > cluster->Last ) {
+      return nullptr;
+   }
+   return reinterpret_cast<const SpiceInt*>(
+      contents + cluster->Offset +
+      sizeof( std::int32_t ) * ( first - cluster->First ) );
+}
+
+/*
+These functions copy data, cluster by cluster.
+*/
+bool cppspice::MappedDASFile::readDoubles(
+   const SpiceInt first,
+   const SpiceInt last,
+   SpiceDouble*   values ) const {
+   for ( SpiceInt address = first; address <= last; ) {
+      const Cluster* cluster = findCluster( doubleClusters, address );
+      if ( cluster == nullptr ) {
+         return false;
+      }
+      SpiceInt end = std::min( last, cluster->Last );
+      std::memcpy(
+         values + ( address - first ),
+         contents + cluster->Offset +
+            sizeof( SpiceDouble ) * ( address - cluster->First ),
+         sizeof( SpiceDouble ) * ( end - address + 1 ) );
+      address = end + 1;
+   }
+   return first <= last;
+}
+
+bool cppspice::MappedDASFile::readIntegers(
+   const SpiceInt first,
+   const SpiceInt last,
+   SpiceInt*      values ) const {
+   for ( SpiceInt address = first; address <= last; ) {
+      const Cluster* cluster = findCluster( integerClusters, address );
+      if ( cluster == nullptr ) {
+         return false;
+      }
+      SpiceInt             end  = std::min( last, cluster->Last );
+      const unsigned char* word = contents + cluster->Offset +
+                                  4 * ( address - cluster->First );
+      for ( ; address <= end; address++, word += 4 ) {
+         std::int32_t value;
+         std::memcpy( &value, word, sizeof( value ) );
+         values[address - first] = static_cast<SpiceInt>( value );
+      }
+   }
+   return first <= last;
+}
+/* End DASUtils.cpp */
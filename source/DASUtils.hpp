@@ -0,0 +1,166 @@
+// clang-format off
+/*
+
+- Header_File DASUtils.hpp (DAS utility code)
+
+- Abstract
+
+   Define a reader which maps a DAS file into memory, so that its double
+   precision and integer data can be used in place rather than read
+   through the CSPICE DAS subsystem.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   DAS
+   DSK
+
+- Particulars
+
+   This file is a header which defines the mapped DAS file. The CSPICE DAS
+   routines read a file one 1024 byte record at a time, through a small
+   buffer of records, and copy each word into the caller's array. For a
+   large DSK, most of the time spent loading a segment goes to these reads.
+
+   A DAS file stores each type of data in clusters of consecutive records,
+   which are listed in the file's directory records. A file whose binary
+   format is native to this machine is mapped into memory, and its
+   directory is read to find where each cluster begins. Since the words of
+   a cluster are laid out in the file just as they would be in an array,
+   a range of addresses which lies within one cluster can then be used
+   directly from the mapping, without being copied at all.
+
+- Literature_References
+
+   CSPICE's documentation for the DAS required reading, and for dasa2l.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   Only files in the native binary format can be mapped, and only files
+   which are not open for writing should be, since the CSPICE buffers of
+   such a file may hold records which haven't been written yet. Integer
+   data can only be used in place when SpiceInt is 32 bits wide, as the
+   words of the file are.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes and the vector header for this file.
+*/
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   A DAS file mapped into memory. Addresses are the logical addresses used
+   by dasrdd_c and dasrdi_c, which start at one for each type of data.
+   */
+   class MappedDASFile {
+   public:
+      MappedDASFile();
+      explicit MappedDASFile( const std::string& fileName );
+      MappedDASFile( MappedDASFile&& other ) noexcept;
+      MappedDASFile& operator=( MappedDASFile&& other ) noexcept;
+      ~MappedDASFile();
+
+      MappedDASFile( const MappedDASFile& )            = delete;
+      MappedDASFile& operator=( const MappedDASFile& ) = delete;
+
+      /*
+      Map a file, closing any file which was mapped before. False is
+      returned if the file can't be opened, isn't a DAS file, or isn't in
+      the native binary format, in which case it must be read through
+      CSPICE instead.
+      */
+      bool open( const std::string& fileName );
+
+      /*
+      Unmap the file.
+      */
+      void close();
+
+      bool isOpen() const;
+
+      /*
+      The last address of each type of data which the file holds.
+      */
+      SpiceInt getLastDouble() const;
+      SpiceInt getLastInteger() const;
+
+      /*
+      The data at the addresses first through last, in place. A null
+      pointer is returned if the addresses don't lie within one cluster.
+      The data stays valid until the file is closed.
+      */
+      const SpiceDouble* getDoubles(
+         const SpiceInt first,
+         const SpiceInt last ) const;
+      const SpiceInt* getIntegers(
+         const SpiceInt first,
+         const SpiceInt last ) const;
+
+      /*
+      Copy the data at the addresses first through last, as dasrdd_c and
+      dasrdi_c do, across as many clusters as they span.
+      */
+      bool readDoubles(
+         const SpiceInt first,
+         const SpiceInt last,
+         SpiceDouble*   values ) const;
+      bool readIntegers(
+         const SpiceInt first,
+         const SpiceInt last,
+         SpiceInt*      values ) const;
+
+      void swap( MappedDASFile& other ) noexcept;
+
+   private:
+      /*
+      A run of consecutive records holding one type of data, with the
+      addresses of its first and last words and its offset in the file.
+      */
+      struct Cluster {
+         SpiceInt  First;
+         SpiceInt  Last;
+         long long Offset;
+      };
+
+      bool readDirectory();
+
+      const Cluster* findCluster(
+         const std::vector<Cluster>& clusters,
+         const SpiceInt              address ) const;
+
+      const unsigned char* contents;
+      long long            size;
+      void*                file;
+      void*                mapping;
+      std::vector<Cluster> doubleClusters;
+      std::vector<Cluster> integerClusters;
+   };
+}   // namespace cppspice
+    /* End DASUtils.hpp */
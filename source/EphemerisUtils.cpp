@@ -0,0 +1,920 @@
+// clang-format off
+/*
+
+- Source_File EphemerisUtils.cpp (Ephemeris utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (EphemerisUtils.hpp). These functions evaluate
+   SPK segments directly using spksfs_c and spkpvn_c so that the nodes of
+   each body's center chain can be shared between bodies.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header and the algorithm header.
+*/
+#include <algorithm>
+
+#include "EphemerisUtils.hpp"
+
+/*
+The running count of SPK segment evaluations. This is only used for
+reporting, so a simple file-scope counter is sufficient.
+*/
+static long long segmentEvaluations{ 0 };
+
+/*
+A function which retrieves the J2000 states of several bodies relative to
+a reference body with spkez_c. This is the fallback for kernels whose center
+chains don't all reach the solar system barycenter.
+*/
+static bool getSpkezStates(
+   const std::vector<SpiceInt>&       bodyIDs,
+   const SpiceDouble                  epoch,
+   const SpiceChar*                   abcorr,
+   const SpiceInt                     referenceID,
+   std::vector<cppspice::BodyState>& states ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      vector        I   The NAIF IDs of the bodies.
+      SpiceDouble   I   The epoch being evaluated.
+      SpiceChar*    I   The aberration correction.
+      SpiceInt      I   The NAIF ID of the reference body.
+      vector        O   The states and light times of the bodies.
+
+   - Detailed_Input
+
+      bodyIDs     a vector of ints representing the NAIF IDs of the bodies
+                  whose states are requested.
+      epoch       a double representing the epoch being evaluated.
+      abcorr      the aberration correction passed to spkez_c.
+      referenceID an int representing the NAIF ID of the body relative to
+                  which the states are computed.
+
+   - Detailed_Output
+
+      states      a vector of BodyState, one per requested body and in the
+                  same order. spkez_c doesn't return the light time rate,
+                  so it is left at zero.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling. In
+   particular, spkez_c signals an error if the ephemeris data is
+   insufficient.
+
+   - Particulars
+
+      None.
+
+   - Literature_References
+
+      CSPICE's documentation for spkez_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   states.clear();
+   states.reserve( bodyIDs.size() );
+   for ( auto& id : bodyIDs ) {
+      cppspice::BodyState result;
+      spkez_c(
+         id,
+         epoch,
+         "J2000",
+         abcorr,
+         referenceID,
+         result.State.data(),
+         &result.LightTime );
+      result.LightTimeRate = 0.0;
+      states.push_back( result );
+   }
+
+   return true;
+}
+
+/*
+A function which retrieves the J2000 state of a body relative to the solar
+system barycenter, evaluating only those chain nodes which are not already
+present in the cache.
+*/
+bool cppspice::getBarycentricState(
+   const SpiceInt    bodyID,
+   const SpiceDouble epoch,
+   ChainStateCache&  cache,
+   StateVector&      state ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceInt      I   The NAIF ID of the body.
+      SpiceDouble   I   The epoch being evaluated.
+      struct       I/O  The cache of chain node states.
+      StateVector   O   The J2000 state of the body relative to the SSB.
+
+   - Detailed_Input
+
+      bodyID      an int representing the NAIF ID of the body.
+      epoch       a double representing the epoch being evaluated.
+      cache       a ChainStateCache containing the barycentric states of
+                  any chain nodes which have already been evaluated. Any
+                  nodes evaluated by this call are added to the cache.
+
+   - Detailed_Output
+
+      state       the J2000 state of the body relative to the solar system
+                  barycenter at the specified epoch.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The body's center chain is walked upwards one segment at a time until
+   either the solar system barycenter or a node which is already present in
+   the cache is reached. The relative states are then accumulated back down
+   the chain, and each intermediate node is stored in the cache.
+
+      If a node has no segment at the epoch, the chain doesn't reach the
+   barycenter. No error is reported in that case; the cache is marked
+   incomplete and false is returned, so that the caller can fall back to
+   spkez_c, which only needs a center common to the bodies.
+
+   - Literature_References
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   The solar system barycenter is the root of every chain.
+   */
+   state.fill( 0.0 );
+   if ( bodyID == 0 ) {
+      return true;
+   }
+
+   /*
+   If we've already evaluated this body at this epoch, we're done.
+   */
+   auto& nodes      = cache.NodeStates[epoch];
+   auto  nodeLookup = nodes.find( bodyID );
+   if ( nodeLookup != nodes.end() ) {
+      state = nodeLookup->second;
+      return true;
+   }
+
+   /*
+   Otherwise, walk up the chain until we reach either the barycenter or a
+   node which we've already evaluated. Along the way, keep track of each
+   node and its state relative to its center.
+   */
+   std::vector<std::pair<SpiceInt, StateVector>> path;
+   SpiceInt                                      current{ bodyID };
+   while ( current != 0 ) {
+      auto cached = nodes.find( current );
+      if ( cached != nodes.end() ) {
+         state = cached->second;
+         break;
+      }
+
+      if ( path.size() >= CHAINLIMIT ) {
+         std::cout << "Error: the center chain of body " << bodyID
+                   << " exceeds the maximum length of " << CHAINLIMIT
+                   << " segments." << std::endl;
+         return false;
+      }
+
+      /*
+      Find the segment which applies to the current node at this epoch.
+      */
+      SpiceInt     handle{ 0 };
+      SpiceDouble  descr[5];
+      SpiceChar    ident[SEGIDLEN];
+      SpiceBoolean found{ false };
+      spksfs_c( current, epoch, SEGIDLEN, &handle, descr, ident, &found );
+      if ( !found ) {
+         cache.Incomplete = true;
+         return false;
+      }
+
+      /*
+      Evaluate the segment, which gives us the state relative to the
+      segment's center in the segment's frame.
+      */
+      SpiceInt    frameCode{ 0 };
+      SpiceInt    center{ 0 };
+      StateVector relative;
+      spkpvn_c( handle, descr, epoch, &frameCode, relative.data(), &center );
+      segmentEvaluations++;
+
+      /*
+      Most segments are already in J2000, but if not we need to rotate the
+      state.
+      */
+      if ( frameCode != J2000CODE ) {
+         SpiceChar   frameName[FRAMELEN];
+         SpiceDouble xform[6][6];
+         StateVector rotated;
+         frmnam_c( frameCode, FRAMELEN, frameName );
+         sxform_c( frameName, "J2000", epoch, xform );
+         mxvg_c( xform, relative.data(), 6, 6, rotated.data() );
+         relative = rotated;
+      }
+
+      path.emplace_back( current, relative );
+      current = center;
+   }
+
+   /*
+   Finally, accumulate the relative states from the top of the chain back
+   down to the requested body, caching each node as we go.
+   */
+   for ( auto node = path.rbegin(); node != path.rend(); node++ ) {
+      for ( size_t i = 0; i < state.size(); i++ ) {
+         state[i] += node->second[i];
+      }
+      nodes[node->first] = state;
+   }
+
+   return true;
+}
+
+/*
+A function which retrieves the J2000 states of several bodies relative to
+a common reference body at a single epoch, with or without light time
+correction. Chain nodes which are shared between the bodies are only
+evaluated once.
+*/
+bool cppspice::getMultiBodyStates(
+   const std::vector<SpiceInt>& bodyIDs,
+   const SpiceDouble            epoch,
+   const SpiceChar*             abcorr,
+   const SpiceInt               referenceID,
+   std::vector<BodyState>&      states ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      vector        I   The NAIF IDs of the bodies.
+      SpiceDouble   I   The epoch being evaluated.
+      SpiceChar*    I   The aberration correction.
+      SpiceInt      I   The NAIF ID of the reference body.
+      vector        O   The states and light times of the bodies.
+
+   - Detailed_Input
+
+      bodyIDs     a vector of ints representing the NAIF IDs of the bodies
+                  whose states are requested.
+      epoch       a double representing the epoch being evaluated.
+      abcorr      the aberration correction, which must be one of "NONE",
+                  "LT", or "CN". These have the same meaning as in spkez_c.
+      referenceID an int representing the NAIF ID of the body relative to
+                  which the states are computed.
+
+   - Detailed_Output
+
+      states      a vector of BodyState, one per requested body and in the
+                  same order, containing the J2000 state of each body
+                  relative to the reference body and the one-way light time
+                  between them. These match the outputs of spkez_c.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The light time iteration mirrors the one performed by spkltc. Since the
+   reference body's chain and the uncorrected chains are evaluated at the
+   same epoch, these are shared between all of the requested bodies.
+
+      If any of the center chains ends before the solar system barycenter,
+   the states are taken from spkez_c instead, which only needs a center
+   common to the bodies.
+
+   - Literature_References
+
+      CSPICE's documentation for spkez_c and spkltc_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   First, determine how many light time iterations we need.
+   */
+   std::string correction{ abcorr };
+   std::transform(
+      correction.begin(),
+      correction.end(),
+      correction.begin(),
+      ::toupper );
+   SpiceInt numIterations{ 0 };
+   if ( correction == "NONE" ) {
+      numIterations = 0;
+   }
+   else if ( correction == "LT" ) {
+      numIterations = 1;
+   }
+   else if ( correction == "CN" ) {
+      numIterations = LTMAXITER;
+   }
+   else {
+      std::cout << "Error: the aberration correction '" << abcorr
+                << "' is not supported." << std::endl;
+      return false;
+   }
+
+   /*
+   All of the bodies share this cache, so any common chain nodes will only
+   be evaluated once.
+   */
+   ChainStateCache cache;
+   StateVector     referenceState;
+   if ( !getBarycentricState( referenceID, epoch, cache, referenceState ) ) {
+      return cache.Incomplete &&
+             getSpkezStates( bodyIDs, epoch, abcorr, referenceID, states );
+   }
+
+   states.clear();
+   states.reserve( bodyIDs.size() );
+   for ( auto& id : bodyIDs ) {
+      /*
+      Get the geometric state at the observation epoch, which is also our
+      initial light time estimate.
+      */
+      StateVector bodyState;
+      BodyState   result;
+      if ( !getBarycentricState( id, epoch, cache, bodyState ) ) {
+         return cache.Incomplete &&
+                getSpkezStates( bodyIDs, epoch, abcorr, referenceID, states );
+      }
+      vsubg_c(
+         bodyState.data(),
+         referenceState.data(),
+         6,
+         result.State.data() );
+      result.LightTime     = vnorm_c( result.State.data() ) / clight_c();
+      result.LightTimeRate = 0.0;
+
+      /*
+      Now iterate on the light time, unless we're not correcting for it or
+      the body is the reference body.
+      */
+      if ( numIterations > 0 && result.LightTime != 0.0 ) {
+         if ( !solveLightTime(
+                 id,
+                 epoch,
+                 referenceState,
+                 numIterations,
+                 cache,
+                 result ) )
+         {
+            return cache.Incomplete &&
+                   getSpkezStates(
+                      bodyIDs,
+                      epoch,
+                      abcorr,
+                      referenceID,
+                      states );
+         }
+      }
+
+      states.push_back( result );
+   }
+
+   return true;
+}
+
+/*
+A function which retrieves the J2000 states of several bodies relative to
+a common reference body at a single epoch, converging the light time from
+the solutions stored in a light time cache.
+*/
+bool cppspice::getMultiBodyStates(
+   const std::vector<SpiceInt>& bodyIDs,
+   const SpiceDouble            epoch,
+   const SpiceInt               referenceID,
+   LightTimeCache&              lightTimes,
+   std::vector<BodyState>&      states ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      vector        I   The NAIF IDs of the bodies.
+      SpiceDouble   I   The epoch being evaluated.
+      SpiceInt      I   The NAIF ID of the reference body.
+      struct       I/O  The light time solutions from previous calls.
+      vector        O   The states and light times of the bodies.
+
+   - Detailed_Input
+
+      bodyIDs     a vector of ints representing the NAIF IDs of the bodies
+                  whose states are requested.
+      epoch       a double representing the epoch being evaluated.
+      referenceID an int representing the NAIF ID of the body relative to
+                  which the states are computed.
+      lightTimes  a LightTimeCache containing the most recent light time
+                  solution for each (body, reference) pair. The solutions
+                  computed by this call replace the cached ones.
+
+   - Detailed_Output
+
+      states      a vector of BodyState, one per requested body and in the
+                  same order, containing the light time corrected J2000
+                  state of each body relative to the reference body.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      When a cached solution exists for a pair, its light time is
+   extrapolated to the new epoch using the cached light time rate and used
+   as the starting estimate. For nearby epochs (e.g. during bisection) this
+   converges in a single iteration, so the geometric evaluation at the
+   observation epoch is skipped entirely. Pairs without a cached solution
+   are cold-started from the geometric light time.
+
+      The light time is always converged as with the "CN" correction, so the
+   results may differ from "LT" by the error of its single iteration.
+
+      If any of the center chains ends before the solar system barycenter,
+   the states are taken from spkez_c with "CN" instead, and the cache is not
+   updated for the remaining bodies.
+
+   - Literature_References
+
+      CSPICE's documentation for spkez_c and spkltc_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   The reference body's state is needed regardless.
+   */
+   ChainStateCache cache;
+   StateVector     referenceState;
+   if ( !getBarycentricState( referenceID, epoch, cache, referenceState ) ) {
+      return cache.Incomplete &&
+             getSpkezStates( bodyIDs, epoch, "CN", referenceID, states );
+   }
+
+   states.clear();
+   states.reserve( bodyIDs.size() );
+   for ( auto& id : bodyIDs ) {
+      BodyState result;
+      result.LightTimeRate = 0.0;
+
+      /*
+      The reference body has no light time, so just use its state.
+      */
+      if ( id == referenceID ) {
+         result.State.fill( 0.0 );
+         result.LightTime = 0.0;
+         states.push_back( result );
+         continue;
+      }
+
+      /*
+      If we have a previous solution, extrapolate it to this epoch.
+      Otherwise, start from the geometric light time.
+      */
+      auto key    = std::make_pair( id, referenceID );
+      auto cached = lightTimes.Solutions.find( key );
+      if ( cached != lightTimes.Solutions.end() ) {
+         result.LightTime =
+            cached->second.LightTime +
+            cached->second.LightTimeRate * ( epoch - cached->second.Epoch );
+      }
+      else {
+         StateVector bodyState;
+         if ( !getBarycentricState( id, epoch, cache, bodyState ) ) {
+            return cache.Incomplete &&
+                   getSpkezStates(
+                      bodyIDs,
+                      epoch,
+                      "CN",
+                      referenceID,
+                      states );
+         }
+         vsubg_c(
+            bodyState.data(),
+            referenceState.data(),
+            6,
+            result.State.data() );
+         result.LightTime = vnorm_c( result.State.data() ) / clight_c();
+      }
+
+      if ( !solveLightTime(
+              id,
+              epoch,
+              referenceState,
+              LTMAXITER,
+              cache,
+              result ) )
+      {
+         return cache.Incomplete &&
+                getSpkezStates( bodyIDs, epoch, "CN", referenceID, states );
+      }
+
+      /*
+      Save the solution for the next call.
+      */
+      lightTimes.Solutions[key] = LightTimeSolution{
+         epoch,
+         result.LightTime,
+         result.LightTimeRate };
+      states.push_back( result );
+   }
+
+   return true;
+}
+
+/*
+A function which retrieves the light time corrected J2000 state of a target
+relative to an observer, starting the light time iteration from a provided
+estimate.
+*/
+bool cppspice::getWarmStartState(
+   const SpiceInt    targetID,
+   const SpiceDouble epoch,
+   const SpiceInt    observerID,
+   const SpiceDouble lightTimeEstimate,
+   BodyState&        state ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceInt      I   The NAIF ID of the target.
+      SpiceDouble   I   The epoch being evaluated.
+      SpiceInt      I   The NAIF ID of the observer.
+      SpiceDouble   I   The initial light time estimate in seconds.
+      struct        O   The state and light time of the target.
+
+   - Detailed_Input
+
+      targetID          an int representing the NAIF ID of the target.
+      epoch             a double representing the observation epoch.
+      observerID        an int representing the NAIF ID of the observer.
+      lightTimeEstimate a double representing the light time, in seconds,
+                        from which the iteration starts. Typically this is
+                        the solution from a nearby epoch.
+
+   - Detailed_Output
+
+      state       a BodyState containing the light time corrected J2000
+                  state of the target relative to the observer, the one-way
+                  light time, and its rate of change.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      If the estimate is close to the solution, the iteration converges
+   after a single evaluation of the target's chain.
+
+      If either center chain ends before the solar system barycenter, the
+   state is taken from spkez_c with "CN" instead.
+
+   - Literature_References
+
+      CSPICE's documentation for spkltc_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ChainStateCache cache;
+   StateVector     observerState;
+   state.LightTime     = lightTimeEstimate;
+   state.LightTimeRate = 0.0;
+   if ( getBarycentricState( observerID, epoch, cache, observerState ) &&
+        solveLightTime(
+           targetID,
+           epoch,
+           observerState,
+           LTMAXITER,
+           cache,
+           state ) )
+   {
+      return true;
+   }
+
+   /*
+   If either chain ends before the barycenter, fall back to spkez_c.
+   */
+   std::vector<BodyState> states;
+   if ( !cache.Incomplete ||
+        !getSpkezStates( { targetID }, epoch, "CN", observerID, states ) )
+   {
+      return false;
+   }
+   state = states[0];
+   return true;
+}
+
+/*
+A function which iterates on the light time between a body and a reference
+state, starting from the light time already stored in the result.
+*/
+bool cppspice::solveLightTime(
+   const SpiceInt     bodyID,
+   const SpiceDouble  epoch,
+   const StateVector& referenceState,
+   const SpiceInt     maxIterations,
+   ChainStateCache&   cache,
+   BodyState&         result ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceInt      I   The NAIF ID of the body.
+      SpiceDouble   I   The observation epoch.
+      StateVector   I   The J2000 barycentric state of the reference body.
+      SpiceInt      I   The maximum number of iterations.
+      struct       I/O  The cache of chain node states.
+      struct       I/O  The state and light time of the body.
+
+   - Detailed_Input
+
+      bodyID         an int representing the NAIF ID of the body.
+      epoch          a double representing the observation epoch.
+      referenceState the J2000 state of the reference body relative to the
+                     solar system barycenter at the observation epoch.
+      maxIterations  the maximum number of light time iterations.
+      cache          a ChainStateCache shared with other evaluations.
+      result         a BodyState whose LightTime member contains the
+                     initial light time estimate.
+
+   - Detailed_Output
+
+      result         the light time corrected J2000 state of the body
+                     relative to the reference body, the one-way light time,
+                     and the rate of change of the light time.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The iteration and the light time rate computation mirror spkltc. The
+   iteration stops once the change in light time is negligible relative to
+   the corrected epoch, or once the maximum number of iterations is reached.
+   At least one iteration is always performed.
+
+   - Literature_References
+
+      CSPICE's documentation for spkltc_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   StateVector bodyState;
+   SpiceInt    i{ 0 };
+   SpiceDouble lightTimeError{ 1.0 };
+   do {
+      /*
+      The body is evaluated at the light time corrected epoch, while the
+      reference body remains where it is at the observation epoch.
+      */
+      SpiceDouble correctedEpoch = epoch - result.LightTime;
+      if ( !getBarycentricState(
+              bodyID,
+              correctedEpoch,
+              cache,
+              bodyState ) )
+      {
+         return false;
+      }
+      vsubg_c(
+         bodyState.data(),
+         referenceState.data(),
+         6,
+         result.State.data() );
+
+      SpiceDouble previousLightTime = result.LightTime;
+      result.LightTime = vnorm_c( result.State.data() ) / clight_c();
+
+      lightTimeError = std::abs( result.LightTime - previousLightTime ) /
+                       std::max( 1.0, std::abs( correctedEpoch ) );
+      i++;
+   } while ( i < maxIterations && lightTimeError > LTTOLERANCE );
+
+   /*
+   If the body and the reference coincide, there's no light time rate to
+   compute.
+   */
+   if ( result.LightTime == 0.0 ) {
+      result.LightTimeRate = 0.0;
+      return true;
+   }
+
+   /*
+   As in spkltc, the corrected velocity accounts for the rate of change of
+   the light time.
+   */
+   SpiceDouble a = 1.0 / ( clight_c() * vnorm_c( result.State.data() ) );
+   SpiceDouble b = vdot_c( result.State.data(), &result.State[3] );
+   SpiceDouble c = vdot_c( result.State.data(), &bodyState[3] );
+   result.LightTimeRate = a * b / ( 1.0 + c * a );
+   vlcom_c(
+      1.0 - result.LightTimeRate,
+      &bodyState[3],
+      -1.0,
+      &referenceState[3],
+      &result.State[3] );
+
+   return true;
+}
+
+/*
+The number of SPK segment evaluations performed by this module since the
+last reset.
+*/
+long long cppspice::getSegmentEvaluationCount() {
+   /*
+   - Detailed_Output
+
+      Returns the number of SPK segment evaluations performed since the last
+   call to resetSegmentEvaluationCount.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   return segmentEvaluations;
+}
+
+/*
+Reset the SPK segment evaluation count.
+*/
+void cppspice::resetSegmentEvaluationCount() {
+   /*
+   - Detailed_Output
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   segmentEvaluations = 0;
+}
+/* End EphemerisUtils.cpp */
@@ -0,0 +1,192 @@
+// clang-format off
+/*
+
+- Header_File EphemerisUtils.hpp (Ephemeris utility code)
+
+- Abstract
+
+   Define utility functions which evaluate body states from the furnished
+   SPK kernels for several bodies at once.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   evaluate the states of several bodies relative to a common reference body.
+   Rather than calling spkez_c once per body (which walks each body's center
+   chain up to the solar system barycenter independently), these functions
+   walk the center chains segment by segment and evaluate each chain node
+   only once per epoch.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   Only the "NONE", "LT", and "CN" aberration corrections are supported.
+   States are always returned in the J2000 frame.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes, plus array, map, and vector for our state
+containers.
+*/
+#include <array>
+#include <map>
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   A six-component state (position and velocity) is used throughout this
+   module, so define it once here.
+   */
+   using StateVector = std::array<SpiceDouble, 6>;
+
+   /*
+   The result of a multi-body query is a state and a one-way light time for
+   each of the requested bodies.
+   */
+   struct BodyState {
+      StateVector State;
+      SpiceDouble LightTime;
+      SpiceDouble LightTimeRate;
+   };
+
+   /*
+   A converged light time solution for a (body, reference) pair, which can
+   be used as the starting estimate at a nearby epoch.
+   */
+   struct LightTimeSolution {
+      SpiceDouble Epoch;
+      SpiceDouble LightTime;
+      SpiceDouble LightTimeRate;
+   };
+
+   /*
+   The most recent light time solutions, keyed by the NAIF IDs of the body
+   and the reference body.
+   */
+   struct LightTimeCache {
+      std::map<std::pair<SpiceInt, SpiceInt>, LightTimeSolution> Solutions;
+   };
+
+   /*
+   The solar system barycenter states of the chain nodes which have already
+   been evaluated, keyed by epoch and then by NAIF ID. Chain nodes are shared
+   between all of the queries which use the same cache. Incomplete is set
+   once a chain is found to end before the barycenter.
+   */
+   struct ChainStateCache {
+      std::map<SpiceDouble, std::map<SpiceInt, StateVector>> NodeStates;
+      bool                                                   Incomplete{
+         false };
+   };
+
+   /*
+   A function which retrieves the J2000 state of a body relative to the solar
+   system barycenter, evaluating only those chain nodes which are not already
+   present in the cache.
+   */
+   bool getBarycentricState(
+      const SpiceInt    bodyID,
+      const SpiceDouble epoch,
+      ChainStateCache&  cache,
+      StateVector&      state );
+
+   /*
+   A function which retrieves the J2000 states of several bodies relative to
+   a common reference body at a single epoch, with or without light time
+   correction. Chain nodes which are shared between the bodies are only
+   evaluated once.
+   */
+   bool getMultiBodyStates(
+      const std::vector<SpiceInt>& bodyIDs,
+      const SpiceDouble            epoch,
+      const SpiceChar*             abcorr,
+      const SpiceInt               referenceID,
+      std::vector<BodyState>&      states );
+
+   /*
+   A function which retrieves the J2000 states of several bodies relative to
+   a common reference body at a single epoch, converging the light time from
+   the solutions stored in a light time cache. This is much cheaper than the
+   uncached version when the epochs of successive calls are close together.
+   */
+   bool getMultiBodyStates(
+      const std::vector<SpiceInt>& bodyIDs,
+      const SpiceDouble            epoch,
+      const SpiceInt               referenceID,
+      LightTimeCache&              lightTimes,
+      std::vector<BodyState>&      states );
+
+   /*
+   A function which retrieves the light time corrected J2000 state of a
+   target relative to an observer, starting the light time iteration from a
+   provided estimate rather than the geometric light time.
+   */
+   bool getWarmStartState(
+      const SpiceInt    targetID,
+      const SpiceDouble epoch,
+      const SpiceInt    observerID,
+      const SpiceDouble lightTimeEstimate,
+      BodyState&        state );
+
+   /*
+   A function which iterates on the light time between a body and a
+   reference state, starting from the light time already stored in the
+   result.
+   */
+   bool solveLightTime(
+      const SpiceInt     bodyID,
+      const SpiceDouble  epoch,
+      const StateVector& referenceState,
+      const SpiceInt     maxIterations,
+      ChainStateCache&   cache,
+      BodyState&         result );
+
+   /*
+   The number of SPK segment evaluations performed by this module since the
+   last reset. This is useful for measuring the effect of chain sharing.
+   */
+   long long getSegmentEvaluationCount();
+
+   /*
+   Reset the SPK segment evaluation count.
+   */
+   void resetSegmentEvaluationCount();
+}   // namespace cppspice
+    /* End EphemerisUtils.hpp */
@@ -0,0 +1,1968 @@
+// clang-format off
+/*
+
+- Source_File FrameUtils.cpp (Frame utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   PCK
+   POOL
+   ROTATION
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (FrameUtils.hpp). The rotation models follow
+   the IAU style evaluation performed by the CSPICE routine tisbod:
+
+      RA  = RA0  + RA1*t/T  + RA2*t**2/T**2  + sum( a(i) sin theta(i) )
+      DEC = DEC0 + DEC1*t/T + DEC2*t**2/T**2 + sum( d(i) cos theta(i) )
+      W   = W0   + W1*t/d   + W2*t**2/d**2   + sum( w(i) sin theta(i) )
+
+   where theta(i) = THETA0(i) + THETA1(i)*t/T, d is the number of seconds
+   in a day, and T is the number of seconds in a Julian century. The
+   rotation is then the 3-1-3 Euler rotation [W]3 [pi/2 - DEC]1 [RA + pi/2]3.
+
+- Literature_References
+
+   CSPICE's documentation for tisbod and the PCK required reading.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, cfloat and cmath for the arithmetic, map
+and vector for the registries, chrono for the benchmark, and the kernel
+utilities so that plans can tell when the loaded kernels have changed.
+*/
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include "FrameUtils.hpp"
+#include "KernelUtils.hpp"
+
+/*
+Time and angle conversion factors used by every evaluation.
+*/
+static const SpiceDouble secondsPerDay     = 86400.0;
+static const SpiceDouble secondsPerCentury = 36525.0 * secondsPerDay;
+static const SpiceDouble radiansPerDegree  = cppspice::PI / 180.0;
+
+/*
+A rotation model compiled from the kernel pool. The nutation and precession
+coefficients are stored as flat arrays of equal length (padded with zeros),
+so that a single loop evaluates all of them.
+*/
+struct RotationModel {
+   SpiceInt                 BodyID;
+   std::string              Agent;
+   SpiceDouble              ReferenceEpoch;
+   SpiceDouble              PoleRA[3];
+   SpiceDouble              PoleDec[3];
+   SpiceDouble              PrimeMeridian[3];
+   std::vector<SpiceDouble> AngleConstants;
+   std::vector<SpiceDouble> AngleRates;
+   std::vector<SpiceDouble> RATerms;
+   std::vector<SpiceDouble> DecTerms;
+   std::vector<SpiceDouble> PMTerms;
+   bool                     Rotated;
+   SpiceDouble              ReferenceRotation[3][3];
+};
+static std::vector<RotationModel> rotationModels;
+
+/*
+This is a helper which builds the name of a body's pool variable.
+*/
+static std::string getBodyVariableName(
+   const SpiceInt     bodyID,
+   const std::string& item ) {
+   return "BODY" + std::to_string( bodyID ) + "_" + item;
+}
+
+/*
+This is a helper which reads up to room values of a numeric pool variable,
+returning the number of values read (zero if the variable doesn't exist).
+*/
+static SpiceInt readPoolValues(
+   const std::string& name,
+   const SpiceInt     room,
+   SpiceDouble*       values ) {
+   SpiceInt     n{ 0 };
+   SpiceBoolean found{ false };
+   gdpool_c( name.c_str(), 0, room, &n, values, &found );
+   return found ? n : 0;
+}
+
+/*
+This is a helper which determines whether any loaded binary PCK contains
+orientation data for a PCK frame class ID. tisbod prefers binary PCK data
+over the text constants, so such frames can't be represented by a model.
+*/
+static bool hasBinaryPCKData( const SpiceInt classID ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      SpiceInt   I   The PCK frame class ID.
+
+   - Detailed_Input
+
+      classID  the frame class ID of a PCK frame, which is the NAIF ID of
+               its body for the IAU frames.
+
+   - Detailed_Output
+
+      Returns true if any segment of a loaded binary PCK is for classID.
+
+   - Error Handling
+
+      Any errors encountered by the CSPICE routines will be handled by the
+   CSPICE error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt count{ 0 };
+   ktotal_c( "PCK", &count );
+   for ( SpiceInt i = 0; i < count; i++ ) {
+      SpiceChar    file[cppspice::FILENAMELEN];
+      SpiceChar    type[cppspice::FILETYPELEN];
+      SpiceChar    source[cppspice::FILENAMELEN];
+      SpiceInt     handle{ 0 };
+      SpiceBoolean found{ false };
+      kdata_c(
+         i,
+         "PCK",
+         cppspice::FILENAMELEN,
+         cppspice::FILETYPELEN,
+         cppspice::FILENAMELEN,
+         file,
+         type,
+         source,
+         &handle,
+         &found );
+      if ( !found ) {
+         continue;
+      }
+
+      dafbfs_c( handle );
+      daffna_c( &found );
+      while ( found ) {
+         SpiceDouble sum[5];
+         SpiceDouble dc[2];
+         SpiceInt    ic[5];
+         dafgs_c( sum );
+         dafus_c( sum, 2, 5, dc, ic );
+         if ( ic[0] == classID ) {
+            return true;
+         }
+         daffna_c( &found );
+      }
+   }
+   return false;
+}
+
+/*
+This is a helper which compiles a rotation model from the current contents
+of the kernel pool.
+*/
+static bool compileRotationModel( RotationModel& model ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct    I/O  The rotation model.
+
+   - Detailed_Input
+
+      model    a RotationModel whose BodyID is set.
+
+   - Detailed_Output
+
+      model    the RotationModel with its coefficients filled in.
+
+      The function returns true if the model was compiled.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The epoch, reference frame, and nutation and precession angles are
+   associated with the system barycenter for planetary systems, exactly as
+   in tisbod.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt body = model.BodyID;
+   SpiceInt systemID{ body };
+   if ( body >= 100 && body <= 999 ) {
+      systemID = body / 100;
+   } else if ( body >= 10000 && body <= 99999 ) {
+      systemID = body / 10000;
+   }
+
+   /*
+   The epoch of the constants is a Julian ephemeris date, defaulting to
+   J2000.
+   */
+   SpiceDouble julianEpoch{ j2000_c() };
+   readPoolValues(
+      getBodyVariableName( systemID, "CONSTANTS_JED_EPOCH" ),
+      1,
+      &julianEpoch );
+   model.ReferenceEpoch = secondsPerDay * ( julianEpoch - j2000_c() );
+
+   /*
+   The constants may be referenced to an inertial frame other than J2000,
+   in which case we need the fixed rotation from J2000 into that frame.
+   */
+   SpiceDouble referenceFrame{ cppspice::J2000CODE };
+   readPoolValues(
+      getBodyVariableName( systemID, "CONSTANTS_REF_FRAME" ),
+      1,
+      &referenceFrame );
+   SpiceInt referenceCode =
+      static_cast<SpiceInt>( std::round( referenceFrame ) );
+   model.Rotated = referenceCode != cppspice::J2000CODE;
+   if ( model.Rotated ) {
+      SpiceChar frameName[cppspice::FRAMELEN];
+      frmnam_c( referenceCode, cppspice::FRAMELEN, frameName );
+      if ( frameName[0] == '\0' ) {
+         std::cout << "Error: the reference frame code " << referenceCode
+                   << " of body " << body << " is not recognized."
+                   << std::endl;
+         return false;
+      }
+      pxform_c( "J2000", frameName, 0.0, model.ReferenceRotation );
+   }
+
+   /*
+   Every model has quadratic polynomials for the pole and prime meridian.
+   */
+   std::fill( model.PoleRA, model.PoleRA + 3, 0.0 );
+   std::fill( model.PoleDec, model.PoleDec + 3, 0.0 );
+   std::fill( model.PrimeMeridian, model.PrimeMeridian + 3, 0.0 );
+   if ( readPoolValues(
+           getBodyVariableName( body, "POLE_RA" ),
+           3,
+           model.PoleRA ) == 0 ||
+        readPoolValues(
+           getBodyVariableName( body, "POLE_DEC" ),
+           3,
+           model.PoleDec ) == 0 ||
+        readPoolValues(
+           getBodyVariableName( body, "PM" ),
+           3,
+           model.PrimeMeridian ) == 0 )
+   {
+      std::cout << "Error: the pole and prime meridian constants of body "
+                << body << " could not be found." << std::endl;
+      return false;
+   }
+
+   /*
+   Satellites may also have nutation and precession terms. The angles are
+   stored as (constant, rate) pairs.
+   */
+   std::vector<SpiceDouble> angles( 2 * cppspice::MAXNUTPREC );
+   SpiceInt                 pairCount =
+      readPoolValues(
+         getBodyVariableName( systemID, "NUT_PREC_ANGLES" ),
+         2 * cppspice::MAXNUTPREC,
+         angles.data() ) /
+      2;
+
+   model.RATerms.assign( cppspice::MAXNUTPREC, 0.0 );
+   model.DecTerms.assign( cppspice::MAXNUTPREC, 0.0 );
+   model.PMTerms.assign( cppspice::MAXNUTPREC, 0.0 );
+   SpiceInt termCount = std::max(
+      { readPoolValues(
+           getBodyVariableName( body, "NUT_PREC_RA" ),
+           cppspice::MAXNUTPREC,
+           model.RATerms.data() ),
+        readPoolValues(
+           getBodyVariableName( body, "NUT_PREC_DEC" ),
+           cppspice::MAXNUTPREC,
+           model.DecTerms.data() ),
+        readPoolValues(
+           getBodyVariableName( body, "NUT_PREC_PM" ),
+           cppspice::MAXNUTPREC,
+           model.PMTerms.data() ) } );
+   if ( termCount > pairCount ) {
+      std::cout << "Error: insufficient number of nutation/precession angles "
+                << "for body " << body << "." << std::endl;
+      return false;
+   }
+
+   /*
+   Only the angles which have terms need to be evaluated.
+   */
+   model.RATerms.resize( termCount );
+   model.DecTerms.resize( termCount );
+   model.PMTerms.resize( termCount );
+   model.AngleConstants.resize( termCount );
+   model.AngleRates.resize( termCount );
+   for ( SpiceInt i = 0; i < termCount; i++ ) {
+      model.AngleConstants[i] = angles[2 * i];
+      model.AngleRates[i]     = angles[2 * i + 1];
+   }
+
+   return true;
+}
+
+/*
+This is a helper which evaluates a rotation model, and optionally the
+derivative of its rotation.
+*/
+static bool evaluateRotationModel(
+   const cppspice::RotationModelHandle handle,
+   const SpiceDouble                   epoch,
+   SpiceDouble                         rotate[3][3],
+   SpiceDouble                         ( *derivative )[3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the rotation model.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The rotation from J2000 to the model's frame.
+      SpiceDouble   O   The time derivative of the rotation, or nullptr.
+
+   - Detailed_Input
+
+      handle      a handle returned by getRotationModel.
+      epoch       the epoch at which to evaluate the model.
+
+   - Detailed_Output
+
+      rotate      the rotation from J2000 to the model's frame.
+      derivative  if not nullptr, the time derivative of rotate.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The only pool access in the common case is the cvpool_c check on the
+   model's watcher agent.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( handle < 0 ||
+        handle >= static_cast<cppspice::RotationModelHandle>(
+                     rotationModels.size() ) )
+   {
+      std::cout << "Error: the rotation model handle " << handle
+                << " is not valid." << std::endl;
+      return false;
+   }
+
+   /*
+   Recompile the model if any of its constants have changed.
+   */
+   auto&        model = rotationModels[handle];
+   SpiceBoolean update{ false };
+   cvpool_c( model.Agent.c_str(), &update );
+   if ( update && !compileRotationModel( model ) ) {
+      return false;
+   }
+
+   /*
+   Evaluate the polynomials and their derivatives.
+   */
+   SpiceDouble t         = epoch - model.ReferenceEpoch;
+   SpiceDouble centuries = t / secondsPerCentury;
+   SpiceDouble days      = t / secondsPerDay;
+   const auto& a         = model.PoleRA;
+   const auto& d         = model.PoleDec;
+   const auto& p         = model.PrimeMeridian;
+
+   SpiceDouble ra  = a[0] + centuries * ( a[1] + centuries * a[2] );
+   SpiceDouble dec = d[0] + centuries * ( d[1] + centuries * d[2] );
+   SpiceDouble w   = p[0] + days * ( p[1] + days * p[2] );
+
+   SpiceDouble raRate  = ( a[1] + centuries * 2.0 * a[2] ) /
+                         secondsPerCentury;
+   SpiceDouble decRate = ( d[1] + centuries * 2.0 * d[2] ) /
+                         secondsPerCentury;
+   SpiceDouble wRate   = ( p[1] + days * 2.0 * p[2] ) / secondsPerDay;
+
+   /*
+   Accumulate the nutation and precession terms.
+   */
+   SpiceDouble raSum{ 0.0 };
+   SpiceDouble decSum{ 0.0 };
+   SpiceDouble wSum{ 0.0 };
+   SpiceDouble raRateSum{ 0.0 };
+   SpiceDouble decRateSum{ 0.0 };
+   SpiceDouble wRateSum{ 0.0 };
+   for ( size_t i = 0; i < model.AngleConstants.size(); i++ ) {
+      SpiceDouble theta =
+         ( model.AngleConstants[i] + centuries * model.AngleRates[i] ) *
+         radiansPerDegree;
+      SpiceDouble thetaRate =
+         model.AngleRates[i] / secondsPerCentury * radiansPerDegree;
+      SpiceDouble sine   = std::sin( theta );
+      SpiceDouble cosine = std::cos( theta );
+      raSum += model.RATerms[i] * sine;
+      decSum += model.DecTerms[i] * cosine;
+      wSum += model.PMTerms[i] * sine;
+      raRateSum += model.RATerms[i] * cosine * thetaRate;
+      decRateSum += model.DecTerms[i] * -sine * thetaRate;
+      wRateSum += model.PMTerms[i] * cosine * thetaRate;
+   }
+   ra      = ( ra + raSum ) * radiansPerDegree;
+   dec     = ( dec + decSum ) * radiansPerDegree;
+   w       = ( w + wSum ) * radiansPerDegree;
+   raRate  = ( raRate + raRateSum ) * radiansPerDegree;
+   decRate = ( decRate + decRateSum ) * radiansPerDegree;
+   wRate   = ( wRate + wRateSum ) * radiansPerDegree;
+
+   /*
+   Convert to the 3-1-3 Euler angles and build the rotation. The prime
+   meridian is reduced the same way as the f2c d_mod used by tisbod, rather
+   than with std::fmod, so that the large angles of fast rotators round
+   identically.
+   */
+   w -= 2.0 * cppspice::PI * std::trunc( w / ( 2.0 * cppspice::PI ) );
+   SpiceDouble phi   = ra + cppspice::PI / 2.0;
+   SpiceDouble delta = cppspice::PI / 2.0 - dec;
+   SpiceDouble sw    = std::sin( w );
+   SpiceDouble cw    = std::cos( w );
+   SpiceDouble sd    = std::sin( delta );
+   SpiceDouble cd    = std::cos( delta );
+   SpiceDouble sp    = std::sin( phi );
+   SpiceDouble cp    = std::cos( phi );
+
+   SpiceDouble m[3][3] = {
+      { cw * cp - sw * cd * sp, cw * sp + sw * cd * cp, sw * sd },
+      { -sw * cp - cw * cd * sp, -sw * sp + cw * cd * cp, cw * sd },
+      { sd * sp, -sd * cp, cd } };
+
+   /*
+   The derivative follows from the partials of m with respect to each of
+   the Euler angles.
+   */
+   SpiceDouble dm[3][3];
+   if ( derivative != nullptr ) {
+      SpiceDouble deltaRate          = -decRate;
+      SpiceDouble phiRate            = raRate;
+      SpiceDouble partialDelta[3][3] = {
+         { sw * sd * sp, -sw * sd * cp, sw * cd },
+         { cw * sd * sp, -cw * sd * cp, cw * cd },
+         { cd * sp, -cd * cp, -sd } };
+      for ( int i = 0; i < 3; i++ ) {
+         for ( int j = 0; j < 3; j++ ) {
+            SpiceDouble partialW =
+               i == 0 ? m[1][j] : ( i == 1 ? -m[0][j] : 0.0 );
+            SpiceDouble partialPhi =
+               j == 0 ? -m[i][1] : ( j == 1 ? m[i][0] : 0.0 );
+            dm[i][j] = partialW * wRate + partialDelta[i][j] * deltaRate +
+                       partialPhi * phiRate;
+         }
+      }
+   }
+
+   /*
+   Finally, account for constants which aren't referenced to J2000.
+   */
+   if ( model.Rotated ) {
+      mxm_c( m, model.ReferenceRotation, rotate );
+      if ( derivative != nullptr ) {
+         mxm_c( dm, model.ReferenceRotation, derivative );
+      }
+   } else {
+      std::copy( &m[0][0], &m[0][0] + 9, &rotate[0][0] );
+      if ( derivative != nullptr ) {
+         std::copy( &dm[0][0], &dm[0][0] + 9, &derivative[0][0] );
+      }
+   }
+   return true;
+}
+
+/*
+This function resolves a frame name to a compiled rotation model.
+*/
+cppspice::RotationModelHandle cppspice::getRotationModel(
+   const std::string& frameName ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the frame.
+
+   - Detailed_Input
+
+      frameName   the name of a body-fixed frame, e.g. "IAU_MOON".
+
+   - Detailed_Output
+
+      Returns a handle which can be used with getModelRotation and
+   getModelStateTransform, or -1 if the frame is not a PCK frame whose
+   orientation comes from the text kernel pool. Resolving the same frame
+   twice returns the same handle.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Particulars
+
+      Each model registers its own watcher agent with swpool_c for all of
+   the constants it is compiled from, so it is recompiled whenever any of
+   them are added, changed, or deleted. Binary PCKs are only checked when
+   the frame is resolved, so they should be loaded before this is called.
+
+   - Literature_References
+
+      CSPICE's documentation for frinfo_c and swpool_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt frameID{ 0 };
+   namfrm_c( frameName.c_str(), &frameID );
+   if ( frameID == 0 ) {
+      return -1;
+   }
+
+   SpiceInt     center{ 0 };
+   SpiceInt     frameClass{ 0 };
+   SpiceInt     classID{ 0 };
+   SpiceBoolean found{ false };
+   frinfo_c( frameID, &center, &frameClass, &classID, &found );
+   if ( !found || frameClass != PCKCLASS || hasBinaryPCKData( classID ) ) {
+      return -1;
+   }
+
+   for ( size_t i = 0; i < rotationModels.size(); i++ ) {
+      if ( rotationModels[i].BodyID == classID ) {
+         return static_cast<RotationModelHandle>( i );
+      }
+   }
+
+   RotationModel model;
+   model.BodyID = classID;
+   model.Agent =
+      ROTATIONAGENTPREFIX + std::to_string( rotationModels.size() );
+
+   /*
+   Watch everything the model is compiled from. swpool_c flags the agent as
+   needing an update, so the model will be compiled on the first evaluation.
+   */
+   SpiceInt systemID{ classID };
+   if ( classID >= 100 && classID <= 999 ) {
+      systemID = classID / 100;
+   } else if ( classID >= 10000 && classID <= 99999 ) {
+      systemID = classID / 10000;
+   }
+   std::vector<std::string> names = {
+      getBodyVariableName( systemID, "CONSTANTS_JED_EPOCH" ),
+      getBodyVariableName( systemID, "CONSTANTS_REF_FRAME" ),
+      getBodyVariableName( systemID, "NUT_PREC_ANGLES" ),
+      getBodyVariableName( classID, "POLE_RA" ),
+      getBodyVariableName( classID, "POLE_DEC" ),
+      getBodyVariableName( classID, "PM" ),
+      getBodyVariableName( classID, "NUT_PREC_RA" ),
+      getBodyVariableName( classID, "NUT_PREC_DEC" ),
+      getBodyVariableName( classID, "NUT_PREC_PM" ) };
+   std::vector<SpiceChar> watched( names.size() * POOLNAMELEN, '\0' );
+   for ( size_t i = 0; i < names.size(); i++ ) {
+      names[i].copy( &watched[i * POOLNAMELEN], POOLNAMELEN - 1 );
+   }
+   swpool_c(
+      model.Agent.c_str(),
+      static_cast<SpiceInt>( names.size() ),
+      POOLNAMELEN,
+      watched.data() );
+
+   rotationModels.push_back( model );
+   return static_cast<RotationModelHandle>( rotationModels.size() - 1 );
+}
+
+/*
+This function evaluates the rotation from J2000 to the model's frame at the
+given epoch.
+*/
+bool cppspice::getModelRotation(
+   const RotationModelHandle handle,
+   const SpiceDouble         epoch,
+   SpiceDouble               rotate[3][3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the rotation model.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The rotation from J2000 to the model's frame.
+
+   - Detailed_Input
+
+      handle   a handle returned by getRotationModel.
+      epoch    the epoch at which to evaluate the model.
+
+   - Detailed_Output
+
+      rotate   the rotation matrix, as would be returned by
+   pxform_c( "J2000", frame, epoch, rotate ).
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   return evaluateRotationModel( handle, epoch, rotate, nullptr );
+}
+
+/*
+This function evaluates the state transformation from J2000 to the model's
+frame at the given epoch.
+*/
+bool cppspice::getModelStateTransform(
+   const RotationModelHandle handle,
+   const SpiceDouble         epoch,
+   SpiceDouble               xform[6][6] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the rotation model.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The state transformation from J2000.
+
+   - Detailed_Input
+
+      handle   a handle returned by getRotationModel.
+      epoch    the epoch at which to evaluate the model.
+
+   - Detailed_Output
+
+      xform    the state transformation matrix, as would be returned by
+   sxform_c( "J2000", frame, epoch, xform ).
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble rotate[3][3];
+   SpiceDouble derivative[3][3];
+   if ( !evaluateRotationModel( handle, epoch, rotate, derivative ) ) {
+      return false;
+   }
+
+   for ( int i = 0; i < 3; i++ ) {
+      for ( int j = 0; j < 3; j++ ) {
+         xform[i][j]         = rotate[i][j];
+         xform[i][j + 3]     = 0.0;
+         xform[i + 3][j]     = derivative[i][j];
+         xform[i + 3][j + 3] = rotate[i][j];
+      }
+   }
+   return true;
+}
+/*
+The base of a frame in a frame plan. Every frame is reduced to a constant
+rotation applied on top of one of these.
+*/
+enum class FrameBase : int {
+   INERTIAL,
+   MODEL,
+   GENERIC
+};
+
+/*
+The rotation from J2000 to a frame, expressed as Fixed * (rotation from
+J2000 to the base frame).
+*/
+struct FrameLink {
+   FrameBase                     Base;
+   cppspice::RotationModelHandle Model;
+   SpiceInt                      BaseFrameID;
+   std::string                   BaseFrame;
+   SpiceDouble                   Fixed[3][3];
+};
+
+/*
+A resolved plan for transforming from one frame to another. If both frames
+share a base, the transformation doesn't depend on time at all.
+*/
+struct FramePlan {
+   std::string From;
+   std::string To;
+   long long   Generation;
+   FrameLink   FromLink;
+   FrameLink   ToLink;
+   bool        Constant;
+   SpiceDouble ConstantRotation[3][3];
+};
+static std::vector<FramePlan> framePlans;
+using FramePairKey = std::pair<std::string, std::string>;
+static std::map<FramePairKey, cppspice::FramePlanHandle> framePlanIndex;
+
+/*
+This is a helper which normalizes a frame name the way the CSPICE frame
+routines do, by ignoring case and surrounding whitespace.
+*/
+static std::string normalizeFrameName( const std::string& frameName ) {
+   size_t first = frameName.find_first_not_of( " \t" );
+   size_t last  = frameName.find_last_not_of( " \t" );
+   if ( first == std::string::npos ) {
+      return "";
+   }
+   std::string name = frameName.substr( first, last - first + 1 );
+   std::transform( name.begin(), name.end(), name.begin(), ::toupper );
+   return name;
+}
+
+/*
+This is a helper which reduces the rotation from J2000 to a frame to a
+constant rotation on top of a base.
+*/
+static bool resolveFrameLink(
+   const std::string& frameName,
+   FrameLink&         link ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the frame.
+      struct     O   The resolved link.
+
+   - Detailed_Input
+
+      frameName   the name of the frame.
+
+   - Detailed_Output
+
+      link        the FrameLink for the frame.
+
+      The function returns true if the frame could be resolved.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Inertial frames are folded into the constant rotation. TK frames are
+   followed to their relative frame, accumulating their constant offsets. A
+   PCK frame becomes a rotation model base when one is available, and any
+   other frame becomes a generic base which is evaluated through CSPICE.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ident_c( link.Fixed );
+   std::string current = frameName;
+   for ( SpiceInt depth = 0; depth < cppspice::CHAINLIMIT; depth++ ) {
+      SpiceInt frameID{ 0 };
+      namfrm_c( current.c_str(), &frameID );
+      if ( frameID == 0 ) {
+         std::cout << "Error: the frame '" << current
+                   << "' is not recognized." << std::endl;
+         return false;
+      }
+
+      SpiceInt     center{ 0 };
+      SpiceInt     frameClass{ 0 };
+      SpiceInt     classID{ 0 };
+      SpiceBoolean found{ false };
+      frinfo_c( frameID, &center, &frameClass, &classID, &found );
+      link.Base        = FrameBase::GENERIC;
+      link.Model       = -1;
+      link.BaseFrameID = frameID;
+      link.BaseFrame   = current;
+      if ( !found ) {
+         return true;
+      }
+
+      if ( frameClass == cppspice::INERTIALCLASS ) {
+         SpiceDouble rotate[3][3];
+         pxform_c( "J2000", current.c_str(), 0.0, rotate );
+         mxm_c( link.Fixed, rotate, link.Fixed );
+         link.Base = FrameBase::INERTIAL;
+         return true;
+      }
+
+      if ( frameClass == cppspice::PCKCLASS ) {
+         link.Model = cppspice::getRotationModel( current );
+         if ( link.Model >= 0 ) {
+            link.Base = FrameBase::MODEL;
+         }
+         return true;
+      }
+
+      if ( frameClass != cppspice::TKCLASS ) {
+         return true;
+      }
+
+      /*
+      A TK frame is a constant offset from its relative frame, which may be
+      keyed by either the frame's ID or its name.
+      */
+      SpiceChar relative[cppspice::FRAMELEN];
+      SpiceChar name[cppspice::FRAMELEN];
+      SpiceInt  n{ 0 };
+      frmnam_c( frameID, cppspice::FRAMELEN, name );
+      gcpool_c(
+         ( "TKFRAME_" + std::to_string( frameID ) + "_RELATIVE" ).c_str(),
+         0,
+         1,
+         cppspice::FRAMELEN,
+         &n,
+         relative,
+         &found );
+      if ( !found ) {
+         gcpool_c(
+            ( "TKFRAME_" + std::string( name ) + "_RELATIVE" ).c_str(),
+            0,
+            1,
+            cppspice::FRAMELEN,
+            &n,
+            relative,
+            &found );
+      }
+      if ( !found ) {
+         return true;
+      }
+
+      SpiceDouble offset[3][3];
+      pxform_c( relative, current.c_str(), 0.0, offset );
+      mxm_c( link.Fixed, offset, link.Fixed );
+      current = relative;
+   }
+
+   std::cout << "Error: the frame chain of '" << frameName
+             << "' exceeds the chain limit." << std::endl;
+   return false;
+}
+
+/*
+This is a helper which evaluates the rotation from J2000 to a resolved
+frame, and optionally its derivative.
+*/
+static bool evaluateFrameLink(
+   const FrameLink&  link,
+   const SpiceDouble epoch,
+   SpiceDouble       rotate[3][3],
+   SpiceDouble       ( *derivative )[3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        I   The resolved link.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The rotation from J2000 to the frame.
+      SpiceDouble   O   The time derivative of the rotation, or nullptr.
+
+   - Detailed_Output
+
+      rotate      the rotation from J2000 to the frame.
+      derivative  if not nullptr, the time derivative of rotate.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble base[3][3];
+   SpiceDouble baseRate[3][3] = {};
+   if ( link.Base == FrameBase::INERTIAL ) {
+      ident_c( base );
+   }
+   else if ( link.Base == FrameBase::MODEL ) {
+      if ( !evaluateRotationModel(
+              link.Model,
+              epoch,
+              base,
+              derivative != nullptr ? baseRate : nullptr ) )
+      {
+         return false;
+      }
+   }
+   else if ( derivative != nullptr ) {
+      SpiceDouble xform[6][6];
+      sxform_c( "J2000", link.BaseFrame.c_str(), epoch, xform );
+      for ( int i = 0; i < 3; i++ ) {
+         for ( int j = 0; j < 3; j++ ) {
+            base[i][j]     = xform[i][j];
+            baseRate[i][j] = xform[i + 3][j];
+         }
+      }
+   }
+   else {
+      pxform_c( "J2000", link.BaseFrame.c_str(), epoch, base );
+   }
+
+   mxm_c( link.Fixed, base, rotate );
+   if ( derivative != nullptr ) {
+      mxm_c( link.Fixed, baseRate, derivative );
+   }
+   return true;
+}
+
+/*
+This is a helper which resolves both frames of a plan against the currently
+loaded kernels.
+*/
+static bool buildFramePlan( FramePlan& plan ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct    I/O  The frame plan.
+
+   - Detailed_Input
+
+      plan     a FramePlan whose From and To frames are set.
+
+   - Detailed_Output
+
+      plan     the FramePlan with both of its links resolved.
+
+      The function returns true if both frames could be resolved.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( !resolveFrameLink( plan.From, plan.FromLink ) ||
+        !resolveFrameLink( plan.To, plan.ToLink ) )
+   {
+      return false;
+   }
+   plan.Generation = cppspice::getKernelGeneration();
+
+   /*
+   If both frames sit on the same base, the base cancels out.
+   */
+   const FrameLink& from = plan.FromLink;
+   const FrameLink& to   = plan.ToLink;
+   plan.Constant =
+      from.Base == to.Base && ( from.Base == FrameBase::INERTIAL ||
+                                from.BaseFrameID == to.BaseFrameID );
+   if ( plan.Constant ) {
+      mxmt_c( to.Fixed, from.Fixed, plan.ConstantRotation );
+   }
+   return true;
+}
+
+/*
+This is a helper which evaluates a frame plan, and optionally the derivative
+of its rotation.
+*/
+static bool evaluateFramePlan(
+   const cppspice::FramePlanHandle handle,
+   const SpiceDouble               epoch,
+   SpiceDouble                     rotate[3][3],
+   SpiceDouble                     ( *derivative )[3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the frame plan.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The rotation between the plan's frames.
+      SpiceDouble   O   The time derivative of the rotation, or nullptr.
+
+   - Detailed_Input
+
+      handle      a handle returned by getFramePlan.
+      epoch       the epoch at which to evaluate the plan.
+
+   - Detailed_Output
+
+      rotate      the rotation from the plan's "from" frame to its "to"
+                  frame.
+      derivative  if not nullptr, the time derivative of rotate.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The plan is rebuilt first if kernels have been loaded or unloaded
+   since it was resolved.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( handle < 0 ||
+        handle >=
+           static_cast<cppspice::FramePlanHandle>( framePlans.size() ) )
+   {
+      std::cout << "Error: the frame plan handle " << handle
+                << " is not valid." << std::endl;
+      return false;
+   }
+
+   auto& plan = framePlans[handle];
+   if ( plan.Generation != cppspice::getKernelGeneration() &&
+        !buildFramePlan( plan ) )
+   {
+      return false;
+   }
+
+   if ( plan.Constant ) {
+      std::copy(
+         &plan.ConstantRotation[0][0],
+         &plan.ConstantRotation[0][0] + 9,
+         &rotate[0][0] );
+      if ( derivative != nullptr ) {
+         std::fill( &derivative[0][0], &derivative[0][0] + 9, 0.0 );
+      }
+      return true;
+   }
+
+   /*
+   Go from the "from" frame back to J2000, and then out to the "to" frame.
+   */
+   SpiceDouble fromRotation[3][3];
+   SpiceDouble fromRate[3][3];
+   SpiceDouble toRotation[3][3];
+   SpiceDouble toRate[3][3];
+   bool        rates = derivative != nullptr;
+   if ( !evaluateFrameLink(
+           plan.FromLink,
+           epoch,
+           fromRotation,
+           rates ? fromRate : nullptr ) ||
+        !evaluateFrameLink(
+           plan.ToLink,
+           epoch,
+           toRotation,
+           rates ? toRate : nullptr ) )
+   {
+      return false;
+   }
+
+   mxmt_c( toRotation, fromRotation, rotate );
+   if ( rates ) {
+      SpiceDouble first[3][3];
+      SpiceDouble second[3][3];
+      mxmt_c( toRate, fromRotation, first );
+      mxmt_c( toRotation, fromRate, second );
+      for ( int i = 0; i < 3; i++ ) {
+         for ( int j = 0; j < 3; j++ ) {
+            derivative[i][j] = first[i][j] + second[i][j];
+         }
+      }
+   }
+   return true;
+}
+
+/*
+This function resolves the chain between two frames to a plan.
+*/
+cppspice::FramePlanHandle cppspice::getFramePlan(
+   const std::string& fromFrame,
+   const std::string& toFrame ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the frame to transform from.
+      string     I   The name of the frame to transform to.
+
+   - Detailed_Input
+
+      fromFrame   the name of the frame to transform from.
+      toFrame     the name of the frame to transform to.
+
+   - Detailed_Output
+
+      Returns a handle which can be used with getPlanRotation and
+   getPlanStateTransform, or -1 if either frame can't be resolved. Frame
+   names are matched without regard to case or surrounding whitespace, and
+   resolving the same pair twice returns the same handle.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and -1 is returned.
+
+   - Particulars
+
+      Unlike pxform_c, which only remembers the most recent pair of frames,
+   a plan is kept for every pair that has been resolved.
+
+   - Literature_References
+
+      CSPICE's documentation for pxform_c, sxform_c, and frinfo_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      Plans are only rebuilt when kernels are loaded or unloaded through
+   furnishKernel and unloadKernel, or when a pool snapshot is restored.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   auto key = std::make_pair(
+      normalizeFrameName( fromFrame ),
+      normalizeFrameName( toFrame ) );
+   auto existing = framePlanIndex.find( key );
+   if ( existing != framePlanIndex.end() ) {
+      return existing->second;
+   }
+
+   FramePlan plan;
+   plan.From = key.first;
+   plan.To   = key.second;
+   if ( !buildFramePlan( plan ) ) {
+      return -1;
+   }
+
+   framePlans.push_back( plan );
+   auto handle = static_cast<FramePlanHandle>( framePlans.size() - 1 );
+   framePlanIndex[key] = handle;
+   return handle;
+}
+
+/*
+This function evaluates the rotation from the plan's "from" frame to its
+"to" frame at the given epoch.
+*/
+bool cppspice::getPlanRotation(
+   const FramePlanHandle handle,
+   const SpiceDouble     epoch,
+   SpiceDouble           rotate[3][3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the frame plan.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The rotation between the plan's frames.
+
+   - Detailed_Output
+
+      rotate   the rotation matrix, as would be returned by
+   pxform_c( from, to, epoch, rotate ).
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   return evaluateFramePlan( handle, epoch, rotate, nullptr );
+}
+
+/*
+This function evaluates the state transformation from the plan's "from"
+frame to its "to" frame at the given epoch.
+*/
+bool cppspice::getPlanStateTransform(
+   const FramePlanHandle handle,
+   const SpiceDouble     epoch,
+   SpiceDouble           xform[6][6] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the frame plan.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The state transformation between the plan's frames.
+
+   - Detailed_Output
+
+      xform    the state transformation matrix, as would be returned by
+   sxform_c( from, to, epoch, xform ).
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble rotate[3][3];
+   SpiceDouble derivative[3][3];
+   if ( !evaluateFramePlan( handle, epoch, rotate, derivative ) ) {
+      return false;
+   }
+
+   for ( int i = 0; i < 3; i++ ) {
+      for ( int j = 0; j < 3; j++ ) {
+         xform[i][j]         = rotate[i][j];
+         xform[i][j + 3]     = 0.0;
+         xform[i + 3][j]     = derivative[i][j];
+         xform[i + 3][j + 3] = rotate[i][j];
+      }
+   }
+   return true;
+}
+
+/*
+This is a drop-in replacement for pxform_c which keeps a plan for every pair
+of frames it has been called with.
+*/
+bool cppspice::getFrameRotation(
+   const std::string& fromFrame,
+   const std::string& toFrame,
+   const SpiceDouble  epoch,
+   SpiceDouble        rotate[3][3] ) {
+   FramePlanHandle handle = getFramePlan( fromFrame, toFrame );
+   return handle >= 0 && getPlanRotation( handle, epoch, rotate );
+}
+
+/*
+This is a drop-in replacement for sxform_c which keeps a plan for every pair
+of frames it has been called with.
+*/
+bool cppspice::getFrameStateTransform(
+   const std::string& fromFrame,
+   const std::string& toFrame,
+   const SpiceDouble  epoch,
+   SpiceDouble        xform[6][6] ) {
+   FramePlanHandle handle = getFramePlan( fromFrame, toFrame );
+   return handle >= 0 && getPlanStateTransform( handle, epoch, xform );
+}
+
+/*
+A rotation which has already been evaluated for a frame plan.
+*/
+struct MemoEntry {
+   cppspice::FramePlanHandle Handle;
+   long long                 Generation;
+   SpiceDouble               Epoch;
+   SpiceDouble               Rotation[3][3];
+};
+
+/*
+A full evaluation of a frame plan, along with its angular velocity, which
+is used to approximate the rotation at nearby epochs. Window is the largest
+offset from Epoch over which the approximation meets the error bound.
+*/
+struct QuasiStaticAnchor {
+   cppspice::FramePlanHandle Handle;
+   long long                 Generation;
+   SpiceDouble               Epoch;
+   SpiceDouble               Rotation[3][3];
+   SpiceDouble               Axis[3];
+   SpiceDouble               Rate;
+   SpiceDouble               Window;
+};
+
+/*
+The memo itself, which is kept per thread so that no locking is required.
+The entries are replaced round-robin.
+*/
+struct RotationMemo {
+   MemoEntry                      Entries[cppspice::MEMOSIZE];
+   size_t                         Count;
+   size_t                         Next;
+   std::vector<QuasiStaticAnchor> Anchors;
+};
+static thread_local RotationMemo rotationMemo{};
+static SpiceDouble               quasiStaticBound{ 0.0 };
+
+/*
+This is a helper which rotates a matrix about a unit axis by an angle,
+returning exp( angle * K ) * rotation, where K is the cross product matrix
+of the axis. This is Rodrigues' formula.
+*/
+static void rotateAboutAxis(
+   const SpiceDouble axis[3],
+   const SpiceDouble angle,
+   SpiceDouble       rotation[3][3],
+   SpiceDouble       result[3][3] ) {
+   SpiceDouble k[3][3] = {
+      { 0.0, -axis[2], axis[1] },
+      { axis[2], 0.0, -axis[0] },
+      { -axis[1], axis[0], 0.0 } };
+   SpiceDouble kk[3][3];
+   mxm_c( k, k, kk );
+
+   SpiceDouble s = std::sin( angle );
+   SpiceDouble c = 1.0 - std::cos( angle );
+   SpiceDouble step[3][3];
+   for ( int i = 0; i < 3; i++ ) {
+      for ( int j = 0; j < 3; j++ ) {
+         step[i][j] = ( i == j ? 1.0 : 0.0 ) + s * k[i][j] + c * kk[i][j];
+      }
+   }
+   mxm_c( step, rotation, result );
+}
+
+/*
+This is a helper which measures the angle between two rotations. For the
+small angles we're interested in, the skew part of a * b^T is accurate where
+the trace is not.
+*/
+static SpiceDouble rotationDifference(
+   SpiceDouble a[3][3],
+   SpiceDouble b[3][3] ) {
+   SpiceDouble e[3][3];
+   mxmt_c( a, b, e );
+   SpiceDouble skew[3] = {
+      e[2][1] - e[1][2],
+      e[0][2] - e[2][0],
+      e[1][0] - e[0][1] };
+   return std::asin( std::min( 1.0, 0.5 * vnorm_c( skew ) ) );
+}
+
+/*
+This is a helper which evaluates a frame plan in full at an epoch, and
+records an anchor from which nearby epochs can be approximated.
+*/
+static bool buildQuasiStaticAnchor(
+   const cppspice::FramePlanHandle handle,
+   const SpiceDouble               epoch,
+   QuasiStaticAnchor&              anchor ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the frame plan.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      struct        O   The anchor.
+
+   - Detailed_Output
+
+      anchor   a QuasiStaticAnchor holding the exact rotation at epoch.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The angular velocity is taken from the skew-symmetric matrix
+   dR * R^T. The window is found by comparing the approximation against a
+   full evaluation QUASISTATICWINDOW seconds away: the error grows with the
+   square of the offset, so if it is too large the window is shrunk to the
+   offset at which the error would be a quarter of the bound, and checked
+   once more. If the bound still isn't met, the window is zero.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble xform[6][6];
+   if ( !cppspice::getPlanStateTransform( handle, epoch, xform ) ) {
+      return false;
+   }
+
+   SpiceDouble derivative[3][3];
+   for ( int i = 0; i < 3; i++ ) {
+      for ( int j = 0; j < 3; j++ ) {
+         anchor.Rotation[i][j] = xform[i][j];
+         derivative[i][j]      = xform[i + 3][j];
+      }
+   }
+   SpiceDouble omega[3][3];
+   mxmt_c( derivative, anchor.Rotation, omega );
+   SpiceDouble velocity[3] = { omega[2][1], omega[0][2], omega[1][0] };
+
+   anchor.Handle     = handle;
+   anchor.Generation = cppspice::getKernelGeneration();
+   anchor.Epoch      = epoch;
+   anchor.Rate       = vnorm_c( velocity );
+   if ( anchor.Rate > 0.0 ) {
+      vhat_c( velocity, anchor.Axis );
+   }
+   else {
+      vpack_c( 0.0, 0.0, 1.0, anchor.Axis );
+   }
+
+   /*
+   The full evaluations themselves are only accurate to roughly the rounding
+   error of the accumulated rotation angle, which for a fast rotator (the
+   prime meridian of Saturn is ~2e5 radians in 2030) can exceed the bound.
+   Both the anchor and the result being compared against carry that error,
+   so only what's left of the bound is available to the approximation. If
+   nothing is left, the window is zero and every epoch is evaluated in full.
+   */
+   SpiceDouble rounding =
+      4.0 * DBL_EPSILON * ( anchor.Rate * std::abs( epoch ) + 1.0 );
+   SpiceDouble budget = quasiStaticBound - 2.0 * rounding;
+   anchor.Window      = 0.0;
+   if ( budget <= 0.0 ) {
+      return true;
+   }
+
+   /*
+   Check the approximation one window away. If the error is too large, the
+   window is shrunk and checked once more.
+   */
+   SpiceDouble trial = cppspice::QUASISTATICWINDOW;
+   for ( int attempt = 0; attempt < 2; attempt++ ) {
+      SpiceDouble exact[3][3];
+      SpiceDouble approximate[3][3];
+      if ( !cppspice::getPlanRotation( handle, epoch + trial, exact ) ) {
+         return false;
+      }
+      rotateAboutAxis(
+         anchor.Axis,
+         anchor.Rate * trial,
+         anchor.Rotation,
+         approximate );
+      SpiceDouble error =
+         std::max( rotationDifference( approximate, exact ) - rounding, 0.0 );
+      if ( error <= budget ) {
+         anchor.Window = trial;
+         return true;
+      }
+      trial *= 0.5 * std::sqrt( budget / error );
+   }
+   return true;
+}
+
+/*
+This function enables the quasi-static rotation mode of the rotation memo.
+*/
+void cppspice::setQuasiStaticRotation( const SpiceDouble errorBound ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble   I   The error bound, in radians.
+
+   - Detailed_Input
+
+      errorBound  the largest angular error which an approximated rotation
+                  may have. Zero (or less) disables the quasi-static mode.
+
+   - Detailed_Output
+
+      None.
+
+   - Restrictions
+
+      The bound is shared by all threads, so it should be set before any
+   are started.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   quasiStaticBound = std::max( errorBound, 0.0 );
+   rotationMemo.Anchors.clear();
+}
+
+/*
+This function evaluates a frame plan's rotation through the per-thread
+rotation memo.
+*/
+bool cppspice::getMemoRotation(
+   const FramePlanHandle handle,
+   const SpiceDouble     epoch,
+   SpiceDouble           rotate[3][3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the frame plan.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The rotation between the plan's frames.
+
+   - Detailed_Input
+
+      handle   a handle returned by getFramePlan.
+      epoch    the epoch at which to evaluate the plan.
+
+   - Detailed_Output
+
+      rotate   the rotation matrix. This is exactly what getPlanRotation
+   would return, unless the quasi-static mode is enabled, in which case it is
+   within the error bound of it.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Entries are only reused while the kernel generation is unchanged.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   auto&     memo       = rotationMemo;
+   long long generation = getKernelGeneration();
+   for ( size_t i = 0; i < memo.Count; i++ ) {
+      const auto& entry = memo.Entries[i];
+      if ( entry.Handle == handle && entry.Epoch == epoch &&
+           entry.Generation == generation )
+      {
+         std::copy(
+            &entry.Rotation[0][0],
+            &entry.Rotation[0][0] + 9,
+            &rotate[0][0] );
+         return true;
+      }
+   }
+
+   if ( quasiStaticBound > 0.0 ) {
+      /*
+      Use this plan's anchor if the epoch is within its window, and
+      otherwise replace the anchor with a full evaluation at this epoch.
+      */
+      QuasiStaticAnchor* anchor{ nullptr };
+      for ( auto& candidate : memo.Anchors ) {
+         if ( candidate.Handle == handle ) {
+            anchor = &candidate;
+            break;
+         }
+      }
+      if ( anchor == nullptr ) {
+         memo.Anchors.push_back( QuasiStaticAnchor{} );
+         anchor             = &memo.Anchors.back();
+         anchor->Generation = generation - 1;
+      }
+
+      SpiceDouble offset = epoch - anchor->Epoch;
+      if ( anchor->Generation == generation &&
+           std::abs( offset ) <= anchor->Window )
+      {
+         rotateAboutAxis(
+            anchor->Axis,
+            anchor->Rate * offset,
+            anchor->Rotation,
+            rotate );
+      }
+      else {
+         if ( !buildQuasiStaticAnchor( handle, epoch, *anchor ) ) {
+            return false;
+         }
+         std::copy(
+            &anchor->Rotation[0][0],
+            &anchor->Rotation[0][0] + 9,
+            &rotate[0][0] );
+      }
+   }
+   else if ( !getPlanRotation( handle, epoch, rotate ) ) {
+      return false;
+   }
+
+   /*
+   Remember the result, replacing the oldest entry once the memo is full.
+   */
+   auto& entry      = memo.Entries[memo.Next];
+   entry.Handle     = handle;
+   entry.Generation = generation;
+   entry.Epoch      = epoch;
+   std::copy( &rotate[0][0], &rotate[0][0] + 9, &entry.Rotation[0][0] );
+   memo.Next  = ( memo.Next + 1 ) % MEMOSIZE;
+   memo.Count = std::max( memo.Count, memo.Next == 0 ? MEMOSIZE : memo.Next );
+   return true;
+}
+
+/*
+This function compares the memoized rotations of a frame plan against
+pxform_c over a span.
+*/
+bool cppspice::validateMemoRotation(
+   const FramePlanHandle handle,
+   const SpiceDouble     lowerEpoch,
+   const SpiceDouble     upperEpoch,
+   const SpiceInt        samples ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The handle of the frame plan.
+      SpiceDouble   I   The start of the span.
+      SpiceDouble   I   The end of the span.
+      SpiceInt      I   The number of sample epochs.
+
+   - Detailed_Input
+
+      handle      a handle returned by getFramePlan.
+      lowerEpoch  the start of the span, in seconds past J2000 TDB.
+      upperEpoch  the end of the span, in seconds past J2000 TDB.
+      samples     the number of evenly spaced sample epochs.
+
+   - Detailed_Output
+
+      Returns true if every memoized rotation is within the quasi-static
+   error bound (or exact, if the mode is disabled) of pxform_c.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Each sample epoch is followed by a few epochs at increasing offsets,
+   the way a refinement visits them, so that both the anchors and the
+   approximations made from them are exercised. The largest error found is
+   reported.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( handle < 0 ||
+        handle >= static_cast<FramePlanHandle>( framePlans.size() ) ||
+        samples < 2 )
+   {
+      std::cout << "Error: unable to validate the rotation memo."
+                << std::endl;
+      return false;
+   }
+
+   const auto& plan = framePlans[handle];
+   SpiceDouble spacing = ( upperEpoch - lowerEpoch ) / ( samples - 1 );
+   SpiceDouble offsets[] = { 0.0, 1.0e-3, 1.0e-2, 1.0e-1, 0.5 };
+   SpiceDouble maxError{ 0.0 };
+   for ( SpiceInt i = 0; i < samples; i++ ) {
+      for ( auto& offset : offsets ) {
+         SpiceDouble epoch = lowerEpoch + ( i + offset ) * spacing;
+         SpiceDouble memoized[3][3];
+         SpiceDouble expected[3][3];
+         if ( !getMemoRotation( handle, epoch, memoized ) ) {
+            return false;
+         }
+         pxform_c( plan.From.c_str(), plan.To.c_str(), epoch, expected );
+         maxError =
+            std::max( maxError, rotationDifference( memoized, expected ) );
+      }
+   }
+
+   /*
+   Allow for rounding when the memo is exact.
+   */
+   SpiceDouble bound = std::max( quasiStaticBound, 1.0e-14 );
+   std::cout << "Maximum rotation memo error for " << plan.From << " to "
+             << plan.To << ": " << maxError << " rad (bound " << bound
+             << " rad)." << std::endl;
+   if ( maxError > bound ) {
+      std::cout << "Error: the rotation memo exceeds its error bound."
+                << std::endl;
+      return false;
+   }
+   return true;
+}
+
+/*
+This function times pxform_c against the plan cache while alternating
+between several pairs of frames, and reports the results.
+*/
+void cppspice::benchmarkFramePlans(
+   const std::vector<std::pair<std::string, std::string>>& framePairs,
+   const SpiceInt                                          iterations ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      vector     I   The pairs of frames to alternate between.
+      SpiceInt   I   The number of passes over the pairs.
+
+   - Detailed_Input
+
+      framePairs  the (from, to) pairs of frames. Each pass evaluates every
+                  pair once, in order, so consecutive calls never repeat a
+                  pair unless only one is given.
+      iterations  the number of passes to time.
+
+   - Detailed_Output
+
+      None. The time per call of pxform_c, getFrameRotation, and
+   getPlanRotation are reported, along with the largest element difference
+   between the plans and pxform_c.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and nothing is timed.
+
+   - Particulars
+
+      The epochs advance by one minute per pass, starting at J2000.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<FramePlanHandle> handles;
+   for ( auto& pair : framePairs ) {
+      handles.push_back( getFramePlan( pair.first, pair.second ) );
+      if ( handles.back() < 0 ) {
+         return;
+      }
+   }
+   if ( handles.empty() || iterations <= 0 ) {
+      return;
+   }
+
+   /*
+   Time each approach over the same sequence of calls. The checksum keeps
+   the compiler from discarding any of the work.
+   */
+   SpiceDouble rotate[3][3];
+   SpiceDouble checksum{ 0.0 };
+   auto        timeCalls = [&]( int approach ) -> double {
+      /*
+      - Detailed_Output
+
+         Returns the average number of nanoseconds per call.
+
+      - Version
+
+         Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+      */
+      auto start = std::chrono::steady_clock::now();
+      for ( SpiceInt i = 0; i < iterations; i++ ) {
+         SpiceDouble epoch = i * 60.0;
+         for ( size_t p = 0; p < framePairs.size(); p++ ) {
+            if ( approach == 0 ) {
+               pxform_c(
+                  framePairs[p].first.c_str(),
+                  framePairs[p].second.c_str(),
+                  epoch,
+                  rotate );
+            }
+            else if ( approach == 1 ) {
+               getFrameRotation(
+                  framePairs[p].first,
+                  framePairs[p].second,
+                  epoch,
+                  rotate );
+            }
+            else {
+               getPlanRotation( handles[p], epoch, rotate );
+            }
+            checksum += rotate[0][0];
+         }
+      }
+      std::chrono::duration<double, std::nano> elapsed =
+         std::chrono::steady_clock::now() - start;
+      return elapsed.count() / ( iterations * framePairs.size() );
+   };
+
+   double pxformTime = timeCalls( 0 );
+   double namedTime  = timeCalls( 1 );
+   double handleTime = timeCalls( 2 );
+
+   /*
+   Check the plans against pxform_c over the same epochs.
+   */
+   SpiceDouble maxDifference{ 0.0 };
+   SpiceDouble expected[3][3];
+   for ( SpiceInt i = 0; i < iterations; i++ ) {
+      for ( size_t p = 0; p < framePairs.size(); p++ ) {
+         pxform_c(
+            framePairs[p].first.c_str(),
+            framePairs[p].second.c_str(),
+            i * 60.0,
+            expected );
+         getPlanRotation( handles[p], i * 60.0, rotate );
+         for ( int j = 0; j < 9; j++ ) {
+            maxDifference = std::max(
+               maxDifference,
+               std::abs( ( &rotate[0][0] )[j] - ( &expected[0][0] )[j] ) );
+         }
+      }
+   }
+
+   std::cout << "Frame plan benchmark over " << framePairs.size()
+             << " alternating frame pairs (checksum " << checksum << "):"
+             << std::endl;
+   std::cout << "   pxform_c:         " << pxformTime << " ns per call"
+             << std::endl;
+   std::cout << "   getFrameRotation: " << namedTime << " ns per call"
+             << std::endl;
+   std::cout << "   getPlanRotation:  " << handleTime << " ns per call"
+             << std::endl;
+   std::cout << "   Maximum element difference from pxform_c: "
+             << maxDifference << std::endl;
+}
+/* End FrameUtils.cpp */
@@ -0,0 +1,202 @@
+// clang-format off
+/*
+
+- Header_File FrameUtils.hpp (Frame utility code)
+
+- Abstract
+
+   Define utility functions which evaluate the orientation of body-fixed
+   reference frames without going through the CSPICE frame subsystem.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   PCK
+   POOL
+   ROTATION
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   evaluate body-fixed frame orientations. A rotation model is compiled once
+   from the IAU style constants in the kernel pool (POLE_RA, POLE_DEC, PM and
+   the NUT_PREC_* terms) into flat coefficient arrays, and is then evaluated
+   directly at each epoch. This avoids the frame name resolution, frame chain
+   search, and binary PCK lookups that pxform_c and sxform_c perform on every
+   call.
+
+   Frame transformation plans apply the same idea to whole frame chains. A
+   plan reduces each of its two frames to a constant rotation on top of a
+   single base: an inertial frame, a rotation model, or (for CK, dynamic,
+   and binary PCK frames) a direct CSPICE evaluation. Plans are rebuilt
+   whenever kernels are loaded or unloaded through furnishKernel and
+   unloadKernel.
+
+   Finally, a per-thread rotation memo sits in front of the plans. Besides
+   returning repeated epochs for free, it has an optional quasi-static mode
+   for refinement: the rotation at an epoch close to a previous full
+   evaluation is obtained by rotating that result about its instantaneous
+   rotation axis (the pole, for a body-fixed frame) by omega*dt. The span
+   over which this is done is chosen so that the error stays within a
+   configurable bound.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   Rotation models only support PCK class frames whose orientation comes
+   from a text PCK. Frames whose orientation comes from a loaded binary PCK
+   must be evaluated through pxform_c, sxform_c, or a frame plan instead.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes and the vector header for this file.
+*/
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   An opaque handle to a compiled rotation model.
+   */
+   using RotationModelHandle = SpiceInt;
+
+   /*
+   This function resolves a frame name to a compiled rotation model. A handle
+   of -1 is returned if the frame can't be represented by a rotation model,
+   in which case the caller should fall back on pxform_c or sxform_c.
+   */
+   RotationModelHandle getRotationModel( const std::string& frameName );
+
+   /*
+   This function evaluates the rotation from J2000 to the model's frame at
+   the given epoch. The model is recompiled first if the kernel pool has
+   changed.
+   */
+   bool getModelRotation(
+      const RotationModelHandle handle,
+      const SpiceDouble         epoch,
+      SpiceDouble               rotate[3][3] );
+
+   /*
+   This function evaluates the state transformation from J2000 to the model's
+   frame at the given epoch.
+   */
+   bool getModelStateTransform(
+      const RotationModelHandle handle,
+      const SpiceDouble         epoch,
+      SpiceDouble               xform[6][6] );
+
+   /*
+   An opaque handle to a resolved frame transformation plan.
+   */
+   using FramePlanHandle = SpiceInt;
+
+   /*
+   This function resolves the chain between two frames to a plan, which can
+   be evaluated repeatedly without searching the frame tree again. A handle
+   of -1 is returned if either frame is not recognized.
+   */
+   FramePlanHandle getFramePlan(
+      const std::string& fromFrame,
+      const std::string& toFrame );
+
+   /*
+   This function evaluates the rotation from the plan's "from" frame to its
+   "to" frame at the given epoch.
+   */
+   bool getPlanRotation(
+      const FramePlanHandle handle,
+      const SpiceDouble     epoch,
+      SpiceDouble           rotate[3][3] );
+
+   /*
+   This function evaluates the state transformation from the plan's "from"
+   frame to its "to" frame at the given epoch.
+   */
+   bool getPlanStateTransform(
+      const FramePlanHandle handle,
+      const SpiceDouble     epoch,
+      SpiceDouble           xform[6][6] );
+
+   /*
+   These are drop-in replacements for pxform_c and sxform_c which keep a plan
+   for every pair of frames they have been called with, rather than only the
+   most recent pair.
+   */
+   bool getFrameRotation(
+      const std::string& fromFrame,
+      const std::string& toFrame,
+      const SpiceDouble  epoch,
+      SpiceDouble        rotate[3][3] );
+   bool getFrameStateTransform(
+      const std::string& fromFrame,
+      const std::string& toFrame,
+      const SpiceDouble  epoch,
+      SpiceDouble        xform[6][6] );
+
+   /*
+   This function enables the quasi-static rotation mode of the rotation memo
+   with the given error bound, in radians. A bound of zero disables it.
+   */
+   void setQuasiStaticRotation( const SpiceDouble errorBound );
+
+   /*
+   This function evaluates a frame plan's rotation through a small per-thread
+   memo, so that repeated requests for the same epoch are free. In the
+   quasi-static mode, epochs near a previous full evaluation are obtained by
+   rotating about the instantaneous rotation axis instead.
+   */
+   bool getMemoRotation(
+      const FramePlanHandle handle,
+      const SpiceDouble     epoch,
+      SpiceDouble           rotate[3][3] );
+
+   /*
+   This function compares the memoized rotations of a frame plan against
+   pxform_c over a span, and reports whether they stay within the quasi-static
+   error bound.
+   */
+   bool validateMemoRotation(
+      const FramePlanHandle handle,
+      const SpiceDouble     lowerEpoch,
+      const SpiceDouble     upperEpoch,
+      const SpiceInt        samples );
+
+   /*
+   This function times pxform_c against the plan cache while alternating
+   between several pairs of frames, and reports the results.
+   */
+   void benchmarkFramePlans(
+      const std::vector<std::pair<std::string, std::string>>& framePairs,
+      const SpiceInt                                          iterations );
+}   // namespace cppspice
+    /* End FrameUtils.hpp */
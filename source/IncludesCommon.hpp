@@ -78,6 +78,18 @@ namespace cppspice {
    using ParticipantDetails =
       std::tuple<std::string, std::string, std::string>;
 
+   /*
+   Likewise, a satellite system is given as a list of the names of its
+   bodies, so define BodyNames here.
+   */
+   using BodyNames = std::vector<std::string>;
+
+   /*
+   Each requested benchmark is given by its name and the size of its run
+   (passes, epochs, rays, ...), so define BenchmarkRuns here.
+   */
+   using BenchmarkRuns = std::vector<std::pair<std::string, SpiceInt>>;
+
    /*
    Since this program supports console input and file parsing, it's useful
    to create a SimulationData struct to manage the required inputs for the
@@ -92,6 +104,27 @@ namespace cppspice {
       ParticipantDetails TargetDetails;
       std::string        ObserverName;
       double             Tolerance;
+      std::string        SubsetKernel;
+      BenchmarkRuns      Benchmarks;
+      SpiceDouble        RotationErrorBound{ 0.0 };
+      std::string        StepMode{ "FIXED" };
+      std::string        RefineMode{ "BISECTION" };
+      std::string        SearchMonitor{ "NONE" };
+      SpiceInt           ShapeCacheSize{ -1 };
+      std::string        FootprintOutput;
+      SpiceDouble        FootprintResolution{ 0.0 };
+      SpiceDouble        FootprintStep{ 0.0 };
+      std::string        EventDetail{ "NONE" };
+      std::string        ObscurationOutput;
+      SpiceDouble        ObscurationStep{ 0.0 };
+      std::string        LimbDarkening{ "NONE" };
+      std::string        StarCatalog;
+      SpiceDouble        StarCatalogEpoch{ 2000.0 };
+      SpiceDouble        StarStep{ 0.0 };
+      std::string        StarOutput;
+      BodyNames          MutualBodies;
+      SpiceDouble        MutualStep{ 0.0 };
+      std::string        MutualOutput;
    };
 
    /*
@@ -150,13 +183,55 @@ namespace cppspice {
    const std::vector<std::string> validOcclTypes =
       { "FULL", "ANNULAR", "PARTIAL", "ANY" };
 
+   /*
+   The step mode selects how the CSPICE search steps through the confinement
+   window: with the fixed StepSize as gfoclt_c does, or with a step adapted
+   to the geometry (never below StepSize).
+   */
+   const std::vector<std::string> validStepModes = { "FIXED", "ADAPTIVE" };
+
+   /*
+   The refine mode selects how the CSPICE search narrows down each
+   transition: by plain bisection as gfoclt_c does, or with secant steps on
+   a continuous overlap measure.
+   */
+   const std::vector<std::string> validRefineModes =
+      { "BISECTION", "SECANT" };
+
+   /*
+   The search monitor selects whether the CSPICE search is followed: not at
+   all, or with its progress, its statistics, and a way to cancel it.
+   */
+   const std::vector<std::string> validSearchMonitors =
+      { "NONE", "PROGRESS" };
+
+   /*
+   The benchmarks time a part of the simulation in place of the search: the
+   frame plans, the time conversions, the epoch parser, the interval sets,
+   the occulter's shape model, shape cache, and shape loading, and the GF
+   sphere pre-classifier.
+   */
+   const std::vector<std::string> validBenchmarks = {
+      "FRAMES", "TIMES", "EPOCHS", "INTERVALS", "SHAPE", "SHAPECACHE",
+      "SHAPELOAD", "SPHERES" };
+
+   /*
+   The event detail selects what is reported about each event beyond its
+   interval: nothing more, or its contacts and greatest occultation.
+   */
+   const std::vector<std::string> validEventDetails = { "NONE", "CONTACTS" };
+
+   /*
+   The limb darkening selects how the target's disk is weighted in the
+   obscuration series: uniformly, or by the Sun's limb darkening.
+   */
+   const std::vector<std::string> validLimbDarkenings = { "NONE", "SOLAR" };
+
    /*
    Shape type is used in the occultation analysis.
    */
-   // TODO - add support for DSK/UNPRIORITIZED
-   const std::vector<std::string> validShapeTypes = {
-      "ELLIPSOID",
-      "POINT" /*, "DSK/UNPRIORITIZED"*/ };
+   const std::vector<std::string> validShapeTypes =
+      { "ELLIPSOID", "POINT", "DSK/UNPRIORITIZED" };
 
    /*
    Who doesn't want some tasty pi?
@@ -174,12 +249,92 @@ namespace cppspice {
    /*
    Define some constants for readability
    */
-   constexpr SpiceInt    EARTHID   = 399;
-   constexpr SpiceInt    ITERLIMIT = 4000;
-   constexpr SpiceInt    CELLSIZE  = 200;
-   constexpr SpiceInt    TIMELEN   = 41;
-   constexpr SpiceDouble STEPSIZE  = 0.1;
-   constexpr SpiceChar*  TIMEFORMAT =
+   constexpr SpiceInt    EARTHID              = 399;
+   constexpr SpiceInt    ITERLIMIT            = 4000;
+   constexpr SpiceInt    CELLSIZE             = 200;
+   constexpr SpiceInt    TIMELEN              = 41;
+   constexpr SpiceDouble STEPSIZE             = 0.1;
+   constexpr SpiceInt    CHAINLIMIT           = 20;
+   constexpr SpiceInt    SEGIDLEN             = 41;
+   constexpr SpiceInt    FRAMELEN             = 33;
+   constexpr SpiceInt    J2000CODE            = 1;
+   constexpr SpiceDouble LTTOLERANCE          = 1.0e-17;
+   constexpr SpiceInt    LTMAXITER            = 5;
+   constexpr SpiceInt    FILENAMELEN          = 256;
+   constexpr SpiceInt    FILETYPELEN          = 33;
+   constexpr SpiceDouble SUBSETPAD            = 86400.0;
+   constexpr SpiceInt    SUBSETSAMPLES        = 1000;
+   constexpr SpiceDouble SUBSETTOLERANCE      = 1.0e-6;
+   constexpr const SpiceChar* SUBSETNAME      = "SYMMETRICAL-ENIGMA SUBSET";
+   constexpr SpiceInt    SUBSETNAMELEN        = 61;
+   constexpr SpiceInt    POOLBATCH            = 100;
+   constexpr SpiceInt    POOLNAMELEN          = 33;
+   constexpr SpiceInt    POOLSTRLEN           = 81;
+   constexpr const SpiceChar* SNAPSHOTMAGIC   = "SEPOOL01";
+   constexpr const SpiceChar* POOLAGENTPREFIX = "SE_POOL_HANDLE_";
+   constexpr SpiceInt    INERTIALCLASS        = 1;
+   constexpr SpiceInt    PCKCLASS             = 2;
+   constexpr SpiceInt    TKCLASS              = 4;
+   constexpr SpiceInt    MAXNUTPREC           = 100;
+   constexpr const SpiceChar* ROTATIONAGENTPREFIX = "SE_ROTATION_MODEL_";
+   constexpr SpiceInt    MEMOSIZE             = 8;
+   constexpr SpiceDouble QUASISTATICWINDOW    = 3600.0;
+   constexpr SpiceInt    MAXLEAPSECONDS       = 280;
+   constexpr SpiceInt    EPOCHCHUNK           = 256;
+   constexpr SpiceDouble ADAPTIVEMAXSTEP      = 43200.0;
+   constexpr SpiceDouble ADAPTIVESAFETY       = 2.0;
+   constexpr SpiceInt    STAGESAMPLEINTERVAL  = 64;
+   constexpr SpiceDouble PROGRESSINTERVAL     = 1.0;
+   constexpr SpiceInt    MERGECHUNK           = 131072;
+   constexpr SpiceInt    MAXMERGETHREADS      = 16;
+   constexpr SpiceInt    SHAPEBINS            = 16;
+   constexpr SpiceInt    SHAPEMAXLEAF         = 8;
+   constexpr SpiceInt    SHAPEMAXDEPTH        = 48;
+   constexpr SpiceDouble SHAPEEDGEMARGIN      = 1.0e-10;
+   constexpr SpiceInt    SHAPERINGS           = 4;
+   constexpr SpiceInt    SHAPESPOKES          = 16;
+   constexpr SpiceInt    SILHOUETTELATS       = 18;
+   constexpr SpiceInt    SILHOUETTELONS       = 36;
+   constexpr SpiceInt    SILHOUETTEANGLES     = 128;
+   constexpr SpiceInt    SILHOUETTESTEPS      = 64;
+   constexpr SpiceInt    SILHOUETTEBISECTIONS = 16;
+   constexpr SpiceInt    SHAPECACHEPLATES     = 4000000;
+   constexpr SpiceInt    SHAPELANES           = 8;
+   constexpr SpiceInt    MAXSHAPETHREADS      = 32;
+   constexpr SpiceInt    SHAPERAYCHUNK        = 1024;
+   constexpr SpiceInt    DASRECORDBYTES       = 1024;
+   constexpr SpiceInt    DASDPWORDS           = 128;
+   constexpr SpiceInt    DASINTWORDS          = 256;
+   constexpr SpiceInt    DASCHARTYPE          = 1;
+   constexpr SpiceInt    DASDPTYPE            = 2;
+   constexpr SpiceInt    DASINTTYPE           = 3;
+   constexpr SpiceInt    DASCOUNTOFFSET       = 68;
+   constexpr SpiceInt    DASFORMATOFFSET      = 84;
+   constexpr SpiceInt    DASFIRSTDESCRIPTOR   = 10;
+   constexpr SpiceInt    DSKVERTEXSTART       = 35;
+   constexpr SpiceInt    DSKPLATESTART        = 11;
+   constexpr SpiceDouble FOOTPRINTRESOLUTION  = 1.0;
+   constexpr SpiceInt    FOOTPRINTLANES       = 8;
+   constexpr SpiceInt    FOOTPRINTOUTLINE     = 72;
+   constexpr SpiceInt    MAXFOOTPRINTTHREADS  = 32;
+   constexpr SpiceDouble OBSCURATIONSTEP      = 1.0;
+   constexpr SpiceInt    OBSCURATIONBATCH     = 4096;
+   constexpr SpiceInt    OBSCURATIONLANES     = 8;
+   constexpr SpiceInt    OBSCURATIONRINGS     = 128;
+   constexpr SpiceInt    OBSCURATIONCOLUMNS   = 6;
+   constexpr const SpiceChar* OBSCURATIONMAGIC = "SEOBSC01";
+   constexpr SpiceDouble SOLARLIMBU           = 0.93;
+   constexpr SpiceDouble SOLARLIMBV           = -0.23;
+   constexpr SpiceInt    STARINDEXDEPTH       = 10;
+   constexpr SpiceDouble STARSTEP             = 600.0;
+   constexpr SpiceDouble STARPATHPAD          = 1.01;
+   constexpr SpiceInt    STARMINIMUMSTEPS     = 40;
+   constexpr SpiceInt    STARPOLISHLIMIT      = 8;
+   constexpr SpiceDouble STARSLOPESPAN        = 1.0e-3;
+   constexpr SpiceDouble MUTUALSTEP           = 600.0;
+   constexpr SpiceDouble MUTUALPATHPAD        = 2.0;
+   constexpr SpiceInt    MUTUALMINIMUMSTEPS   = 40;
+   constexpr SpiceChar*  TIMEFORMAT           =
       "YYYY MON DD HR:MN:SC.###### ::TDB (TDB)";
 }   // namespace cppspice
     /* End IncludesCommon.hpp */
\ No newline at end of file
@@ -0,0 +1,211 @@
+// clang-format off
+/*
+
+- Header_File IntervalUtils.hpp (Interval utility code)
+
+- Abstract
+
+   Define an interval set which grows as needed, and the window algebra
+   which operates on it, for windows too large for fixed size SpiceCells.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   CELLS
+   GF
+   WINDOWS
+
+- Particulars
+
+   This file is a header which defines the interval set and the functions
+   which are offered to combine interval sets. An interval set is a window
+   in the CSPICE sense: an ordered list of disjoint, closed intervals. The
+   CSPICE window routines work on SpiceCells whose size is fixed when they
+   are declared, and signal an error when a result doesn't fit. Interval
+   sets reserve storage up front and grow when they run out, like a
+   std::vector.
+
+   The endpoints of a set are stored behind a control area, in the layout
+   of a double precision SpiceCell. The set can therefore be handed to the
+   CSPICE window and GF routines as a cell without copying, and a SpiceCell
+   can be read by the functions here without copying it into a set.
+
+   Union, intersection and difference are single merge passes over the two
+   inputs, and give exactly the same endpoints as wnunid_c, wnintd_c and
+   wndifd_c. When the inputs are large, they are split at gaps which both
+   of them share, and the pieces are merged on separate threads.
+
+- Literature_References
+
+   CSPICE's documentation for the WINDOWS and CELLS required reading.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   The inputs of the window algebra must be valid windows. As with the
+   CSPICE routines, this is not checked. A cell obtained from a set stays
+   valid until the set grows, and a CSPICE routine which writes to it can't
+   grow the set, so enough room must be reserved beforehand.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes and the vector header for this file.
+*/
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   An ordered list of disjoint, closed intervals, stored in the layout of a
+   double precision SpiceCell.
+   */
+   class IntervalSet {
+   public:
+      IntervalSet();
+      explicit IntervalSet( const SpiceInt intervals );
+      IntervalSet( const IntervalSet& other );
+      IntervalSet( IntervalSet&& other ) noexcept;
+      IntervalSet& operator=( IntervalSet other ) noexcept;
+
+      /*
+      Make room for at least this many intervals, so that the set won't
+      grow until it holds more.
+      */
+      void reserve( const SpiceInt intervals );
+
+      /*
+      Remove every interval, keeping the storage.
+      */
+      void clear();
+
+      /*
+      The number of intervals, and the number there is room for.
+      */
+      SpiceInt size() const;
+      SpiceInt capacity() const;
+      bool     empty() const;
+
+      /*
+      The endpoints of the intervals, in the order left, right, left, ...
+      */
+      const SpiceDouble* endpoints() const;
+
+      /*
+      The sum of the lengths of the intervals, as wnsumd_c reports it.
+      */
+      SpiceDouble measure() const;
+
+      /*
+      Insert an interval, merging it with any intervals it touches, as
+      wninsd_c does. Intervals which are inserted in increasing order are
+      appended in amortized constant time.
+      */
+      bool insert( const SpiceDouble left, const SpiceDouble right );
+
+      /*
+      Replace the intervals with those of a double precision window.
+      */
+      bool assign( const SpiceCell& window );
+
+      /*
+      Fill the set directly. beginWrite makes room for the given number of
+      intervals and returns their endpoints, and endWrite sets the number
+      which were written. The caller is responsible for writing a valid
+      window.
+      */
+      SpiceDouble* beginWrite( const SpiceInt intervals );
+      void         endWrite( const SpiceInt intervals );
+
+      /*
+      The set as a double precision SpiceCell which shares its storage.
+      CSPICE routines which write to the cell update the set.
+      */
+      SpiceCell* cell();
+
+      void swap( IntervalSet& other ) noexcept;
+
+   private:
+      void attach();
+
+      std::vector<SpiceDouble> storage;
+      SpiceCell                window;
+   };
+
+   /*
+   A read-only view of the intervals of a set or a double precision
+   SpiceCell, which the window algebra takes as its inputs.
+   */
+   struct IntervalSpan {
+      IntervalSpan( const IntervalSet& set );
+      IntervalSpan( const SpiceCell& window );
+
+      const SpiceDouble* Endpoints;
+      SpiceInt           Count;
+   };
+
+   /*
+   These functions compute the union, intersection and difference of two
+   windows, with the same results as wnunid_c, wnintd_c and wndifd_c. The
+   result may be one of the inputs.
+   */
+   bool uniteIntervals(
+      const IntervalSpan& first,
+      const IntervalSpan& second,
+      IntervalSet&        result );
+   bool intersectIntervals(
+      const IntervalSpan& first,
+      const IntervalSpan& second,
+      IntervalSet&        result );
+   bool subtractIntervals(
+      const IntervalSpan& first,
+      const IntervalSpan& second,
+      IntervalSet&        result );
+
+   /*
+   This function computes the complement of a window with respect to the
+   interval [left, right], with the same result as wncomd_c.
+   */
+   bool complementIntervals(
+      const IntervalSpan& window,
+      const SpiceDouble   left,
+      const SpiceDouble   right,
+      IntervalSet&        result );
+
+   /*
+   This function sets the number of threads which the window algebra may
+   use for large inputs. Zero, the default, uses one per hardware thread up
+   to MAXMERGETHREADS, and one disables the parallel merge.
+   */
+   void setMergeThreads( const SpiceInt threads );
+
+   /*
+   This function times the CSPICE window routines against the window
+   algebra for two windows of the given size, and reports the results.
+   */
+   void benchmarkIntervalSets( const SpiceInt count );
+}   // namespace cppspice
+    /* End IntervalUtils.hpp */
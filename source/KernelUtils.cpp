@@ -0,0 +1,1509 @@
+// clang-format off
+/*
+
+- Source_File KernelUtils.cpp (Kernel utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   DAF
+   KERNEL
+   NAIF_IDS
+   POOL
+   SPK
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (KernelUtils.hpp). These functions manage the
+   kernels furnished to this program.
+
+   A pool snapshot is a native-endian binary file with the layout:
+
+      "SEPOOL01"
+      kernel count, then for each kernel: path, size, content hash
+      variable count, then for each variable: name, type ('N' or 'C'),
+         value count, and the values
+
+   Strings are stored as a 32-bit length followed by their characters.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, set and vector for bookkeeping, chrono
+for timing, and the stream headers for the snapshot files.
+*/
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "KernelUtils.hpp"
+
+/*
+The details of an SPK segment which may be copied into a subset kernel.
+*/
+struct SegmentReference {
+   SpiceInt    Handle;
+   SpiceDouble Descriptor[5];
+   std::string Identifier;
+   SpiceInt    Body;
+   SpiceInt    Center;
+   SpiceDouble Begin;
+   SpiceDouble End;
+};
+
+/*
+The number of times the set of loaded kernels has changed. Anything which
+caches data derived from the loaded kernels compares against this.
+*/
+static long long kernelGeneration{ 0 };
+
+/*
+This is a helper which retrieves the NAIF IDs of every body whose state is
+evaluated during the simulation.
+*/
+static std::vector<SpiceInt> getParticipantIDs(
+   const cppspice::SimulationData& data ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+
+   - Detailed_Input
+
+      data     a SimulationData struct whose occulter, target, and observer,
+               or whose satellite system and observer, are of interest.
+
+   - Detailed_Output
+
+      Returns the NAIF IDs of the occulter, target, and observer, plus the
+   Earth, since the custom algorithm evaluates all states relative to it.
+   If a satellite system was given, its bodies and the Sun, which shades
+   them, take the place of the occulter and target.
+
+   - Error Handling
+
+      Any errors encountered by the CSPICE routine will be handled by the
+   CSPICE error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<std::string> names{ data.ObserverName };
+   if ( data.MutualBodies.empty() ) {
+      names.push_back( std::get<0>( data.OcculterDetails ) );
+      names.push_back( std::get<0>( data.TargetDetails ) );
+   }
+   else {
+      names.insert(
+         names.end(),
+         data.MutualBodies.begin(),
+         data.MutualBodies.end() );
+      names.push_back( "SUN" );
+   }
+
+   std::vector<SpiceInt> ids{ cppspice::EARTHID };
+   for ( auto& name : names ) {
+      SpiceInt     code{ 0 };
+      SpiceBoolean found{ false };
+      bodn2c_c( name.c_str(), &code, &found );
+      if ( found ) {
+         ids.push_back( code );
+      }
+   }
+   return ids;
+}
+
+/*
+This is a helper which lists every segment of every furnished SPK, in order
+of increasing priority.
+*/
+static std::vector<SegmentReference> getFurnishedSegments() {
+   /*
+   - Brief I/O
+
+      None.
+
+   - Detailed_Output
+
+      Returns a vector of the segments of all of the furnished SPKs. The
+   segments are ordered by file load order, and then by their order within
+   each file, which means that later segments take priority over earlier
+   ones.
+
+   - Error Handling
+
+      Any errors encountered by the CSPICE routines will be handled by the
+   CSPICE error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<SegmentReference> segments;
+
+   SpiceInt count{ 0 };
+   ktotal_c( "SPK", &count );
+   for ( SpiceInt i = 0; i < count; i++ ) {
+      SpiceChar    file[cppspice::FILENAMELEN];
+      SpiceChar    type[cppspice::FILETYPELEN];
+      SpiceChar    source[cppspice::FILENAMELEN];
+      SpiceInt     handle{ 0 };
+      SpiceBoolean found{ false };
+      kdata_c(
+         i,
+         "SPK",
+         cppspice::FILENAMELEN,
+         cppspice::FILETYPELEN,
+         cppspice::FILENAMELEN,
+         file,
+         type,
+         source,
+         &handle,
+         &found );
+      if ( !found ) {
+         continue;
+      }
+
+      /*
+      Walk the DAF segment list from front to back.
+      */
+      dafbfs_c( handle );
+      daffna_c( &found );
+      while ( found ) {
+         SegmentReference segment;
+         SpiceDouble      dc[2];
+         SpiceInt         ic[6];
+         SpiceChar        ident[cppspice::SEGIDLEN];
+         dafgs_c( segment.Descriptor );
+         dafus_c( segment.Descriptor, 2, 6, dc, ic );
+         dafgn_c( cppspice::SEGIDLEN, ident );
+
+         segment.Handle     = handle;
+         segment.Identifier = ident;
+         segment.Body       = ic[0];
+         segment.Center     = ic[1];
+         segment.Begin      = dc[0];
+         segment.End        = dc[1];
+         segments.push_back( segment );
+
+         daffna_c( &found );
+      }
+   }
+
+   return segments;
+}
+
+/*
+This is a helper which lists the furnished SPKs, in load order.
+*/
+static std::vector<std::string> getFurnishedSPKs() {
+   std::vector<std::string> furnished;
+   SpiceInt                 count{ 0 };
+   ktotal_c( "SPK", &count );
+   for ( SpiceInt i = 0; i < count; i++ ) {
+      SpiceChar    file[cppspice::FILENAMELEN];
+      SpiceChar    type[cppspice::FILETYPELEN];
+      SpiceChar    source[cppspice::FILENAMELEN];
+      SpiceInt     handle{ 0 };
+      SpiceBoolean found{ false };
+      kdata_c(
+         i,
+         "SPK",
+         cppspice::FILENAMELEN,
+         cppspice::FILETYPELEN,
+         cppspice::FILENAMELEN,
+         file,
+         type,
+         source,
+         &handle,
+         &found );
+      furnished.push_back( file );
+   }
+   return furnished;
+}
+
+/*
+This is a helper which removes a subset kernel left by an earlier run. A
+file which isn't one, or which is furnished, is left alone.
+*/
+static bool removeSubsetKernel( const std::string& path ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The path of the existing file.
+
+   - Detailed_Output
+
+      The function returns true if the file was a subset kernel, and has
+   been removed.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceChar    type[cppspice::FILETYPELEN];
+   SpiceChar    source[cppspice::FILENAMELEN];
+   SpiceInt     handle{ 0 };
+   SpiceBoolean found{ false };
+   kinfo_c(
+      path.c_str(),
+      cppspice::FILETYPELEN,
+      cppspice::FILENAMELEN,
+      type,
+      source,
+      &handle,
+      &found );
+   if ( found ) {
+      std::cout << "Error: the subset kernel '" << path
+                << "' is furnished, so it can't be replaced." << std::endl;
+      return false;
+   }
+
+   /*
+   Only an SPK whose internal file name is ours was written here.
+   */
+   SpiceChar architecture[cppspice::FILETYPELEN];
+   getfat_c(
+      path.c_str(),
+      cppspice::FILETYPELEN,
+      cppspice::FILETYPELEN,
+      architecture,
+      type );
+   std::string internalName;
+   if ( std::string( architecture ) == "DAF" &&
+        std::string( type ) == "SPK" )
+   {
+      SpiceInt  nd{ 0 };
+      SpiceInt  ni{ 0 };
+      SpiceInt  forward{ 0 };
+      SpiceInt  backward{ 0 };
+      SpiceInt  freeAddress{ 0 };
+      SpiceChar name[cppspice::SUBSETNAMELEN];
+      dafopr_c( path.c_str(), &handle );
+      dafrfr_c(
+         handle,
+         cppspice::SUBSETNAMELEN,
+         &nd,
+         &ni,
+         name,
+         &forward,
+         &backward,
+         &freeAddress );
+      dafcls_c( handle );
+      internalName = name;
+      internalName.erase( internalName.find_last_not_of( ' ' ) + 1 );
+   }
+   if ( internalName != cppspice::SUBSETNAME ) {
+      std::cout << "Error: '" << path
+                << "' already exists, and isn't a subset kernel."
+                << std::endl;
+      return false;
+   }
+
+   if ( std::remove( path.c_str() ) != 0 ) {
+      std::cout << "Error: the subset kernel '" << path
+                << "' could not be replaced." << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+/*
+This function writes a new SPK which contains only the segments, and only
+the portions of those segments, which are required to evaluate the
+participants of the simulation over its time span.
+*/
+bool cppspice::writeSubsetKernel(
+   const SimulationData& data,
+   const std::string&    outputPath ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+      string     I   The path of the subset kernel to write.
+
+   - Detailed_Input
+
+      data        a SimulationData struct whose participants and epoch
+                  bounds determine the contents of the subset kernel. The
+                  SPKs which cover the participants must already be
+                  furnished.
+      outputPath  the path of the new SPK. A subset kernel which was
+                  written there before is replaced, but any other file is
+                  left alone.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Starting from the participants (and the Earth), we select every
+   segment whose body is required and whose coverage overlaps the padded
+   simulation span. The centers of those segments are then required as
+   well, and so on until the center chains are closed. Each selected segment
+   is copied with spksub_c, which retains only the records covering the
+   padded span. Segments are written in their original priority order, so
+   the subset resolves overlaps the same way as the original kernels.
+
+      The span is padded by SUBSETPAD seconds on either side to allow for
+   light time corrections and for the searches stepping slightly outside of
+   the bounds.
+
+   - Literature_References
+
+      CSPICE's documentation for spksub_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   A subset from an earlier run is replaced, since the simulation may have
+   changed since, but we don't want to overwrite anything else by accident.
+   */
+   if ( exists_c( outputPath.c_str() ) &&
+        !removeSubsetKernel( outputPath ) )
+   {
+      return false;
+   }
+
+   /*
+   Determine the span we need to cover.
+   */
+   SpiceDouble lowerEpochTime{ 0.0 };
+   SpiceDouble upperEpochTime{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpochTime );
+   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpochTime );
+   lowerEpochTime -= SUBSETPAD;
+   upperEpochTime += SUBSETPAD;
+
+   /*
+   Now select segments until every required body's center chain is closed.
+   */
+   auto               segments = getFurnishedSegments();
+   auto               ids      = getParticipantIDs( data );
+   std::set<SpiceInt> required( ids.begin(), ids.end() );
+   std::vector<bool>  selected( segments.size(), false );
+   bool               changed{ true };
+   while ( changed ) {
+      changed = false;
+      for ( size_t i = 0; i < segments.size(); i++ ) {
+         auto& segment = segments[i];
+         if ( selected[i] || required.count( segment.Body ) == 0 ||
+              segment.End < lowerEpochTime || segment.Begin > upperEpochTime )
+         {
+            continue;
+         }
+         selected[i] = true;
+         changed     = true;
+         required.insert( segment.Center );
+      }
+   }
+
+   SpiceInt selectedCount =
+      std::count( selected.begin(), selected.end(), true );
+   if ( selectedCount == 0 ) {
+      std::cout << "Error: none of the furnished SPK segments cover the "
+                   "simulation's participants."
+                << std::endl;
+      return false;
+   }
+
+   /*
+   Finally, copy the selected portions of the selected segments.
+   */
+   SpiceInt handle{ 0 };
+   spkopn_c( outputPath.c_str(), SUBSETNAME, 0, &handle );
+   for ( size_t i = 0; i < segments.size(); i++ ) {
+      if ( !selected[i] ) {
+         continue;
+      }
+      auto& segment = segments[i];
+      spksub_c(
+         segment.Handle,
+         segment.Descriptor,
+         segment.Identifier.c_str(),
+         std::max( segment.Begin, lowerEpochTime ),
+         std::min( segment.End, upperEpochTime ),
+         handle );
+   }
+   spkcls_c( handle );
+
+   std::cout << "Wrote " << selectedCount << " of " << segments.size()
+             << " SPK segments to '" << outputPath << "'." << std::endl;
+
+   return true;
+}
+
+/*
+This function checks that a subset kernel gives the same states as the
+currently furnished SPKs for all of the simulation's participants.
+*/
+bool cppspice::validateSubsetKernel(
+   const SimulationData& data,
+   const std::string&    subsetPath ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+      string     I   The path of the subset kernel to validate.
+
+   - Detailed_Input
+
+      data        a SimulationData struct whose participants and epoch
+                  bounds were used to write the subset kernel.
+      subsetPath  the path of the subset kernel.
+
+   - Detailed_Output
+
+      The function returns true if the subset kernel agrees with the
+   furnished SPKs at every sampled epoch.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The Earth-relative J2000 state of each participant is evaluated with
+   spkez_c at SUBSETSAMPLES evenly spaced epochs using the furnished SPKs.
+   The furnished SPKs are then temporarily swapped out for the subset kernel
+   and the states are evaluated again. Afterwards, the original SPKs are
+   furnished again in their original order.
+
+   - Literature_References
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   Build our list of sample epochs.
+   */
+   SpiceDouble lowerEpochTime{ 0.0 };
+   SpiceDouble upperEpochTime{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpochTime );
+   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpochTime );
+   std::vector<SpiceDouble> epochTimes;
+   epochTimes.reserve( SUBSETSAMPLES );
+   for ( SpiceInt i = 0; i < SUBSETSAMPLES; i++ ) {
+      epochTimes.push_back(
+         lowerEpochTime +
+         i * ( upperEpochTime - lowerEpochTime ) / ( SUBSETSAMPLES - 1 ) );
+   }
+
+   /*
+   This lambda evaluates every participant at every sample epoch.
+   */
+   auto ids            = getParticipantIDs( data );
+   auto evaluateStates = [&ids, &epochTimes]() -> std::vector<SpiceDouble> {
+      /*
+      - Detailed_Output
+
+         Returns the positions of each participant at each sample epoch,
+      flattened into a single vector.
+
+      - Version
+
+         Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+      */
+      std::vector<SpiceDouble> positions;
+      positions.reserve( 3 * ids.size() * epochTimes.size() );
+      for ( auto& et : epochTimes ) {
+         for ( auto& id : ids ) {
+            SpiceDouble state[6];
+            SpiceDouble lt{ 0.0 };
+            spkez_c( id, et, "J2000", "NONE", EARTHID, state, &lt );
+            positions.insert( positions.end(), state, state + 3 );
+         }
+      }
+      return positions;
+   };
+
+   auto original = evaluateStates();
+
+   /*
+   Swap the furnished SPKs for the subset.
+   */
+   auto furnished = getFurnishedSPKs();
+   for ( auto& file : furnished ) {
+      unloadKernel( file );
+   }
+   furnishKernel( subsetPath );
+
+   auto subset = evaluateStates();
+
+   /*
+   Put everything back the way we found it.
+   */
+   unloadKernel( subsetPath );
+   for ( auto& file : furnished ) {
+      furnishKernel( file );
+   }
+
+   /*
+   Finally, compare the two sets of positions.
+   */
+   SpiceDouble maxDifference{ 0.0 };
+   for ( size_t i = 0; i < original.size(); i += 3 ) {
+      maxDifference = std::max(
+         maxDifference,
+         vdist_c( &original[i], &subset[i] ) );
+   }
+
+   std::cout << "Maximum position difference between the subset and the "
+                "original kernels: "
+             << maxDifference << " km." << std::endl;
+   if ( maxDifference > SUBSETTOLERANCE ) {
+      std::cout << "Error: the subset kernel '" << subsetPath
+                << "' does not agree with the original kernels." << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+/*
+This function swaps the furnished SPKs for a subset kernel, so that the
+simulation reads its states from the subset alone.
+*/
+void cppspice::furnishSubsetKernel( const std::string& subsetPath ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The path of the subset kernel.
+
+   - Detailed_Input
+
+      subsetPath  the path of a subset kernel which was written by
+                  writeSubsetKernel and checked by validateSubsetKernel.
+
+   - Detailed_Output
+
+      None. Every furnished SPK is unloaded, and the subset is furnished in
+   their place. Kernels of other types are left as they are.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   for ( auto& file : getFurnishedSPKs() ) {
+      unloadKernel( file );
+   }
+   furnishKernel( subsetPath );
+}
+/*
+This is a helper which computes the size and a 64-bit FNV-1a hash of a file's
+contents, which is how we recognize changes to the source kernels.
+*/
+static bool fingerprintFile(
+   const std::string& path,
+   std::uint64_t&     size,
+   std::uint64_t&     hash ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The path of the file.
+      uint64     O   The size of the file in bytes.
+      uint64     O   The hash of the file's contents.
+
+   - Detailed_Output
+
+      The function returns false if the file cannot be read.
+
+   - Error Handling
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::ifstream file( path, std::ios::binary );
+   if ( !file ) {
+      return false;
+   }
+
+   std::ostringstream contents;
+   contents << file.rdbuf();
+   const std::string& bytes = contents.str();
+
+   size = bytes.size();
+   hash = 14695981039346656037ULL;
+   for ( unsigned char c : bytes ) {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+   }
+   return true;
+}
+
+/*
+These are small helpers for reading and writing the snapshot's binary
+fields.
+*/
+template<typename T>
+static void writeField( std::ofstream& out, const T& value ) {
+   out.write( reinterpret_cast<const char*>( &value ), sizeof( T ) );
+}
+
+template<typename T>
+static bool readField( std::ifstream& in, T& value ) {
+   return static_cast<bool>(
+      in.read( reinterpret_cast<char*>( &value ), sizeof( T ) ) );
+}
+
+static void writeString( std::ofstream& out, const std::string& value ) {
+   writeField( out, static_cast<std::uint32_t>( value.size() ) );
+   out.write( value.data(), value.size() );
+}
+
+static bool readString( std::ifstream& in, std::string& value ) {
+   std::uint32_t length{ 0 };
+   if ( !readField( in, length ) ) {
+      return false;
+   }
+   value.resize( length );
+   return static_cast<bool>( in.read( &value[0], length ) );
+}
+
+/*
+This function writes the current contents of the kernel pool to a binary
+snapshot, tagged with the text kernels which produced them.
+*/
+bool cppspice::writePoolSnapshot(
+   const std::vector<std::string>& sourceKernels,
+   const std::string&              snapshotPath ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      vector     I   The paths of the text kernels in the pool.
+      string     I   The path of the snapshot to write.
+
+   - Detailed_Input
+
+      sourceKernels  the paths of the text kernels which were furnished to
+                     produce the current contents of the pool, in the order
+                     in which they were furnished.
+      snapshotPath   the path of the snapshot file. Any existing file is
+                     replaced.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Every variable in the pool is written, so this should be called when
+   the pool contains only the variables from the source kernels.
+
+   - Literature_References
+
+      CSPICE's documentation for gnpool_c, gdpool_c, and gcpool_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   First, gather the names of all of the variables in the pool.
+   */
+   std::vector<std::string> names;
+   SpiceInt                 start{ 0 };
+   SpiceInt                 n{ 0 };
+   SpiceBoolean             found{ true };
+   while ( found ) {
+      SpiceChar batch[POOLBATCH][POOLNAMELEN];
+      gnpool_c( "*", start, POOLBATCH, POOLNAMELEN, &n, batch, &found );
+      for ( SpiceInt i = 0; found && i < n; i++ ) {
+         names.push_back( batch[i] );
+      }
+      start += n;
+      found = found && n == POOLBATCH;
+   }
+
+   std::ofstream out( snapshotPath, std::ios::binary | std::ios::trunc );
+   if ( !out ) {
+      std::cout << "Error: unable to write the pool snapshot '"
+                << snapshotPath << "'." << std::endl;
+      return false;
+   }
+
+   /*
+   Write the header, which identifies the source kernels.
+   */
+   out.write( SNAPSHOTMAGIC, 8 );
+   writeField( out, static_cast<std::uint32_t>( sourceKernels.size() ) );
+   for ( auto& kernel : sourceKernels ) {
+      std::uint64_t size{ 0 };
+      std::uint64_t hash{ 0 };
+      if ( !fingerprintFile( kernel, size, hash ) ) {
+         std::cout << "Error: unable to read the kernel '" << kernel << "'."
+                   << std::endl;
+         return false;
+      }
+      writeString( out, kernel );
+      writeField( out, size );
+      writeField( out, hash );
+   }
+
+   /*
+   Now write each of the variables and their values.
+   */
+   writeField( out, static_cast<std::uint32_t>( names.size() ) );
+   for ( auto& name : names ) {
+      SpiceChar type[1];
+      dtpool_c( name.c_str(), &found, &n, type );
+      writeString( out, name );
+      writeField( out, type[0] );
+      writeField( out, static_cast<std::uint32_t>( n ) );
+
+      if ( type[0] == 'N' ) {
+         std::vector<SpiceDouble> values( n );
+         SpiceInt                 count{ 0 };
+         gdpool_c( name.c_str(), 0, n, &count, values.data(), &found );
+         out.write(
+            reinterpret_cast<const char*>( values.data() ),
+            n * sizeof( SpiceDouble ) );
+      }
+      else {
+         std::vector<SpiceChar> values( n * POOLSTRLEN );
+         SpiceInt               count{ 0 };
+         gcpool_c(
+            name.c_str(),
+            0,
+            n,
+            POOLSTRLEN,
+            &count,
+            values.data(),
+            &found );
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            writeString( out, &values[i * POOLSTRLEN] );
+         }
+      }
+   }
+
+   return static_cast<bool>( out );
+}
+
+/*
+This function restores the kernel pool from a binary snapshot. If the
+snapshot is missing or was produced from different text kernels, nothing is
+restored and false is returned.
+*/
+bool cppspice::restorePoolSnapshot(
+   const std::vector<std::string>& sourceKernels,
+   const std::string&              snapshotPath ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      vector     I   The paths of the text kernels to load.
+      string     I   The path of the snapshot to restore.
+
+   - Detailed_Input
+
+      sourceKernels  the paths of the text kernels which would otherwise be
+                     furnished, in the order in which they would be
+                     furnished.
+      snapshotPath   the path of the snapshot file.
+
+   - Detailed_Output
+
+      The function returns true if the pool was restored from the snapshot.
+
+   - Error Handling
+
+      A missing, stale, or malformed snapshot is not an error; the function
+   just returns false so that the caller can furnish the kernels instead.
+
+   - Particulars
+
+      The snapshot is current only if it lists exactly the same kernels, in
+   the same order, with the same sizes and content hashes. The snapshot is
+   read completely before anything is inserted into the pool, so the pool is
+   never left partially restored.
+
+      Restored variables are inserted with pdpool_c and pcpool_c, so they do
+   not appear in the kernel subsystem's list of loaded files.
+
+   - Literature_References
+
+      CSPICE's documentation for pdpool_c and pcpool_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::ifstream in( snapshotPath, std::ios::binary );
+   if ( !in ) {
+      return false;
+   }
+
+   /*
+   Check the header against the current source kernels.
+   */
+   char magic[8];
+   if ( !in.read( magic, 8 ) ||
+        std::string( magic, 8 ) != std::string( SNAPSHOTMAGIC, 8 ) )
+   {
+      return false;
+   }
+
+   std::uint32_t kernelCount{ 0 };
+   if ( !readField( in, kernelCount ) ||
+        kernelCount != sourceKernels.size() )
+   {
+      return false;
+   }
+   for ( auto& kernel : sourceKernels ) {
+      std::string   path;
+      std::uint64_t size{ 0 };
+      std::uint64_t hash{ 0 };
+      std::uint64_t currentSize{ 0 };
+      std::uint64_t currentHash{ 0 };
+      if ( !readString( in, path ) || !readField( in, size ) ||
+           !readField( in, hash ) || path != kernel ||
+           !fingerprintFile( kernel, currentSize, currentHash ) ||
+           size != currentSize || hash != currentHash )
+      {
+         return false;
+      }
+   }
+
+   /*
+   Read all of the variables before we touch the pool.
+   */
+   struct PoolVariable {
+      std::string              Name;
+      char                     Type;
+      std::vector<SpiceDouble> Numbers;
+      std::vector<SpiceChar>   Strings;
+   };
+
+   std::uint32_t variableCount{ 0 };
+   if ( !readField( in, variableCount ) ) {
+      return false;
+   }
+   std::vector<PoolVariable> variables( variableCount );
+   for ( auto& variable : variables ) {
+      std::uint32_t n{ 0 };
+      if ( !readString( in, variable.Name ) ||
+           !readField( in, variable.Type ) || !readField( in, n ) )
+      {
+         return false;
+      }
+
+      if ( variable.Type == 'N' ) {
+         variable.Numbers.resize( n );
+         if ( !in.read(
+                 reinterpret_cast<char*>( variable.Numbers.data() ),
+                 n * sizeof( SpiceDouble ) ) )
+         {
+            return false;
+         }
+      }
+      else {
+         variable.Strings.assign( n * POOLSTRLEN, '\0' );
+         for ( std::uint32_t i = 0; i < n; i++ ) {
+            std::string value;
+            if ( !readString( in, value ) || value.size() >= POOLSTRLEN ) {
+               return false;
+            }
+            value.copy( &variable.Strings[i * POOLSTRLEN], value.size() );
+         }
+      }
+   }
+
+   /*
+   Everything checks out, so insert the variables into the pool.
+   */
+   for ( auto& variable : variables ) {
+      if ( variable.Type == 'N' ) {
+         pdpool_c(
+            variable.Name.c_str(),
+            variable.Numbers.size(),
+            variable.Numbers.data() );
+      }
+      else {
+         pcpool_c(
+            variable.Name.c_str(),
+            variable.Strings.size() / POOLSTRLEN,
+            POOLSTRLEN,
+            variable.Strings.data() );
+      }
+   }
+   kernelGeneration++;
+
+   return true;
+}
+
+/*
+This function loads text kernels into the kernel pool, using the binary
+snapshot if it is current, and otherwise furnishing the kernels and then
+writing a new snapshot.
+*/
+bool cppspice::furnishTextKernels(
+   const std::vector<std::string>& sourceKernels,
+   const std::string&              snapshotPath ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      vector     I   The paths of the text kernels to load.
+      string     I   The path of the pool snapshot.
+
+   - Detailed_Input
+
+      sourceKernels  the paths of the text kernels to load, in order.
+      snapshotPath   the path of the pool snapshot.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling. If the
+   snapshot cannot be written, an error is reported, but since the kernels
+   have been loaded the function still returns true.
+
+   - Particulars
+
+      The time taken to load the kernels is reported either way, which makes
+   it straightforward to compare the two paths.
+
+   - Literature_References
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   auto start = std::chrono::steady_clock::now();
+   auto elapsedMilliseconds = [&start]() -> double {
+      /*
+      - Detailed_Output
+
+         Returns the number of milliseconds since start.
+
+      - Version
+
+         Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+      */
+      return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start )
+         .count();
+   };
+
+   /*
+   If the snapshot is current, we're done.
+   */
+   if ( restorePoolSnapshot( sourceKernels, snapshotPath ) ) {
+      std::cout << "Restored the kernel pool from '" << snapshotPath
+                << "' in " << elapsedMilliseconds() << " ms." << std::endl;
+      return true;
+   }
+
+   /*
+   Otherwise, furnish the kernels as usual and take a new snapshot.
+   */
+   for ( auto& kernel : sourceKernels ) {
+      furnishKernel( kernel );
+   }
+   std::cout << "Furnished " << sourceKernels.size() << " text kernels in "
+             << elapsedMilliseconds() << " ms." << std::endl;
+
+   writePoolSnapshot( sourceKernels, snapshotPath );
+   return true;
+}
+/*
+The pool variables which have been resolved to handles. A handle is just an
+index into this registry.
+*/
+struct PoolHandleEntry {
+   std::string              Name;
+   std::string              Agent;
+   std::vector<SpiceDouble> Values;
+   bool                     Found;
+};
+static std::vector<PoolHandleEntry> poolHandles;
+
+/*
+This function resolves a numeric kernel pool variable to a handle. The
+variable doesn't need to exist yet.
+*/
+cppspice::PoolHandle cppspice::getPoolHandle(
+   const std::string& variableName ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the pool variable.
+
+   - Detailed_Input
+
+      variableName   the name of a numeric kernel pool variable.
+
+   - Detailed_Output
+
+      Returns a handle which can be used with readPoolHandle. Resolving the
+   same variable twice returns the same handle.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Particulars
+
+      Each handle registers its own watcher agent with swpool_c. The pool
+   notifies the agent whenever the variable is added, changed, or deleted,
+   which is how readPoolHandle knows when its copy of the values is stale.
+
+   - Literature_References
+
+      CSPICE's documentation for swpool_c and cvpool_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   for ( size_t i = 0; i < poolHandles.size(); i++ ) {
+      if ( poolHandles[i].Name == variableName ) {
+         return static_cast<PoolHandle>( i );
+      }
+   }
+
+   PoolHandleEntry entry;
+   entry.Name  = variableName;
+   entry.Agent = POOLAGENTPREFIX + std::to_string( poolHandles.size() );
+   entry.Found = false;
+
+   /*
+   swpool_c flags the agent as needing an update, so the values will be
+   retrieved on the first read.
+   */
+   SpiceChar name[1][POOLNAMELEN];
+   variableName.copy( name[0], POOLNAMELEN - 1 );
+   name[0][std::min<size_t>( variableName.size(), POOLNAMELEN - 1 )] = '\0';
+   swpool_c( entry.Agent.c_str(), 1, POOLNAMELEN, name );
+
+   poolHandles.push_back( entry );
+   return static_cast<PoolHandle>( poolHandles.size() - 1 );
+}
+
+/*
+This function resolves a body constant, such as a body's RADII, to a handle.
+A handle of -1 is returned if the body is not recognized.
+*/
+cppspice::PoolHandle cppspice::getBodyConstantHandle(
+   const std::string& bodyName,
+   const std::string& item ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the body.
+      string     I   The item to retrieve, e.g. "RADII".
+
+   - Detailed_Input
+
+      bodyName the name of the body, as would be passed to bodvrd_c.
+      item     the item to retrieve, as would be passed to bodvrd_c.
+
+   - Detailed_Output
+
+      Returns a handle to the BODY<ID>_<ITEM> pool variable, or -1 if the
+   body's NAIF ID could not be determined.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and -1 is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt     code{ 0 };
+   SpiceBoolean found{ false };
+   bods2c_c( bodyName.c_str(), &code, &found );
+   if ( !found ) {
+      std::cout
+         << "Error: couldn't find an NAIF ID for the specified object '"
+         << bodyName << "'." << std::endl;
+      return -1;
+   }
+
+   return getPoolHandle( "BODY" + std::to_string( code ) + "_" + item );
+}
+
+/*
+This function reads the values of a pool variable through its handle. The
+values are only retrieved from the pool again if it has changed.
+*/
+bool cppspice::readPoolHandle(
+   const PoolHandle handle,
+   const SpiceInt   room,
+   SpiceInt&        n,
+   SpiceDouble*     values ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      PoolHandle    I   The handle of the pool variable.
+      SpiceInt      I   The maximum number of values to return.
+      SpiceInt      O   The number of values returned.
+      SpiceDouble*  O   The values.
+
+   - Detailed_Input
+
+      handle   a handle returned by getPoolHandle or getBodyConstantHandle.
+      room     the maximum number of values to return.
+
+   - Detailed_Output
+
+      n        the number of values returned, which is the smaller of room
+               and the number of values of the variable.
+      values   the values of the variable.
+
+      The function returns true if the variable exists and is numeric.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Checking for changes is a single cvpool_c call on the handle's agent,
+   so in the common case this involves no name construction, hashing, or
+   pool lookup.
+
+   - Literature_References
+
+      CSPICE's documentation for cvpool_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( handle < 0 ||
+        handle >= static_cast<PoolHandle>( poolHandles.size() ) )
+   {
+      std::cout << "Error: the pool handle " << handle << " is not valid."
+                << std::endl;
+      return false;
+   }
+
+   /*
+   If the pool has changed, refresh our copy of the values.
+   */
+   auto&        entry = poolHandles[handle];
+   SpiceBoolean update{ false };
+   cvpool_c( entry.Agent.c_str(), &update );
+   if ( update ) {
+      SpiceBoolean found{ false };
+      SpiceInt     count{ 0 };
+      SpiceChar    type[1];
+      dtpool_c( entry.Name.c_str(), &found, &count, type );
+      entry.Found = found && type[0] == 'N';
+      entry.Values.resize( entry.Found ? count : 0 );
+      if ( entry.Found ) {
+         gdpool_c(
+            entry.Name.c_str(),
+            0,
+            count,
+            &count,
+            entry.Values.data(),
+            &found );
+      }
+   }
+
+   if ( !entry.Found ) {
+      std::cout << "Error: the kernel pool variable '" << entry.Name
+                << "' could not be found." << std::endl;
+      return false;
+   }
+
+   n = std::min( room, static_cast<SpiceInt>( entry.Values.size() ) );
+   std::copy( entry.Values.begin(), entry.Values.begin() + n, values );
+   return true;
+}
+
+/*
+This function furnishes a kernel, recording the change to the loaded
+kernels.
+*/
+void cppspice::furnishKernel( const std::string& path ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The path of the kernel.
+
+   - Detailed_Input
+
+      path     the path of the kernel, as would be passed to furnsh_c.
+
+   - Detailed_Output
+
+      None.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   furnsh_c( path.c_str() );
+   kernelGeneration++;
+}
+
+/*
+This function unloads a kernel, recording the change to the loaded kernels.
+*/
+void cppspice::unloadKernel( const std::string& path ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The path of the kernel.
+
+   - Detailed_Input
+
+      path     the path of the kernel, as would be passed to unload_c.
+
+   - Detailed_Output
+
+      None.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   unload_c( path.c_str() );
+   kernelGeneration++;
+}
+
+/*
+This function returns the number of times the set of loaded kernels has
+changed.
+*/
+long long cppspice::getKernelGeneration() {
+   return kernelGeneration;
+}
+/* End KernelUtils.cpp */
@@ -0,0 +1,168 @@
+// clang-format off
+/*
+
+- Header_File KernelUtils.hpp (Kernel utility code)
+
+- Abstract
+
+   Define utility functions which operate on the kernels furnished to this
+   program, rather than on the data which they contain.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   DAF
+   KERNEL
+   NAIF_IDS
+   POOL
+   SPK
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   manage the furnished kernels. This includes writing compact SPK subsets
+   containing only the data that a particular simulation requires, binary
+   snapshots of the kernel pool which can be restored much faster than the
+   text kernels can be parsed, and handles for reading pool variables
+   repeatedly without any string handling.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes and the vector header for this file.
+*/
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   This function writes a new SPK which contains only the segments, and only
+   the portions of those segments, which are required to evaluate the
+   participants of the simulation over its time span.
+   */
+   bool writeSubsetKernel(
+      const SimulationData& data,
+      const std::string&    outputPath );
+
+   /*
+   This function checks that a subset kernel gives the same states as the
+   currently furnished SPKs for all of the simulation's participants.
+   */
+   bool validateSubsetKernel(
+      const SimulationData& data,
+      const std::string&    subsetPath );
+
+   /*
+   This function swaps the furnished SPKs for a subset kernel, so that the
+   simulation reads its states from the subset alone.
+   */
+   void furnishSubsetKernel( const std::string& subsetPath );
+
+   /*
+   This function writes the current contents of the kernel pool to a binary
+   snapshot, tagged with the text kernels which produced them.
+   */
+   bool writePoolSnapshot(
+      const std::vector<std::string>& sourceKernels,
+      const std::string&              snapshotPath );
+
+   /*
+   This function restores the kernel pool from a binary snapshot. If the
+   snapshot is missing or was produced from different text kernels, nothing
+   is restored and false is returned.
+   */
+   bool restorePoolSnapshot(
+      const std::vector<std::string>& sourceKernels,
+      const std::string&              snapshotPath );
+
+   /*
+   This function loads text kernels into the kernel pool, using the binary
+   snapshot if it is current, and otherwise furnishing the kernels and then
+   writing a new snapshot.
+   */
+   bool furnishTextKernels(
+      const std::vector<std::string>& sourceKernels,
+      const std::string&              snapshotPath );
+
+   /*
+   An opaque handle to a numeric kernel pool variable. Reading through a
+   handle avoids the name resolution and pool lookup of bodvrd_c.
+   */
+   using PoolHandle = SpiceInt;
+
+   /*
+   This function resolves a numeric kernel pool variable to a handle. The
+   variable doesn't need to exist yet.
+   */
+   PoolHandle getPoolHandle( const std::string& variableName );
+
+   /*
+   This function resolves a body constant, such as a body's RADII, to a
+   handle. A handle of -1 is returned if the body is not recognized.
+   */
+   PoolHandle getBodyConstantHandle(
+      const std::string& bodyName,
+      const std::string& item );
+
+   /*
+   This function reads the values of a pool variable through its handle.
+   The values are only retrieved from the pool again if it has changed.
+   */
+   bool readPoolHandle(
+      const PoolHandle handle,
+      const SpiceInt   room,
+      SpiceInt&        n,
+      SpiceDouble*     values );
+
+   /*
+   This function furnishes a kernel. Kernels should be loaded and unloaded
+   through these functions so that cached data derived from the loaded
+   kernels can be invalidated.
+   */
+   void furnishKernel( const std::string& path );
+
+   /*
+   This function unloads a kernel.
+   */
+   void unloadKernel( const std::string& path );
+
+   /*
+   The number of times the set of loaded kernels has changed, either through
+   the functions above or by restoring a pool snapshot.
+   */
+   long long getKernelGeneration();
+}   // namespace cppspice
+    /* End KernelUtils.hpp */
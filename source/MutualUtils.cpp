@@ -0,0 +1,896 @@
+// clang-format off
+/*
+
+- Source_File MutualUtils.cpp (Mutual event utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (MutualUtils.hpp).
+
+   The bodies are placed with light time corrected states from the center
+   of the observer, so an occultation is found as the observer sees it.
+   The measure of a pair is the angular separation of their centers, less
+   the sum of their angular radii, which is negative while one overlaps
+   the other.
+
+   An eclipse is found as the observer sees it as well: the body behind is
+   taken at the epoch at which the observer sees it, and the body in front
+   and the Sun are placed with light time corrected states from it, at that
+   epoch. The penumbra of the body in front is a cone, with its vertex
+   between the body and the Sun, which is tangent to both. Seen from this
+   vertex, the penumbra is a disk of the cone's half angle, and the measure
+   of the pair is taken from it just as for an occultation. The states of
+   the system only serve to pick out the pairs, so every eclipse measure
+   is found from the states of its own pair.
+
+   Seen from a vertex, a body's disk throughout a step is held by the disk
+   about the middle of the directions at the ends of the step which reaches
+   both of them, widened by the body's angular radius, and by the farthest
+   that its path could bend away from the chord between them. The bend is
+   bounded by the change in the body's velocity relative to the vertex
+   over the step, times MUTUALPATHPAD for safety. Seen from the Sun, the
+   disks are widened further, by the growth of the penumbra across the
+   depth of the system, and by the farthest that a body can move over the
+   light time across it, since the bodies are seen where the observer sees
+   them rather than where the light which reaches the body behind passed
+   them.
+
+   The measure of a pair which is apart at both ends of a step can't fall
+   by more than the lengths of the two paths, so an occultation can be
+   ruled out from the measures at the ends alone. Otherwise, the measure's
+   one minimum within the step is sought by golden section, until the
+   measure turns negative or MUTUALMINIMUMSTEPS steps are taken. Each
+   start and stop is bracketed and found with the Illinois method, to the
+   tolerance.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, algorithm and cmath for the arithmetic,
+chrono for timing, fstream for the output file, map for the events which
+are under way, and the ephemeris and kernel utilities to place the bodies.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <map>
+
+#include "EphemerisUtils.hpp"
+#include "KernelUtils.hpp"
+#include "MutualUtils.hpp"
+
+/*
+A body at an epoch: its light time corrected state relative to the
+observer, and its mean radius.
+*/
+struct MutualBody {
+   SpiceDouble Position[3];
+   SpiceDouble Velocity[3];
+   SpiceDouble Radius;
+};
+
+/*
+The bodies of the system at an epoch, with the Sun last.
+*/
+struct MutualSystem {
+   SpiceDouble             Epoch;
+   std::vector<MutualBody> Bodies;
+};
+
+/*
+A disk's place in the sweep: the bounds of its projection onto the axis.
+*/
+struct SweepEntry {
+   SpiceDouble Low;
+   SpiceDouble High;
+   SpiceInt    Disk;
+};
+
+/*
+This is a helper which places bodies relative to the observer at an epoch.
+*/
+static bool getMutualSystem(
+   const std::vector<SpiceInt>&    bodyIDs,
+   const std::vector<SpiceDouble>& radii,
+   const SpiceDouble               epoch,
+   const SpiceInt                  observerID,
+   cppspice::LightTimeCache&       lightTimes,
+   MutualSystem&                   system ) {
+   std::vector<cppspice::BodyState> states;
+   if ( !cppspice::getMultiBodyStates(
+           bodyIDs,
+           epoch,
+           observerID,
+           lightTimes,
+           states ) )
+   {
+      return false;
+   }
+   system.Epoch = epoch;
+   system.Bodies.resize( bodyIDs.size() );
+   for ( size_t k = 0; k < bodyIDs.size(); k++ ) {
+      MutualBody& body = system.Bodies[k];
+      vequ_c( &states[k].State[0], body.Position );
+      vequ_c( &states[k].State[3], body.Velocity );
+      body.Radius = radii[k];
+   }
+   return true;
+}
+
+/*
+This is a helper which measures a pair of bodies for an occultation.
+*/
+static SpiceDouble getOccultationMeasure(
+   const MutualBody& front,
+   const MutualBody& back ) {
+   SpiceDouble frontDistance = vnorm_c( front.Position );
+   SpiceDouble backDistance  = vnorm_c( back.Position );
+   return vsep_c( front.Position, back.Position ) -
+          asin( std::min( 1.0, front.Radius / frontDistance ) ) -
+          asin( std::min( 1.0, back.Radius / backDistance ) );
+}
+
+/*
+This is a helper which measures a pair of bodies for an eclipse of the
+body behind, as the observer sees it at an epoch. The radii are those of
+the body in front, the body behind, and the Sun.
+*/
+static bool getEclipseMeasure(
+   const SpiceInt            frontID,
+   const SpiceInt            backID,
+   const SpiceInt            sunID,
+   const SpiceDouble         radii[3],
+   const SpiceDouble         epoch,
+   const SpiceInt            observerID,
+   cppspice::LightTimeCache& lightTimes,
+   SpiceDouble&              measure ) {
+   std::vector<cppspice::BodyState> back;
+   std::vector<cppspice::BodyState> lights;
+   if ( !cppspice::getMultiBodyStates(
+           { backID },
+           epoch,
+           observerID,
+           lightTimes,
+           back ) ||
+        !cppspice::getMultiBodyStates(
+           { frontID, sunID },
+           epoch - back[0].LightTime,
+           backID,
+           lightTimes,
+           lights ) )
+   {
+      return false;
+   }
+
+   /*
+   Seen from the vertex of the penumbra, the penumbra is a disk of the
+   cone's half angle. The body behind is at the origin.
+   */
+   const SpiceDouble* front    = lights[0].State.data();
+   const SpiceDouble* sun      = lights[1].State.data();
+   SpiceDouble        distance = vdist_c( front, sun );
+   SpiceDouble        fraction = radii[0] / ( radii[0] + radii[2] );
+   SpiceDouble        vertex[3];
+   SpiceDouble        toFront[3];
+   SpiceDouble        toBack[3];
+   vlcom_c( 1.0 - fraction, front, fraction, sun, vertex );
+   vsub_c( front, vertex, toFront );
+   vminus_c( vertex, toBack );
+   measure = vsep_c( toFront, toBack ) -
+             asin( std::min( 1.0, ( radii[0] + radii[2] ) / distance ) ) -
+             asin( std::min( 1.0, radii[1] / vnorm_c( toBack ) ) );
+   return true;
+}
+
+/*
+This is a helper which finds the disk which holds a body throughout a
+step, seen from a vertex which moves with the given velocities, and the
+part of its radius which is due to the body's motion. The body's radius
+is widened by the pad first.
+*/
+static void getSweptDisk(
+   const MutualBody&  start,
+   const MutualBody&  end,
+   const SpiceDouble  startVertex[3],
+   const SpiceDouble  endVertex[3],
+   const SpiceDouble  startVelocity[3],
+   const SpiceDouble  endVelocity[3],
+   const SpiceDouble  duration,
+   const SpiceDouble  pad,
+   cppspice::SkyDisk& disk,
+   SpiceDouble&       reach ) {
+   using cppspice::MUTUALPATHPAD;
+   SpiceDouble startDirection[3];
+   SpiceDouble endDirection[3];
+   SpiceDouble startMotion[3];
+   SpiceDouble endMotion[3];
+   SpiceDouble change[3];
+   vsub_c( start.Position, startVertex, startDirection );
+   vsub_c( end.Position, endVertex, endDirection );
+   vsub_c( start.Velocity, startVelocity, startMotion );
+   vsub_c( end.Velocity, endVelocity, endMotion );
+   vsub_c( endMotion, startMotion, change );
+   SpiceDouble distance =
+      std::min( vnorm_c( startDirection ), vnorm_c( endDirection ) );
+   vhat_c( startDirection, startDirection );
+   vhat_c( endDirection, endDirection );
+   vadd_c( startDirection, endDirection, disk.Center );
+   vhat_c( disk.Center, disk.Center );
+   reach = 0.5 * vsep_c( startDirection, endDirection ) +
+           MUTUALPATHPAD * vnorm_c( change ) * duration / ( 8.0 * distance );
+   disk.Radius =
+      reach + asin( std::min( 1.0, ( start.Radius + pad ) / distance ) );
+}
+
+/*
+This function finds the pairs of disks which overlap.
+*/
+void cppspice::findOverlappingDisks(
+   const std::vector<SkyDisk>&                 disks,
+   std::vector<std::pair<SpiceInt, SpiceInt>>& pairs ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      vector     I   The disks.
+      vector     O   The pairs of disks which overlap.
+
+   - Detailed_Input
+
+      disks    the disks on the sky, each of them smaller than a
+               hemisphere.
+
+   - Detailed_Output
+
+      pairs    the pairs of the indices of the disks which overlap, the
+               lesser index first, in no particular order.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The disks are projected onto an axis of the sky, perpendicular to
+   their mean center and towards the disk farthest from it, along which
+   they are spread out the most. Two centers are no farther apart along
+   the axis than they are on the sky, so disks which overlap have
+   projections which overlap as well. The projections are swept in order
+   of their lower bounds, keeping those which the sweep is still within,
+   and only the disks whose projections overlap are compared on the sky.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   pairs.clear();
+   if ( disks.size() < 2 ) {
+      return;
+   }
+
+   SpiceDouble mean[3] = { 0.0, 0.0, 0.0 };
+   for ( const auto& disk : disks ) {
+      vadd_c( mean, disk.Center, mean );
+   }
+   if ( vzero_c( mean ) ) {
+      vequ_c( disks[0].Center, mean );
+   }
+   vhat_c( mean, mean );
+
+   SpiceDouble axis[3] = { 0.0, 0.0, 0.0 };
+   for ( const auto& disk : disks ) {
+      SpiceDouble offset[3];
+      vperp_c( disk.Center, mean, offset );
+      if ( vnorm_c( offset ) > vnorm_c( axis ) ) {
+         vequ_c( offset, axis );
+      }
+   }
+   if ( vzero_c( axis ) ) {
+      SpiceDouble reference[3] = { 1.0, 0.0, 0.0 };
+      if ( std::abs( mean[0] ) > 0.5 ) {
+         reference[0] = 0.0;
+         reference[1] = 1.0;
+      }
+      vperp_c( reference, mean, axis );
+   }
+   vhat_c( axis, axis );
+
+   std::vector<SweepEntry> entries;
+   entries.reserve( disks.size() );
+   for ( size_t k = 0; k < disks.size(); k++ ) {
+      SpiceDouble place = vdot_c( disks[k].Center, axis );
+      entries.push_back( { place - disks[k].Radius,
+                           place + disks[k].Radius,
+                           static_cast<SpiceInt>( k ) } );
+   }
+   std::sort(
+      entries.begin(),
+      entries.end(),
+      []( const SweepEntry& left, const SweepEntry& right ) {
+         return left.Low < right.Low;
+      } );
+
+   std::vector<SweepEntry> active;
+   for ( const auto& entry : entries ) {
+      active.erase(
+         std::remove_if(
+            active.begin(),
+            active.end(),
+            [&entry]( const SweepEntry& other ) {
+               return other.High < entry.Low;
+            } ),
+         active.end() );
+      for ( const auto& other : active ) {
+         const SkyDisk& left  = disks[other.Disk];
+         const SkyDisk& right = disks[entry.Disk];
+         if ( vsep_c( left.Center, right.Center ) <=
+              left.Radius + right.Radius )
+         {
+            pairs.push_back( std::make_pair(
+               std::min( other.Disk, entry.Disk ),
+               std::max( other.Disk, entry.Disk ) ) );
+         }
+      }
+      active.push_back( entry );
+   }
+}
+
+/*
+This function searches for the mutual events among the bodies of a
+satellite system.
+*/
+bool cppspice::findMutualEvents( const SimulationData& data ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+
+   - Detailed_Input
+
+      data     the simulation data, of which the observer, the span, the
+               tolerance, and the mutual event settings are used:
+
+                  MutualBodies  The names of the bodies of the system.
+                  MutualStep    The coarse step in seconds, MUTUALSTEP
+                                if zero.
+                  MutualOutput  The path of the file to write, or empty
+                                to report to the console.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered. Each event
+   is reported with its kind, its two bodies, and its start and stop, in
+   order of start, and a summary of the search follows.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      An event which is under way at either end of the span is cut off
+   there. The pairs which were under way at the start of a step are always
+   measured, so that their ends are found even if their disks have moved
+   apart by the end of it.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt     sunID{ 0 };
+   SpiceInt     observerID{ 0 };
+   SpiceBoolean sunFound{ SPICEFALSE };
+   SpiceBoolean observerFound{ SPICEFALSE };
+   bodn2c_c( "SUN", &sunID, &sunFound );
+   bodn2c_c( data.ObserverName.c_str(), &observerID, &observerFound );
+   if ( !sunFound || !observerFound ) {
+      std::cout << "Error: the participants of the mutual event search "
+                   "could not be resolved."
+                << std::endl;
+      return false;
+   }
+
+   /*
+   The Sun follows the bodies of the system, and every one of them needs a
+   radius.
+   */
+   std::vector<std::string> names = data.MutualBodies;
+   names.push_back( "SUN" );
+   std::vector<SpiceInt>    bodyIDs;
+   std::vector<SpiceDouble> radii;
+   for ( const auto& name : names ) {
+      SpiceInt     bodyID{ 0 };
+      SpiceBoolean found{ SPICEFALSE };
+      bodn2c_c( name.c_str(), &bodyID, &found );
+      if ( !found || observerID == bodyID ||
+           ( sunID == bodyID && bodyIDs.size() + 1 < names.size() ) )
+      {
+         std::cout << "Error: the body '" << name
+                   << "' can't be part of the mutual event search."
+                   << std::endl;
+         return false;
+      }
+
+      SpiceDouble bodyRadii[3];
+      SpiceInt    n{ 0 };
+      PoolHandle  handle = getBodyConstantHandle( name, "RADII" );
+      if ( handle < 0 || !readPoolHandle( handle, 3, n, bodyRadii ) ||
+           n != 3 )
+      {
+         std::cout << "Error: unable to read the radii of '" << name
+                   << "'." << std::endl;
+         return false;
+      }
+      bodyIDs.push_back( bodyID );
+      radii.push_back( ( bodyRadii[0] + bodyRadii[1] + bodyRadii[2] ) / 3.0 );
+   }
+   SpiceInt count = static_cast<SpiceInt>( data.MutualBodies.size() );
+
+   SpiceDouble lowerEpoch{ 0.0 };
+   SpiceDouble upperEpoch{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpoch );
+   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpoch );
+   SpiceDouble stepSize =
+      data.MutualStep > 0.0 ? data.MutualStep : MUTUALSTEP;
+   SpiceDouble tolerance = data.Tolerance;
+
+   using PairKey = std::tuple<MutualKind, SpiceInt, SpiceInt>;
+   auto start = std::chrono::steady_clock::now();
+
+   LightTimeCache                             lightTimes;
+   MutualSystem                               systems[2];
+   std::vector<SkyDisk>                       disks( count );
+   std::vector<SpiceDouble>                   reaches( count );
+   std::vector<std::pair<SpiceInt, SpiceInt>> pairs;
+   std::map<PairKey, MutualEvent>             underway;
+   std::vector<MutualEvent>                   events;
+   long long                                  steps{ 0 };
+   long long                                  candidateCount{ 0 };
+   long long                                  crossings{ 0 };
+   long long                                  exactMeasures{ 0 };
+
+   if ( !getMutualSystem(
+           bodyIDs,
+           radii,
+           lowerEpoch,
+           observerID,
+           lightTimes,
+           systems[0] ) )
+   {
+      return false;
+   }
+   for ( SpiceDouble epoch = lowerEpoch; epoch < upperEpoch;
+         epoch += stepSize )
+   {
+      /*
+      The start of this step is the end of the last.
+      */
+      if ( !getMutualSystem(
+              bodyIDs,
+              radii,
+              std::min( upperEpoch, epoch + stepSize ),
+              observerID,
+              lightTimes,
+              systems[1] ) )
+      {
+         return false;
+      }
+      const MutualSystem& first    = systems[0];
+      const MutualSystem& last     = systems[1];
+      const MutualBody&   firstSun = first.Bodies[count];
+      const MutualBody&   lastSun  = last.Bodies[count];
+      SpiceDouble         duration = last.Epoch - first.Epoch;
+      steps++;
+
+      /*
+      Seen from the Sun, the penumbra of a body widens by the Sun's
+      angular radius, seen from the body, across the depth of the system,
+      and a body moves by up to its speed over the light time across it.
+      The depth is bounded by twice the distance of the farthest body from
+      the first.
+      */
+      SpiceDouble depth{ 0.0 };
+      SpiceDouble nearest{ 0.0 };
+      SpiceDouble largest{ 0.0 };
+      SpiceDouble fastest{ 0.0 };
+      for ( const MutualSystem* system : { &first, &last } ) {
+         const MutualBody& sun = system->Bodies[count];
+         for ( SpiceInt k = 0; k < count; k++ ) {
+            const MutualBody& body = system->Bodies[k];
+            const MutualBody& lead = system->Bodies[0];
+
+            SpiceDouble motion[3];
+            vsub_c( body.Velocity, sun.Velocity, motion );
+            SpiceDouble fromSun  = vdist_c( body.Position, sun.Position );
+            SpiceDouble fromLead = vdist_c( body.Position, lead.Position );
+            depth   = std::max( depth, 2.0 * fromLead );
+            nearest = nearest > 0.0 ? std::min( nearest, fromSun ) : fromSun;
+            largest = std::max( largest, body.Radius );
+            fastest = std::max( fastest, vnorm_c( motion ) );
+         }
+      }
+      SpiceDouble sunPad = depth * ( firstSun.Radius + largest ) / nearest +
+                           2.0 * fastest * depth / clight_c();
+
+      for ( MutualKind kind :
+            { MutualKind::OCCULTATION, MutualKind::ECLIPSE } )
+      {
+         /*
+         Sweep the disks of the bodies, seen from the observer or from
+         the Sun, and add the pairs which were under way.
+         */
+         bool              eclipse = kind == MutualKind::ECLIPSE;
+         const SpiceDouble origin[3] = { 0.0, 0.0, 0.0 };
+         for ( SpiceInt k = 0; k < count; k++ ) {
+            getSweptDisk(
+               first.Bodies[k],
+               last.Bodies[k],
+               eclipse ? firstSun.Position : origin,
+               eclipse ? lastSun.Position : origin,
+               eclipse ? firstSun.Velocity : origin,
+               eclipse ? lastSun.Velocity : origin,
+               duration,
+               eclipse ? sunPad : 0.0,
+               disks[k],
+               reaches[k] );
+         }
+         findOverlappingDisks( disks, pairs );
+         std::sort( pairs.begin(), pairs.end() );
+         size_t swept = pairs.size();
+         for ( const auto& event : underway ) {
+            if ( std::get<0>( event.first ) == kind &&
+                 !std::binary_search(
+                    pairs.begin(),
+                    pairs.begin() + swept,
+                    std::make_pair(
+                       std::get<1>( event.first ),
+                       std::get<2>( event.first ) ) ) )
+            {
+               pairs.push_back( std::make_pair(
+                  std::get<1>( event.first ),
+                  std::get<2>( event.first ) ) );
+            }
+         }
+         candidateCount += pairs.size();
+
+         for ( const auto& pair : pairs ) {
+            /*
+            The body in front is the one nearer the observer, or the Sun,
+            which can't change while the two overlap.
+            */
+            const SpiceDouble* vertex = eclipse ? firstSun.Position : origin;
+            const SpiceDouble* one    = first.Bodies[pair.first].Position;
+            const SpiceDouble* other  = first.Bodies[pair.second].Position;
+            bool               reversed =
+               vdist_c( other, vertex ) < vdist_c( one, vertex );
+            SpiceInt front = reversed ? pair.second : pair.first;
+            SpiceInt back  = reversed ? pair.first : pair.second;
+
+            SpiceDouble pairRadii[3] = { radii[front],
+                                         radii[back],
+                                         radii[count] };
+
+            /*
+            This measures the pair at an epoch, with the states of its own
+            bodies.
+            */
+            auto measure = [&]( const SpiceDouble instant,
+                                SpiceDouble&      value ) -> bool {
+               exactMeasures++;
+               if ( eclipse ) {
+                  return getEclipseMeasure(
+                     bodyIDs[front],
+                     bodyIDs[back],
+                     sunID,
+                     pairRadii,
+                     instant,
+                     observerID,
+                     lightTimes,
+                     value );
+               }
+               MutualSystem pairSystem;
+               if ( !getMutualSystem(
+                       { bodyIDs[front], bodyIDs[back] },
+                       { radii[front], radii[back] },
+                       instant,
+                       observerID,
+                       lightTimes,
+                       pairSystem ) )
+               {
+                  return false;
+               }
+               value = getOccultationMeasure(
+                  pairSystem.Bodies[0],
+                  pairSystem.Bodies[1] );
+               return true;
+            };
+
+            /*
+            An occultation is measured from the states of the system at the
+            ends of the step, but an eclipse needs those of its pair.
+            */
+            SpiceDouble lower{ 0.0 };
+            SpiceDouble upper{ 0.0 };
+            if ( !eclipse ) {
+               lower = getOccultationMeasure(
+                  first.Bodies[front],
+                  first.Bodies[back] );
+               upper = getOccultationMeasure(
+                  last.Bodies[front],
+                  last.Bodies[back] );
+            }
+            else if ( !measure( first.Epoch, lower ) ||
+                      !measure( last.Epoch, upper ) )
+            {
+               return false;
+            }
+            PairKey key = std::make_tuple( kind, pair.first, pair.second );
+            auto    ongoing = underway.find( key );
+            bool    startIn = ongoing != underway.end() || lower < 0.0;
+            bool    endIn   = upper < 0.0;
+            MutualEvent event{ kind,
+                               bodyIDs[front],
+                               bodyIDs[back],
+                               first.Epoch,
+                               last.Epoch };
+
+            /*
+            This finds a crossing within a bracket, with the Illinois
+            method.
+            */
+            auto findCrossing = [&]( SpiceDouble  a,
+                                     SpiceDouble  fa,
+                                     SpiceDouble  b,
+                                     SpiceDouble  fb,
+                                     SpiceDouble& crossing ) -> bool {
+               SpiceInt side{ 0 };
+               crossing = a;
+               crossings++;
+               for ( SpiceInt k = 0; k < ITERLIMIT && b - a > tolerance;
+                     k++ )
+               {
+                  SpiceDouble fc{ 0.0 };
+                  crossing = ( a * fb - b * fa ) / ( fb - fa );
+                  if ( !measure( crossing, fc ) ) {
+                     return false;
+                  }
+                  if ( ( fc < 0.0 ) == ( fa < 0.0 ) ) {
+                     a  = crossing;
+                     fa = fc;
+                     if ( side == -1 ) {
+                        fb *= 0.5;
+                     }
+                     side = -1;
+                  }
+                  else {
+                     b  = crossing;
+                     fb = fc;
+                     if ( side == 1 ) {
+                        fa *= 0.5;
+                     }
+                     side = 1;
+                  }
+               }
+               return true;
+            };
+
+            /*
+            Where the pair is apart at both ends of the step, an
+            occultation can't happen unless the measure could fall below
+            zero over the lengths of the two paths. Otherwise, the
+            measure's one minimum within the step tells whether the pair
+            met in between.
+            */
+            if ( !startIn && !endIn ) {
+               if ( !eclipse && 0.5 * ( lower + upper ) >
+                                   reaches[front] + reaches[back] )
+               {
+                  continue;
+               }
+               SpiceDouble ratio = 0.5 * ( sqrt( 5.0 ) - 1.0 );
+               SpiceDouble left  = first.Epoch;
+               SpiceDouble right = last.Epoch;
+               SpiceDouble inner = right - ratio * ( right - left );
+               SpiceDouble outer = left + ratio * ( right - left );
+               SpiceDouble innerMeasure{ 0.0 };
+               SpiceDouble outerMeasure{ 0.0 };
+               if ( !measure( inner, innerMeasure ) ||
+                    !measure( outer, outerMeasure ) )
+               {
+                  return false;
+               }
+               for ( SpiceInt k = 0;
+                     k < MUTUALMINIMUMSTEPS && innerMeasure >= 0.0 &&
+                     outerMeasure >= 0.0;
+                     k++ )
+               {
+                  if ( innerMeasure < outerMeasure ) {
+                     right        = outer;
+                     outer        = inner;
+                     outerMeasure = innerMeasure;
+                     inner        = right - ratio * ( right - left );
+                     if ( !measure( inner, innerMeasure ) ) {
+                        return false;
+                     }
+                  }
+                  else {
+                     left         = inner;
+                     inner        = outer;
+                     innerMeasure = outerMeasure;
+                     outer        = left + ratio * ( right - left );
+                     if ( !measure( outer, outerMeasure ) ) {
+                        return false;
+                     }
+                  }
+               }
+               SpiceDouble lowest =
+                  innerMeasure < outerMeasure ? inner : outer;
+               SpiceDouble lowestMeasure =
+                  std::min( innerMeasure, outerMeasure );
+               if ( lowestMeasure < 0.0 ) {
+                  if ( !findCrossing(
+                          first.Epoch,
+                          lower,
+                          lowest,
+                          lowestMeasure,
+                          event.Start ) ||
+                       !findCrossing(
+                          lowest,
+                          lowestMeasure,
+                          last.Epoch,
+                          upper,
+                          event.Stop ) )
+                  {
+                     return false;
+                  }
+                  events.push_back( event );
+               }
+            }
+            else if ( !startIn ) {
+               if ( !findCrossing(
+                       first.Epoch,
+                       lower,
+                       last.Epoch,
+                       upper,
+                       event.Start ) )
+               {
+                  return false;
+               }
+               underway[key] = event;
+            }
+            else if ( !endIn ) {
+               /*
+               A pair which the last step left under way, but whose
+               measure has risen above zero by the start of this one,
+               parted at the start.
+               */
+               event.Stop = first.Epoch;
+               if ( lower < 0.0 && !findCrossing(
+                                      first.Epoch,
+                                      lower,
+                                      last.Epoch,
+                                      upper,
+                                      event.Stop ) )
+               {
+                  return false;
+               }
+               if ( ongoing != underway.end() ) {
+                  event.Start = ongoing->second.Start;
+                  underway.erase( ongoing );
+               }
+               events.push_back( event );
+            }
+            else if ( ongoing == underway.end() ) {
+               underway[key] = event;
+            }
+         }
+      }
+      std::swap( systems[0], systems[1] );
+   }
+
+   /*
+   The events which are still under way are cut off at the end of the
+   span.
+   */
+   for ( const auto& event : underway ) {
+      events.push_back( event.second );
+      events.back().Stop = upperEpoch;
+   }
+   std::sort(
+      events.begin(),
+      events.end(),
+      []( const MutualEvent& left, const MutualEvent& right ) {
+         return left.Start < right.Start;
+      } );
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   std::ofstream file;
+   if ( !data.MutualOutput.empty() ) {
+      file.open( data.MutualOutput );
+      if ( !file ) {
+         std::cout << "Error: unable to open '" << data.MutualOutput
+                   << "' for the mutual events." << std::endl;
+         return false;
+      }
+   }
+   std::ostream& out = data.MutualOutput.empty() ? std::cout : file;
+   SpiceChar     beginEpoch[TIMELEN];
+   SpiceChar     endEpoch[TIMELEN];
+   long long     eclipses{ 0 };
+   for ( const auto& event : events ) {
+      auto occulter =
+         std::find( bodyIDs.begin(), bodyIDs.end(), event.Occulter );
+      auto target =
+         std::find( bodyIDs.begin(), bodyIDs.end(), event.Target );
+      bool eclipse = event.Kind == MutualKind::ECLIPSE;
+      eclipses += eclipse ? 1 : 0;
+      timout_c( event.Start, TIMEFORMAT, TIMELEN, beginEpoch );
+      timout_c( event.Stop, TIMEFORMAT, TIMELEN, endEpoch );
+      out << names[occulter - bodyIDs.begin()]
+          << ( eclipse ? " eclipses " : " occults " )
+          << names[target - bodyIDs.begin()] << std::endl;
+      out << "   Start time: " << beginEpoch << std::endl;
+      out << "   Stop time:  " << endEpoch << std::endl;
+   }
+
+   std::cout << "Mutual events: " << events.size() - eclipses
+             << " occultations and " << eclipses << " eclipses among "
+             << count << " bodies over " << steps << " steps, with "
+             << candidateCount << " candidate pairs, " << crossings
+             << " crossings, and " << exactMeasures
+             << " exact measures, in " << elapsed.count() << " s."
+             << std::endl;
+   return true;
+}
+/* End MutualUtils.cpp */
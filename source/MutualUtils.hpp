@@ -0,0 +1,122 @@
+// clang-format off
+/*
+
+- Header_File MutualUtils.hpp (Mutual event utility code)
+
+- Abstract
+
+   Define utility functions which search for the mutual occultations and
+   eclipses among the bodies of a satellite system.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   search for mutual events. One body occults another when it hides part
+   of it from the observer, and eclipses it when its penumbra falls on it.
+   An event runs from its first contact to its last.
+
+   Among N bodies there are N(N - 1) / 2 pairs, and searching each pair on
+   its own would evaluate the ephemeris of the system once for every one of
+   them. Instead, the states of all of the bodies, and of the Sun, are
+   found once at the end of every coarse step. The disks which the bodies
+   sweep across the sky within the step, seen from the observer for
+   occultations and from the Sun for eclipses, are then swept along one
+   axis of the sky, which picks out the pairs that can meet within the step
+   without comparing every pair. Only these pairs are refined, with the
+   states of their own two bodies, and the events of every pair come out
+   as one stream, in order of their start.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   The bodies are taken as spheres of their mean radius. The coarse step
+   must be short next to the orbital period of the fastest body, so that
+   each body's path within a step is nearly straight.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes, plus utility and vector for the pairs.
+*/
+#include <utility>
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   A mutual event is either an occultation, where one body hides another
+   from the observer, or an eclipse, where it shades another from the Sun.
+   */
+   enum class MutualKind : int {
+      OCCULTATION,
+      ECLIPSE
+   };
+
+   /*
+   A mutual event, by its kind, the NAIF IDs of the body in front and of
+   the body behind it, and its start and stop.
+   */
+   struct MutualEvent {
+      MutualKind  Kind;
+      SpiceInt    Occulter;
+      SpiceInt    Target;
+      SpiceDouble Start;
+      SpiceDouble Stop;
+   };
+
+   /*
+   A disk on the sky, by the J2000 unit vector of its center and its radius
+   in radians.
+   */
+   struct SkyDisk {
+      SpiceDouble Center[3];
+      SpiceDouble Radius;
+   };
+
+   /*
+   This function finds the pairs of disks which overlap, by sweeping them
+   along one axis of the sky. Each pair is given by the indices of its two
+   disks, the lesser first.
+   */
+   void findOverlappingDisks(
+      const std::vector<SkyDisk>&                 disks,
+      std::vector<std::pair<SpiceInt, SpiceInt>>& pairs );
+
+   /*
+   This function searches the simulation's span for the mutual events among
+   its MutualBodies, and reports them, or writes them to its MutualOutput
+   file.
+   */
+   bool findMutualEvents( const SimulationData& data );
+}   // namespace cppspice
+    /* End MutualUtils.hpp */
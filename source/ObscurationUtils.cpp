@@ -0,0 +1,577 @@
+// clang-format off
+/*
+
+- Source_File ObscurationUtils.cpp (Obscuration utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (ObscurationUtils.hpp).
+
+   With R and r the apparent radii of the target and occulter, and d the
+   separation of their centers, the area of the target's disk which the
+   occulter covers is
+
+      R^2 acos( a ) + r^2 acos( b ) - sqrt( k ) / 2
+
+   where a = ( d^2 + R^2 - r^2 ) / ( 2 d R ), b = ( d^2 + r^2 - R^2 ) /
+   ( 2 d r ), and k = ( -d + R + r ) ( d + R - r ) ( d - R + r ) ( d + R +
+   r ). When the disks are apart, a and b are at least one and k is at most
+   zero, and when one disk is inside the other, one of a and b is at most
+   minus one, the other at least one, and k is again at most zero. So, with
+   a and b clamped to [-1, 1] and k to at least zero, the same expression
+   holds for every separation, and needs no branches.
+
+   The same is true of the arc of a ring of radius p about the target's
+   center which lies within the occulter, which is 2 acos( c ) with
+   c = ( p^2 + d^2 - r^2 ) / ( 2 p d ).
+
+   The arccosine is evaluated with the polynomial of Abramowitz and Stegun,
+   whose error is within 2e-8 radians, since the library's isn't vectorized.
+
+- Literature_References
+
+   Allen, C.W., "Astrophysical Quantities", 3rd ed., Athlone Press, 1973.
+
+   Abramowitz, M., and Stegun, I.A., "Handbook of Mathematical Functions",
+   1964.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, chrono for timing, cmath for the disk
+geometry and the sample counts, cstdint and fstream for the output file, and
+the ephemeris and occultation utilities to find the events and place the
+bodies.
+*/
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
+#include "EphemerisUtils.hpp"
+#include "KernelUtils.hpp"
+#include "ObscurationUtils.hpp"
+#include "OccultationUtils.hpp"
+
+/*
+The radii of the rings of a limb darkened disk, as fractions of its radius,
+and the weight of each in the part of the disk's brightness which varies
+across it. The uniform part has the weight Uniform, and Total is the whole
+disk's light, divided by pi.
+*/
+struct LimbRings {
+   SpiceDouble Radii[cppspice::OBSCURATIONRINGS];
+   SpiceDouble Weights[cppspice::OBSCURATIONRINGS];
+   SpiceDouble Uniform;
+   SpiceDouble Total;
+};
+
+/*
+This is a helper which divides the Sun's disk into rings for its limb
+darkening.
+*/
+static LimbRings getSolarLimbRings() {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        O   The rings.
+
+   - Detailed_Output
+
+      The function returns the rings.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      With mu the cosine of the angle between the line of sight and the
+   normal to the Sun's surface, the brightness relative to the center of
+   the disk is 1 - u - v + u mu + v mu^2, with Allen's coefficients for
+   550 nm, SOLARLIMBU and SOLARLIMBV. The light which the occulter blocks
+   from the constant part is in proportion to the area of the overlap,
+   which is known exactly. Only the rest, which fades to nothing at the
+   limb, is summed over the rings, which are evenly spaced in radius.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::OBSCURATIONRINGS;
+   using cppspice::SOLARLIMBU;
+   using cppspice::SOLARLIMBV;
+   LimbRings rings;
+   rings.Uniform = 1.0 - SOLARLIMBU - SOLARLIMBV;
+   rings.Total   = rings.Uniform;
+   for ( SpiceInt i = 0; i < OBSCURATIONRINGS; i++ ) {
+      SpiceDouble x  = ( i + 0.5 ) / OBSCURATIONRINGS;
+      SpiceDouble mu = sqrt( 1.0 - x * x );
+      rings.Radii[i] = x;
+      rings.Weights[i] =
+         2.0 * x * ( SOLARLIMBU * mu + SOLARLIMBV * mu * mu ) /
+         OBSCURATIONRINGS;
+      rings.Total += rings.Weights[i];
+   }
+   rings.Total *= cppspice::PI;
+   return rings;
+}
+
+/*
+This is a helper which evaluates the arccosine of a value, which is clamped
+to [-1, 1], without branches.
+*/
+static inline SpiceDouble getArccosine( const SpiceDouble value ) {
+   SpiceDouble x = std::min( 1.0, std::abs( value ) );
+   SpiceDouble polynomial =
+      1.5707963050 +
+      x * ( -0.2145988016 +
+            x * ( 0.0889789874 +
+                  x * ( -0.0501743046 +
+                        x * ( 0.0308918810 +
+                              x * ( -0.0170881256 +
+                                    x * ( 0.0066700901 +
+                                          x * -0.0012624911 ) ) ) ) ) );
+   SpiceDouble angle = sqrt( 1.0 - x ) * polynomial;
+   return value < 0.0 ? cppspice::PI - angle : angle;
+}
+
+/*
+This function computes the eclipse magnitude and obscuration of a batch of
+samples.
+*/
+void cppspice::computeObscurations(
+   const SpiceInt     count,
+   const SpiceDouble* separations,
+   const SpiceDouble* targetRadii,
+   const SpiceDouble* occulterRadii,
+   const bool         darkened,
+   SpiceDouble*       magnitudes,
+   SpiceDouble*       obscurations ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceInt      I   The number of samples.
+      SpiceDouble   I   The separation of the centers at each sample.
+      SpiceDouble   I   The apparent radius of the target at each sample.
+      SpiceDouble   I   The apparent radius of the occulter at each sample.
+      bool          I   Whether the target is limb darkened.
+      SpiceDouble   O   The eclipse magnitude at each sample.
+      SpiceDouble   O   The obscuration at each sample.
+
+   - Detailed_Input
+
+      count          the number of samples.
+      separations    the angular separation of the centers of the target
+                     and occulter.
+      targetRadii    the apparent radius of the target, which must be
+                     positive.
+      occulterRadii  the apparent radius of the occulter.
+      darkened       true to weight the target's disk by the Sun's limb
+                     darkening, and false to take it as uniform.
+
+   - Detailed_Output
+
+      magnitudes     the fraction of the target's diameter which is
+   covered, which is zero when the disks are apart and can exceed one.
+      obscurations   the fraction of the target's light which is blocked,
+   between zero and one.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The samples are taken a block of OBSCURATIONLANES at a time, with the
+   last block padded by repeating the last sample.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   static const LimbRings rings = getSolarLimbRings();
+
+   for ( SpiceInt block = 0; block < count; block += OBSCURATIONLANES ) {
+      SpiceDouble d[OBSCURATIONLANES];
+      SpiceDouble big[OBSCURATIONLANES];
+      SpiceDouble small[OBSCURATIONLANES];
+      SpiceDouble blockMagnitude[OBSCURATIONLANES];
+      SpiceDouble blockObscuration[OBSCURATIONLANES];
+      for ( SpiceInt lane = 0; lane < OBSCURATIONLANES; lane++ ) {
+         SpiceInt i  = std::min( block + lane, count - 1 );
+         d[lane]     = std::max( separations[i], 1.0e-300 );
+         big[lane]   = targetRadii[i];
+         small[lane] = occulterRadii[i];
+      }
+
+      for ( SpiceInt lane = 0; lane < OBSCURATIONLANES; lane++ ) {
+         blockMagnitude[lane] = std::max(
+            0.0,
+            ( big[lane] + small[lane] - d[lane] ) / ( 2.0 * big[lane] ) );
+      }
+
+      for ( SpiceInt lane = 0; lane < OBSCURATIONLANES; lane++ ) {
+         SpiceDouble R  = big[lane];
+         SpiceDouble r  = small[lane];
+         SpiceDouble dd = d[lane];
+         SpiceDouble a  = ( dd * dd + R * R - r * r ) / ( 2.0 * dd * R );
+         SpiceDouble b  = ( dd * dd + r * r - R * R ) / ( 2.0 * dd * r );
+         SpiceDouble k  = ( -dd + R + r ) * ( dd + R - r ) * ( dd - R + r ) *
+                         ( dd + R + r );
+         SpiceDouble area = R * R * getArccosine( a ) +
+                            r * r * getArccosine( b ) -
+                            0.5 * sqrt( std::max( 0.0, k ) );
+         blockObscuration[lane] =
+            std::min( 1.0, std::max( 0.0, area / ( PI * R * R ) ) );
+      }
+
+      /*
+      For a limb darkened disk, the uniform part blocks its share of the
+      area, and the arcs of the rings within the occulter add the rest.
+      */
+      if ( darkened ) {
+         SpiceDouble blocked[OBSCURATIONLANES];
+         for ( SpiceInt lane = 0; lane < OBSCURATIONLANES; lane++ ) {
+            blocked[lane] = rings.Uniform * PI * blockObscuration[lane];
+         }
+         for ( SpiceInt ring = 0; ring < OBSCURATIONRINGS; ring++ ) {
+            for ( SpiceInt lane = 0; lane < OBSCURATIONLANES; lane++ ) {
+               SpiceDouble p = rings.Radii[ring] * big[lane];
+               SpiceDouble c =
+                  ( p * p + d[lane] * d[lane] - small[lane] * small[lane] ) /
+                  ( 2.0 * p * d[lane] );
+               blocked[lane] += rings.Weights[ring] * getArccosine( c );
+            }
+         }
+         for ( SpiceInt lane = 0; lane < OBSCURATIONLANES; lane++ ) {
+            blockObscuration[lane] =
+               std::min( 1.0, blocked[lane] / rings.Total );
+         }
+      }
+
+      SpiceInt lanes = std::min( OBSCURATIONLANES, count - block );
+      std::copy(
+         blockMagnitude,
+         blockMagnitude + lanes,
+         magnitudes + block );
+      std::copy(
+         blockObscuration,
+         blockObscuration + lanes,
+         obscurations + block );
+   }
+}
+
+/*
+These are small helpers for writing the series' binary fields.
+*/
+template<typename T>
+static void writeField( std::ofstream& out, const T& value ) {
+   out.write( reinterpret_cast<const char*>( &value ), sizeof( T ) );
+}
+
+static void writeString( std::ofstream& out, const std::string& value ) {
+   writeField( out, static_cast<std::uint32_t>( value.size() ) );
+   out.write( value.data(), value.size() );
+}
+
+/*
+This function samples each event in a search's results and writes the
+series to a binary column file.
+*/
+bool cppspice::writeObscurationSeries(
+   const SimulationData& data,
+   SpiceCell*            result ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+      result     I   The intervals found by a search.
+
+   - Detailed_Input
+
+      data     the simulation data which the search was run with, of which
+               the participants and the obscuration settings are used:
+
+                  ObscurationOutput  The path of the file to write.
+                  ObscurationStep    The step of the series in seconds,
+                                     OBSCURATIONSTEP if zero.
+                  LimbDarkening      NONE, or SOLAR to weight the target's
+                                     disk by the Sun's limb darkening.
+
+      result   a SPICE window of the intervals found by either search.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered. The file
+   begins with OBSCURATIONMAGIC, a 32 bit flag which is one if the target
+   is limb darkened, and a 32 bit count of columns followed by their names,
+   each as a 32 bit length and its characters. The columns are
+
+      Epoch           Seconds past J2000 TDB.
+      Separation      The separation of the centers, in radians.
+      TargetRadius    The apparent radius of the target, in radians.
+      OcculterRadius  The apparent radius of the occulter, in radians.
+      Magnitude       The eclipse magnitude.
+      Obscuration     The fraction of the target's light which is blocked.
+
+   Then follow the batches, each of which is a 32 bit event index, a 32 bit
+   count of samples, and each column's samples in turn as doubles. All of
+   the fields are in the native byte order.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Each event runs from its first contact to its last, as found by
+   getSearchEvents, or to the end of the span where it is under way. It is
+   sampled every step from its start, and at its end. The bodies are
+   placed with light time corrected states, from the center of the
+   observer.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt     targetID{ 0 };
+   SpiceInt     occulterID{ 0 };
+   SpiceInt     observerID{ 0 };
+   SpiceBoolean targetFound{ SPICEFALSE };
+   SpiceBoolean occulterFound{ SPICEFALSE };
+   SpiceBoolean observerFound{ SPICEFALSE };
+   bodn2c_c(
+      std::get<0>( data.TargetDetails ).c_str(),
+      &targetID,
+      &targetFound );
+   bodn2c_c(
+      std::get<0>( data.OcculterDetails ).c_str(),
+      &occulterID,
+      &occulterFound );
+   bodn2c_c( data.ObserverName.c_str(), &observerID, &observerFound );
+   if ( !targetFound || !occulterFound || !observerFound ) {
+      std::cout << "Error: the participants of the obscuration series could "
+                   "not be resolved."
+                << std::endl;
+      return false;
+   }
+
+   /*
+   The target and occulter are taken as spheres of their mean radius. A
+   point occulter has no radius, but a point target can't be covered.
+   */
+   SpiceDouble meanRadii[2]{ 0.0, 0.0 };
+   for ( SpiceInt k = 0; k < 2; k++ ) {
+      const ParticipantDetails& details =
+         k == 0 ? data.TargetDetails : data.OcculterDetails;
+      if ( std::get<1>( details ) == "POINT" ) {
+         continue;
+      }
+      SpiceDouble radii[3];
+      SpiceInt    n{ 0 };
+      PoolHandle  handle =
+         getBodyConstantHandle( std::get<0>( details ), "RADII" );
+      if ( handle < 0 || !readPoolHandle( handle, 3, n, radii ) || n != 3 ) {
+         std::cout << "Error: unable to read the radii of '"
+                   << std::get<0>( details ) << "'." << std::endl;
+         return false;
+      }
+      meanRadii[k] = ( radii[0] + radii[1] + radii[2] ) / 3.0;
+   }
+   if ( meanRadii[0] <= 0.0 ) {
+      std::cout << "Error: the obscuration series needs a target with a "
+                   "radius."
+                << std::endl;
+      return false;
+   }
+
+   std::vector<EventContacts> events;
+   if ( !getSearchEvents( data, result, events ) ) {
+      return false;
+   }
+
+   std::ofstream out(
+      data.ObscurationOutput,
+      std::ios::binary | std::ios::trunc );
+   if ( !out ) {
+      std::cout << "Error: unable to write the obscuration series '"
+                << data.ObscurationOutput << "'." << std::endl;
+      return false;
+   }
+
+   bool darkened = data.LimbDarkening == "SOLAR";
+   const std::string columns[OBSCURATIONCOLUMNS] = {
+      "Epoch",
+      "Separation",
+      "TargetRadius",
+      "OcculterRadius",
+      "Magnitude",
+      "Obscuration" };
+   out.write( OBSCURATIONMAGIC, 8 );
+   writeField( out, static_cast<std::uint32_t>( darkened ? 1 : 0 ) );
+   writeField( out, static_cast<std::uint32_t>( OBSCURATIONCOLUMNS ) );
+   for ( auto& column : columns ) {
+      writeString( out, column );
+   }
+
+   SpiceDouble spanLower{ 0.0 };
+   SpiceDouble spanUpper{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &spanLower );
+   str2et_c( data.UpperBoundEpoch.c_str(), &spanUpper );
+   SpiceDouble step =
+      data.ObscurationStep > 0.0 ? data.ObscurationStep : OBSCURATIONSTEP;
+
+   /*
+   The columns of one batch, each in its own array.
+   */
+   std::vector<SpiceDouble> batch[OBSCURATIONCOLUMNS];
+   for ( auto& column : batch ) {
+      column.resize( OBSCURATIONBATCH );
+   }
+   SpiceDouble* epochs        = batch[0].data();
+   SpiceDouble* separations   = batch[1].data();
+   SpiceDouble* targetRadii   = batch[2].data();
+   SpiceDouble* occulterRadii = batch[3].data();
+   SpiceDouble* magnitudes    = batch[4].data();
+   SpiceDouble* obscurations  = batch[5].data();
+
+   auto                   start = std::chrono::steady_clock::now();
+   long long              samples{ 0 };
+   SpiceDouble            overlapTime{ 0.0 };
+   std::vector<BodyState> states;
+   for ( size_t event = 0; event < events.size(); event++ ) {
+      SpiceDouble first = std::isnan( events[event].Contacts[0] )
+                             ? spanLower
+                             : events[event].Contacts[0];
+      SpiceDouble last  = std::isnan( events[event].Contacts[3] )
+                             ? spanUpper
+                             : events[event].Contacts[3];
+      long long   count =
+         static_cast<long long>( std::floor( ( last - first ) / step ) ) + 2;
+      if ( first + ( count - 2 ) * step >= last ) {
+         count--;
+      }
+
+      LightTimeCache lightTimes;
+      for ( long long index = 0; index < count;
+            index += OBSCURATIONBATCH )
+      {
+         SpiceInt size = static_cast<SpiceInt>(
+            std::min( static_cast<long long>( OBSCURATIONBATCH ),
+                      count - index ) );
+
+         /*
+         Place the bodies for the whole batch first.
+         */
+         for ( SpiceInt i = 0; i < size; i++ ) {
+            epochs[i] = std::min( last, first + ( index + i ) * step );
+            if ( !getMultiBodyStates(
+                    { targetID, occulterID },
+                    epochs[i],
+                    observerID,
+                    lightTimes,
+                    states ) )
+            {
+               return false;
+            }
+            const SpiceDouble* target   = states[0].State.data();
+            const SpiceDouble* occulter = states[1].State.data();
+            SpiceDouble        targetDistance   = vnorm_c( target );
+            SpiceDouble        occulterDistance = vnorm_c( occulter );
+            separations[i] = vsep_c( target, occulter );
+            targetRadii[i] =
+               asin( std::min( 1.0, meanRadii[0] / targetDistance ) );
+            occulterRadii[i] =
+               asin( std::min( 1.0, meanRadii[1] / occulterDistance ) );
+         }
+
+         auto overlapStart = std::chrono::steady_clock::now();
+         computeObscurations(
+            size,
+            separations,
+            targetRadii,
+            occulterRadii,
+            darkened,
+            magnitudes,
+            obscurations );
+         std::chrono::duration<double> overlap =
+            std::chrono::steady_clock::now() - overlapStart;
+         overlapTime += overlap.count();
+
+         writeField( out, static_cast<std::uint32_t>( event ) );
+         writeField( out, static_cast<std::uint32_t>( size ) );
+         for ( auto& column : batch ) {
+            out.write(
+               reinterpret_cast<const char*>( column.data() ),
+               size * sizeof( SpiceDouble ) );
+         }
+         samples += size;
+      }
+   }
+   if ( !out ) {
+      std::cout << "Error: unable to write the obscuration series '"
+                << data.ObscurationOutput << "'." << std::endl;
+      return false;
+   }
+
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   std::cout << "Obscuration series: " << events.size() << " events, "
+             << samples << " samples in " << elapsed.count() << " s ("
+             << overlapTime << " s computing the overlaps)." << std::endl;
+   return true;
+}
+/* End ObscurationUtils.cpp */
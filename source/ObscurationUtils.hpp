@@ -0,0 +1,109 @@
+// clang-format off
+/*
+
+- Header_File ObscurationUtils.hpp (Obscuration utility code)
+
+- Abstract
+
+   Define utility functions which find how much of the target the occulter
+   covers over the course of each occultation event, as a time series.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   compute obscuration series. The target and occulter are seen as disks,
+   whose apparent radii and separation are found for every sample of an
+   event. From these, the series gives the eclipse magnitude, the fraction
+   of the target's diameter which is covered, and the obscuration, the
+   fraction of the target's light which is blocked.
+
+   The samples are evaluated in batches, with each quantity held in its
+   own array, and the overlap of each batch is computed a block of
+   OBSCURATIONLANES samples at a time, in loops without branches which the
+   compiler turns into vector instructions, so long as sqrt needn't set
+   errno (GCC needs -fno-math-errno for this). For a uniform disk, the
+   obscuration is the area of the lens where the two circles overlap. For a
+   limb darkened disk, the part of its brightness which varies across it
+   is divided into OBSCURATIONRINGS rings, and the arc of each ring within
+   the occulter is summed on top of the uniform part's overlap.
+
+   The series is streamed to a binary file of columns, a batch at a time,
+   so that it never needs to be held in memory as a whole.
+
+- Literature_References
+
+   Allen, C.W., "Astrophysical Quantities", 3rd ed., Athlone Press, 1973,
+   for the Sun's limb darkening.
+
+   Abramowitz, M., and Stegun, I.A., "Handbook of Mathematical Functions",
+   1964, 4.4.46, for the arccosine.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   The target and occulter are taken as spheres of their mean radius. The
+   target can't be a point.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes for this file.
+*/
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   This function computes the eclipse magnitude and obscuration of a batch
+   of samples from the apparent radii of the target and occulter and the
+   separation of their centers, all in the same angular units. The target
+   is limb darkened if requested. The count needn't be a whole number of
+   blocks.
+   */
+   void computeObscurations(
+      const SpiceInt     count,
+      const SpiceDouble* separations,
+      const SpiceDouble* targetRadii,
+      const SpiceDouble* occulterRadii,
+      const bool         darkened,
+      SpiceDouble*       magnitudes,
+      SpiceDouble*       obscurations );
+
+   /*
+   This function samples each event in a search's results from its first
+   to its last contact, and writes the series to the simulation's
+   ObscurationOutput file.
+   */
+   bool writeObscurationSeries(
+      const SimulationData& data,
+      SpiceCell*            result );
+}   // namespace cppspice
+    /* End ObscurationUtils.hpp */
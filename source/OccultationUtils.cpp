@@ -52,26 +52,56 @@
 // clang-format on
 
 /*
-We need the corresponding header and the fstream header.
+We need the corresponding header, the ephemeris utilities, chrono for the
+search timers, cmath for the sphere benchmark, csignal for the interrupt
+handler, the fstream header, and limits for missing contacts.
 */
+#include <chrono>
+#include <cmath>
+#include <csignal>
 #include <fstream>
+#include <limits>
 
+#include "EphemerisUtils.hpp"
 #include "OccultationUtils.hpp"
 
+/*
+The GF sphere pre-classifier and the ellipsoid occultation routine it stands
+in for aren't part of the CSPICE API, so we declare them here.
+*/
+extern "C" {
+SpiceInt zzocced_(
+   SpiceDouble* viewpt,
+   SpiceDouble* centr1,
+   SpiceDouble* semax1,
+   SpiceDouble* centr2,
+   SpiceDouble* semax2 );
+SpiceInt zzocsph_(
+   SpiceDouble* bckpos,
+   SpiceDouble* bckmin,
+   SpiceDouble* bckmax,
+   SpiceDouble* frtpos,
+   SpiceDouble* frtmin,
+   SpiceDouble* frtmax,
+   SpiceInt*    occode );
+}
+
 /*
 A function which determines whether the target is occulted at a specified
 epoch.
 */
 bool cppspice::isOccultedAtEpoch(
-   const SpiceInt    targetID,
-   const SpiceInt    occulterID,
-   const SpiceInt    observerID,
-   const SpiceDouble epoch,
-   const SpiceChar*  occulterFrame,
-   const SpiceChar*  occulterName,
-   const SpiceChar*  targetFrame,
-   const SpiceChar*  targetName,
-   SpiceBoolean&     isOcculted ) {
+   const SpiceInt         targetID,
+   const SpiceInt         occulterID,
+   const SpiceInt         observerID,
+   const SpiceDouble      epoch,
+   const FramePlanHandle  occulterRotationPlan,
+   const PoolHandle       occulterRadiiHandle,
+   const ShapeModelHandle occulterShape,
+   const SpiceChar*       targetFrame,
+   const PoolHandle       targetRadiiHandle,
+   SpiceBoolean&          isOcculted,
+   LightTimeCache*        lightTimes ) {
    /*
 
    - Brief I/O
@@ -82,11 +112,13 @@ bool cppspice::isOccultedAtEpoch(
       SpiceInt      I   The NAIF ID of the occulter.
       SpiceInt      I   The NAIF ID of the observer.
       SpiceDouble   I   The epoch being evaluated.
-      SpiceChar*    I   The name of the occulter's frame.
-      SpiceChar*    I   The name of the occulter.
+      handle        I   The rotation plan from J2000 to the occulter's frame.
+      PoolHandle    I   The pool handle of the occulter's radii.
+      handle        I   The occulter's shape model, or -1.
       SpiceChar*    I   The name of the target's frame.
-      SpiceChar*    I   The name of the target.
-      SpiceBoolean  I   Whether an occultation is happening.
+      PoolHandle    I   The pool handle of the target's radii.
+      SpiceBoolean  O   Whether an occultation is happening.
+      struct       I/O  An optional cache of light time solutions.
 
    - Detailed_Input
 
@@ -94,12 +126,24 @@ bool cppspice::isOccultedAtEpoch(
       occulterID    an int representing the NAIF ID of the occulter object.
       observerID    an int representing the NAIF ID of the observer object.
       epoch         a double representing the epoch being evaluated.
-      occulterFrame the name of the occulter's frame.
-      occulterName  the name of the occulter.
+      occulterRotationPlan
+                    a handle to the frame plan from J2000 to the occulter's
+   frame, as returned by getFramePlan. The rotation is retrieved through the
+   rotation memo, so repeated and nearby epochs are cheap.
+      occulterRadiiHandle
+                    a handle to the occulter's RADII pool variable, as
+   returned by getBodyConstantHandle.
+      occulterShape a handle to the occulter's shape model, as returned by
+   getShapeModel, or -1 to treat the occulter as an ellipsoid. When a model
+   is given, the rotation plan must be to the model's frame.
       targetFrame   the name of the target's frame.
-      targetName    the name of the target.
+      targetRadiiHandle
+                    a handle to the target's RADII pool variable.
       isOcculted    a boolean representing whether an occultation is
    happening.
+      lightTimes    an optional LightTimeCache. If provided, the light times
+   are converged starting from the solutions of the previous calls, which is
+   much cheaper when successive epochs are close together.
 
    - Detailed_Output
 
@@ -138,31 +182,34 @@ bool cppspice::isOccultedAtEpoch(
    */
 
    /*
-   First, we need to get the J2000 observer position.
-   */
-   SpiceDouble earthToObserverJ2000[6];
-   SpiceDouble lt{ 0.0 };
-   spkez_c(
-      observerID,
-      epoch,
-      "j2000",
-      "LT",
-      EARTHID,
-      earthToObserverJ2000,
-      &lt );
-
-   /*
-   Similarly, get the J2000 occulter position.
+   First, we need to get the J2000 observer, occulter, and target positions.
+   These all share the Earth's center chain, so evaluate them together so
+   that the common chain nodes are only evaluated once.
    */
-   SpiceDouble earthToOcculterJ2000[6];
-   spkez_c(
-      occulterID,
-      epoch,
-      "j2000",
-      "LT",
-      EARTHID,
-      earthToOcculterJ2000,
-      &lt );
+   std::vector<BodyState> states;
+   if ( lightTimes != nullptr ) {
+      if ( !getMultiBodyStates(
+              { observerID, occulterID, targetID },
+              epoch,
+              EARTHID,
+              *lightTimes,
+              states ) )
+      {
+         return false;
+      }
+   }
+   else if ( !getMultiBodyStates(
+                { observerID, occulterID, targetID },
+                epoch,
+                "LT",
+                EARTHID,
+                states ) )
+   {
+      return false;
+   }
+   const SpiceDouble* earthToObserverJ2000 = states[0].State.data();
+   const SpiceDouble* earthToOcculterJ2000 = states[1].State.data();
+   const SpiceDouble* earthToTargetJ2000   = states[2].State.data();
 
    /*
    We can now calculate the J2000 occulter-to-observer vector.
@@ -175,19 +222,6 @@ bool cppspice::isOccultedAtEpoch(
       earthToObserverJ2000,
       occulterToObserverJ2000 );
 
-   /*
-   Next, let's get the J2000 target position.
-   */
-   SpiceDouble earthToTargetJ2000[6];
-   spkez_c(
-      targetID,
-      epoch,
-      "j2000",
-      "LT",
-      EARTHID,
-      earthToTargetJ2000,
-      &lt );
-
    /*
    We can now calculate the J2000 occulter-to-target vector.
    */
@@ -204,7 +238,9 @@ bool cppspice::isOccultedAtEpoch(
    frame, so get the rotation matrix.
    */
    SpiceDouble rotate[3][3];
-   pxform_c( "j2000", occulterFrame, epoch, rotate );
+   if ( !getMemoRotation( occulterRotationPlan, epoch, rotate ) ) {
+      return false;
+   }
 
    /*
    Translate the occulter-to-observer vector to occulter-fixed.
@@ -218,13 +254,38 @@ bool cppspice::isOccultedAtEpoch(
    SpiceDouble occulterToTargetFixed[3];
    mxv_c( rotate, occulterToTargetJ2000, occulterToTargetFixed );
 
+   /*
+   An occulter with a shape model is tested against its plates instead, by
+   casting lines of sight from the observer to samples of the target's disk.
+   The target is occulted as soon as any of them is blocked.
+   */
+   if ( occulterShape >= 0 ) {
+      SpiceInt    n;
+      SpiceDouble targetRadii[3];
+      SpiceDouble fraction{ 0.0 };
+      if ( !readPoolHandle( targetRadiiHandle, 3, n, targetRadii ) ||
+           !getBlockedFraction(
+              occulterShape,
+              occulterToObserverFixed,
+              occulterToTargetFixed,
+              targetRadii[0],
+              fraction ) )
+      {
+         return false;
+      }
+      isOcculted = fraction > 0.0;
+      return true;
+   }
+
    /*
    We want to spherize the occulter to account for flattening. So, get the
    radii from the kernel we've already furnished.
    */
    SpiceInt    n;
    SpiceDouble occulterRadii[3];
-   bodvrd_c( occulterName, "RADII", 3, &n, occulterRadii );
+   if ( !readPoolHandle( occulterRadiiHandle, 3, n, occulterRadii ) ) {
+      return false;
+   }
 
    /*
    The equatorial radius will be used elsewhere, so save that off.
@@ -243,7 +304,9 @@ bool cppspice::isOccultedAtEpoch(
    target.
    */
    SpiceDouble targetRadii[3];
-   bodvrd_c( targetName, "RADII", 3, &n, targetRadii );
+   if ( !readPoolHandle( targetRadiiHandle, 3, n, targetRadii ) ) {
+      return false;
+   }
    vscl_c( scaleFactor, targetRadii, targetRadii );
 
    /*
@@ -327,18 +390,19 @@ bool cppspice::isOccultedAtEpoch(
 A bisection algorithm to find the transition.
 */
 bool cppspice::bisectEpochs(
-   const SpiceInt     targetID,
-   const SpiceInt     occulterID,
-   const SpiceInt     observerID,
-   const SpiceDouble  lowerEpoch,
-   const SpiceBoolean lowerOcculted,
-   const SpiceDouble  upperEpoch,
-   const SpiceBoolean upperOcculted,
-   const SpiceChar*   occulterFrame,
-   const SpiceChar*   occulterName,
-   const SpiceChar*   targetFrame,
-   const SpiceChar*   targetName,
-   const SpiceDouble  tolerance ) {
+   const SpiceInt         targetID,
+   const SpiceInt         occulterID,
+   const SpiceInt         observerID,
+   const SpiceDouble      lowerEpoch,
+   const SpiceBoolean     lowerOcculted,
+   const SpiceDouble      upperEpoch,
+   const SpiceBoolean     upperOcculted,
+   const FramePlanHandle  occulterRotationPlan,
+   const PoolHandle       occulterRadiiHandle,
+   const ShapeModelHandle occulterShape,
+   const SpiceChar*       targetFrame,
+   const PoolHandle       targetRadiiHandle,
+   const SpiceDouble      tolerance ) {
    /*
    - Brief I/O
 
@@ -351,10 +415,11 @@ bool cppspice::bisectEpochs(
    SpiceBoolean  I   The occultation state at the left epoch of the window.
    SpiceDouble   I   The right epoch of the window being evaluated.
    SpiceBoolean  I   The occultation state at the right epoch of the window.
-   SpiceChar*    I   The name of the occulter's frame.
-   SpiceChar*    I   The name of the occulter.
+   handle        I   The rotation plan from J2000 to the occulter's frame.
+   PoolHandle    I   The pool handle of the occulter's radii.
+   handle        I   The occulter's shape model, or -1.
    SpiceChar*    I   The name of the target's frame.
-   SpiceChar*    I   The name of the target.
+   PoolHandle    I   The pool handle of the target's radii.
    SpiceDouble   I   The tolerance, in seconds, used in the bisection
    algorithm.
 
@@ -368,10 +433,12 @@ bool cppspice::bisectEpochs(
    left epoch of the evaluation window. upperEpoch    a double representing
    the right epoch of the evaluation window. upperOcculted a bool representing
    the occultation status of the right epoch of the evaluation window.
-   occulterFrame the name of the occulter's frame. occulterName  the name of
-   the occulter. targetFrame the name of the target's frame. targetName    the
-   name of the target. tolerance the tolerance in seconds used in the
-   bisection algorithm.
+   occulterRotationPlan the frame plan from J2000 to the occulter's frame.
+   occulterRadiiHandle the pool handle of the occulter's radii.
+   occulterShape the occulter's shape model, or -1. targetFrame the name of
+   the target's frame.
+   targetRadiiHandle the pool handle of the target's radii. tolerance the
+   tolerance in seconds used in the bisection algorithm.
 
    - Detailed_Output
 
@@ -421,6 +488,12 @@ bool cppspice::bisectEpochs(
    SpiceDouble  step{ STEPSIZE };
    SpiceBoolean midpointOcculted{ false };
 
+   /*
+   The epochs we evaluate are all very close together, so each light time
+   solution is an excellent starting estimate for the next.
+   */
+   LightTimeCache lightTimes;
+
    /*
    Perform a bisection algorithm. Our algorithm is pretty simple: while the
    difference between the two bounds are greater than the tolerance and the
@@ -445,11 +518,13 @@ bool cppspice::bisectEpochs(
          occulterID,
          observerID,
          midpoint,
-         occulterFrame,
-         occulterName,
+         occulterRotationPlan,
+         occulterRadiiHandle,
+         occulterShape,
          targetFrame,
-         targetName,
-         midpointOcculted );
+         targetRadiiHandle,
+         midpointOcculted,
+         &lightTimes );
 
       if ( midpointOcculted == leftOcculted ) {
          left = midpoint;
@@ -467,11 +542,13 @@ bool cppspice::bisectEpochs(
          occulterID,
          observerID,
          workingEpoch,
-         occulterFrame,
-         occulterName,
+         occulterRotationPlan,
+         occulterRadiiHandle,
+         occulterShape,
          targetFrame,
-         targetName,
-         workingOcculted );
+         targetRadiiHandle,
+         workingOcculted,
+         &lightTimes );
 
       /*
       If we have a state change, we've stepped beyond the transition, so set
@@ -526,7 +603,9 @@ bool cppspice::bisectEpochs(
 This is a function which is used to perform the occultation search using
 a custom written algorithm.
 */
-bool cppspice::performCustOccSrch( const SimulationData& data ) {
+bool cppspice::performCustOccSrch(
+   const SimulationData& data,
+   SpiceCell*            events ) {
    /*
 
    - Brief I/O
@@ -534,6 +613,7 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
       Variable  I/O  DESCRIPTION
       --------  ---  --------------------------------------------------
       data       I   The simulation data which is fed into gfoclt_c.
+      events     O   The spans of the events which were found.
 
    - Detailed_Input
 
@@ -554,6 +634,9 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
 
    - Detailed_Output
 
+      events   the window of events, with the span of each event which was
+   found inserted, if it isn't null.
+
       The function returns true if no errors are encountered.
 
    - Error Handling
@@ -563,7 +646,9 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
 
    - Particulars
 
-      None.
+      If a window of events is provided, the span of each event which was
+   found, from the step before its first transition to the step after its
+   last, is inserted into it for the event stages (see getSearchEvents).
 
    - Literature_References
 
@@ -584,6 +669,7 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
 
    - Version
 
+      -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
       -Symmetrical-Enigma Version 1.X.X, 03-SEP-2022 (CPW)
       -Symmetrical-Enigma Version 1.0.0, 28-AUG-2022 (CPW)
    */
@@ -612,6 +698,48 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
    bodn2c_c( data.ObserverName.c_str(), &observerID, &found );
    SpiceDouble epoch{ 0.0 };
 
+   /*
+   If the occulter is given by its DSK plates, build its shape model up
+   front. Its geometry is then evaluated in the model's frame. The target is
+   always treated as a sphere.
+   */
+   ShapeModelHandle occulterShape{ -1 };
+   std::string      occulterFrame = std::get<2>( data.OcculterDetails );
+   if ( std::get<1>( data.OcculterDetails ) == "DSK/UNPRIORITIZED" ) {
+      ShapeSummary summary;
+      occulterShape = getShapeModel( std::get<0>( data.OcculterDetails ) );
+      if ( occulterShape < 0 || !getShapeSummary( occulterShape, summary ) ) {
+         return false;
+      }
+      occulterFrame = summary.Frame;
+   }
+
+   /*
+   Resolve the radii of the occulter and target to pool handles once, so that
+   each evaluation below reads them without any name or pool lookups. The
+   radii of an occulter with a shape model aren't needed.
+   */
+   PoolHandle occulterRadiiHandle =
+      getBodyConstantHandle( std::get<0>( data.OcculterDetails ), "RADII" );
+   PoolHandle targetRadiiHandle =
+      getBodyConstantHandle( std::get<0>( data.TargetDetails ), "RADII" );
+   if ( ( occulterRadiiHandle < 0 && occulterShape < 0 ) ||
+        targetRadiiHandle < 0 )
+   {
+      std::cout << "Error: unable to resolve the radii of the occulter or "
+                << "target." << std::endl;
+      return false;
+   }
+
+   /*
+   Resolve the occulter's frame chain once as well.
+   */
+   FramePlanHandle occulterRotationPlan =
+      getFramePlan( "J2000", occulterFrame );
+   if ( occulterRotationPlan < 0 ) {
+      return false;
+   }
+
    SpiceBoolean isOcculted{ false };
 
    /*
@@ -651,10 +779,11 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
          occulterID,
          observerID,
          et,
-         std::get<2>( data.OcculterDetails ).c_str(),
-         std::get<0>( data.OcculterDetails ).c_str(),
+         occulterRotationPlan,
+         occulterRadiiHandle,
+         occulterShape,
          std::get<2>( data.TargetDetails ).c_str(),
-         std::get<0>( data.TargetDetails ).c_str(),
+         targetRadiiHandle,
          isOcculted );
       occultationVector.push_back( isOcculted );
    }
@@ -675,11 +804,38 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
       }
    }
 
+   /*
+   If the events were requested, hand back the brackets around their
+   transitions, which is all the event stages need. An event which is
+   under way at either end of the span runs to that end, so one which
+   lasts the whole span covers all of it.
+   */
+   if ( events != nullptr ) {
+      SpiceDouble start = lowerEpochTime;
+      for ( auto& p : refinedIntervals ) {
+         if ( p.second.second ) {
+            start = p.first.first;
+         }
+         else {
+            wninsd_c( start, p.second.first, events );
+         }
+      }
+      if ( occultationVector.back() ) {
+         wninsd_c( start, upperEpochTime, events );
+      }
+   }
+
    /*
    If no refined intervals have been found, then report as such.
    */
    if ( refinedIntervals.size() == 0 ) {
-      std::cout << "No occultation events were detected." << std::endl;
+      if ( occultationVector.front() ) {
+         std::cout << "Occultation under way for the entire search span."
+                   << std::endl;
+      }
+      else {
+         std::cout << "No occultation events were detected." << std::endl;
+      }
       /*
       Note: even though it didn't find any events, it didn't error...just
       didn't find anything. So return true.
@@ -701,10 +857,11 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
               p.first.second,
               p.second.first,
               p.second.second,
-              std::get<2>( data.OcculterDetails ).c_str(),
-              std::get<0>( data.OcculterDetails ).c_str(),
+              occulterRotationPlan,
+              occulterRadiiHandle,
+              occulterShape,
               std::get<2>( data.TargetDetails ).c_str(),
-              std::get<0>( data.TargetDetails ).c_str(),
+              targetRadiiHandle,
               data.Tolerance ) )
       {
          return false;
@@ -715,177 +872,1860 @@ bool cppspice::performCustOccSrch( const SimulationData& data ) {
 }
 
 /*
-This is the function which is used to perform the occultation search using
-the cspice gfoclt_c routine. We feed in the SimulationData which was
-retrieved prior to this call.
+The participants of the current CSPICE search, as the adaptive step function
+needs them. gfocce_c only passes the epoch to its step function, so they are
+held here for the duration of the search.
 */
-SpiceCell* cppspice::performCSPICEOccSrch( const SimulationData& data ) {
+struct AdaptiveStepContext {
+   std::string Front;
+   std::string Back;
+   std::string Observer;
+   SpiceDouble FrontRadii[2];
+   SpiceDouble BackRadii[2];
+   SpiceDouble MinimumStep;
+};
+static AdaptiveStepContext adaptiveStep;
+
+/*
+This is a helper which reads the semi-axes of a body, which are all zero for
+a point.
+*/
+static bool getRadii(
+   const cppspice::ParticipantDetails& details,
+   SpiceDouble                         radii[3] ) {
+   radii[0] = 0.0;
+   radii[1] = 0.0;
+   radii[2] = 0.0;
+   if ( std::get<1>( details ) == "POINT" ) {
+      return true;
+   }
+
+   cppspice::PoolHandle handle =
+      cppspice::getBodyConstantHandle( std::get<0>( details ), "RADII" );
+   SpiceInt n{ 0 };
+   if ( handle < 0 || !cppspice::readPoolHandle( handle, 3, n, radii ) ||
+        n != 3 )
+   {
+      std::cout << "Error: unable to read the radii of '"
+                << std::get<0>( details ) << "'." << std::endl;
+      return false;
+   }
+
+   return true;
+}
+
+/*
+This is a helper which reads the smallest and largest semi-axes of a body,
+which are both zero for a point.
+*/
+static bool getRadiusBounds(
+   const cppspice::ParticipantDetails& details,
+   SpiceDouble                         bounds[2] ) {
+   SpiceDouble radii[3];
+   if ( !getRadii( details, radii ) ) {
+      return false;
+   }
+
+   bounds[0] = std::min( { radii[0], radii[1], radii[2] } );
+   bounds[1] = std::max( { radii[0], radii[1], radii[2] } );
+   return true;
+}
+
+/*
+This is the step function which is handed to gfocce_c. It returns the
+largest step over which the occultation state can't change.
+*/
+static void getAdaptiveStep( SpiceDouble epoch, SpiceDouble* step ) {
    /*
    - Brief I/O
 
-      Variable  I/O  DESCRIPTION
-      --------  ---  --------------------------------------------------
-      data       I   The simulation data which is fed into gfoclt_c.
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The step to take from the epoch, in seconds.
 
    - Detailed_Input
 
-      data     a struct which contains the simulation data used in the
-               occultation analysis. The struct members include:
-
-                  LowerBoundEpoch:  The epoch in TDB which begins the range.
-                  UpperBoundEpoch   The epoch in TDB which ends the range.
-                  StepSize          The step size in seconds.
-                  OccultationType   The type of the occultation. The supported
-                                    values are outlined in gfoclt_c.c
-                  OcculterDetails   A tuple containing the occulting object's
-                                    name, shape, and reference frame.
-                  TargetDetails     A tuple containing the occulting object's
-                                    name, shape, and reference frame.
-                  ObserverName      The name of the observing object.
-                  Tolerance         The tolerance in seconds.
+      epoch   the epoch at which the GF search has just sampled the
+   occultation state.
 
    - Detailed_Output
 
-      The function returns a SPICE window representing the set of time
-   intervals, within the confinement period, when the specified occultation
-   occurs.
-
-      The endpoints of the time intervals comprising 'result' are interpreted
-   as seconds past J2000 TDB.
+      step    the step to the next sample, between adaptiveStep.MinimumStep
+   and ADAPTIVEMAXSTEP.
 
    - Error Handling
 
-      This function's error handling is performed by the CSPICE API.
+      CSPICE components are handled using the native error handling.
 
    - Particulars
 
-      For more information, please see the CSPICE documentation for gfoclt_c.
+      Seen from the observer, each body lies within a cone about the
+   direction to its center whose half angle is the angular radius of its
+   largest semi-axis, and covers the cone for its smallest semi-axis. So,
+   with theta the angle between the two centers, and r and R the smallest
+   and largest angular radii, the occultation state can only change while
+   theta is within one of the bands
 
-   - Literature_References
+      [ r_front + r_back, R_front + R_back ]   (first and last contact)
+      [ r_front - R_back, R_front - r_back ]  (full occultation)
+      [ r_back - R_front, R_back - r_front ]  (annular occultation)
 
-      CSPICE's documentation.
+   Neither theta nor the angular radii can change faster than the sum of
+   the bodies' speeds over their distances and the rates of the angular
+   radii, so the distance to the nearest band divided by that rate is a
+   safe step. It is reduced by ADAPTIVESAFETY, since the rate is only known
+   at the epoch, and never drops below the fixed step that the user asked
+   for, so that the search resolves no less than gfoclt_c would.
 
    - Author
 
       C.P. Westphal     (self)
 
-   - Credits
+   - Version
 
-      This file references the CSPICE API, which was developed by the NAIF at
-      JPL.
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble frontState[6];
+   SpiceDouble backState[6];
+   SpiceDouble lt{ 0.0 };
+   spkezr_c(
+      adaptiveStep.Front.c_str(),
+      epoch,
+      "J2000",
+      "LT",
+      adaptiveStep.Observer.c_str(),
+      frontState,
+      &lt );
+   spkezr_c(
+      adaptiveStep.Back.c_str(),
+      epoch,
+      "J2000",
+      "LT",
+      adaptiveStep.Observer.c_str(),
+      backState,
+      &lt );
 
-   - Restrictions
+   SpiceDouble frontDistance = vnorm_c( frontState );
+   SpiceDouble backDistance  = vnorm_c( backState );
+   SpiceDouble separation    = vsep_c( frontState, backState );
 
-      None.
+   /*
+   The angular radius of a sphere, and an upper bound on its rate.
+   */
+   auto angularRadius = []( SpiceDouble radius, SpiceDouble distance ) {
+      return radius >= distance ? cppspice::PI / 2.0
+                                : asin( radius / distance );
+   };
+   auto angularRadiusRate = []( SpiceDouble        radius,
+                                const SpiceDouble* state,
+                                SpiceDouble        distance ) {
+      if ( radius <= 0.0 || radius >= distance ) {
+         return 0.0;
+      }
+      SpiceDouble rangeRate = vdot_c( state, state + 3 ) / distance;
+      return radius * std::abs( rangeRate ) /
+             ( distance * sqrt( distance * distance - radius * radius ) );
+   };
+
+   SpiceDouble frontMin =
+      angularRadius( adaptiveStep.FrontRadii[0], frontDistance );
+   SpiceDouble frontMax =
+      angularRadius( adaptiveStep.FrontRadii[1], frontDistance );
+   SpiceDouble backMin =
+      angularRadius( adaptiveStep.BackRadii[0], backDistance );
+   SpiceDouble backMax =
+      angularRadius( adaptiveStep.BackRadii[1], backDistance );
+
+   SpiceDouble bands[3][2] = {
+      { frontMin + backMin, frontMax + backMax },
+      { frontMin - backMax, frontMax - backMin },
+      { backMin - frontMax, backMax - frontMin } };
+   SpiceDouble gap = separation;
+   for ( const auto& band : bands ) {
+      SpiceDouble distance{ 0.0 };
+      if ( separation < band[0] ) {
+         distance = band[0] - separation;
+      }
+      else if ( separation > band[1] ) {
+         distance = separation - band[1];
+      }
+      gap = std::min( gap, distance );
+   }
 
-   - Version
+   SpiceDouble rate =
+      vnorm_c( frontState + 3 ) / frontDistance +
+      vnorm_c( backState + 3 ) / backDistance +
+      angularRadiusRate(
+         adaptiveStep.FrontRadii[1],
+         frontState,
+         frontDistance ) +
+      angularRadiusRate( adaptiveStep.BackRadii[1], backState, backDistance );
+
+   *step = adaptiveStep.MinimumStep;
+   if ( gap > 0.0 && rate > 0.0 ) {
+      *step = std::max(
+         adaptiveStep.MinimumStep,
+         std::min(
+            gap / ( cppspice::ADAPTIVESAFETY * rate ),
+            cppspice::ADAPTIVEMAXSTEP ) );
+   }
+}
 
-      -Symmetrical-Enigma Version 1.X.X, 03-SEP-2022 (CPW)
-      -Symmetrical-Enigma Version 1.0.0, 28-AUG-2022 (CPW)
+/*
+The state of the secant refinement of the current CSPICE search. Like the
+step function, the refinement function is only passed the bracket, so the
+participants are held here, along with the bracket and measures from the
+previous call and a few recently measured epochs.
+*/
+struct RefinementContext {
+   std::string FrontFrame;
+   std::string BackFrame;
+   SpiceDouble FrontRadii[3];
+   SpiceDouble BackRadii[3];
+   SpiceDouble Tolerance;
+   SpiceDouble Lower;
+   SpiceDouble Upper;
+   SpiceDouble Proposal;
+   SpiceDouble LowerMeasure;
+   SpiceDouble UpperMeasure;
+   SpiceInt    Measure;
+   SpiceInt    Retained;
+   SpiceDouble Estimate;
+   SpiceDouble Root;
+   SpiceDouble Offset;
+   SpiceDouble Stride;
+   SpiceDouble Epochs[4];
+   SpiceDouble Measures[4][3];
+   SpiceInt    Next;
+};
+static RefinementContext refinement;
+
+/*
+This is a helper which returns the angular radius of an ellipsoid seen from
+the observer, measured from the direction to its center towards a direction
+in the plane of the sky.
+*/
+static SpiceDouble getDirectionalRadius(
+   const SpiceDouble radii[3],
+   SpiceDouble       rotate[3][3],
+   const SpiceDouble center[3],
+   const SpiceDouble toward[3],
+   const SpiceDouble distance ) {
+   if ( radii[0] <= 0.0 ) {
+      return 0.0;
+   }
+
+   /*
+   With A the diagonal matrix of the inverse squared radii, and p the
+   observer's position from the center, the rays v from the observer which
+   graze the ellipsoid satisfy ( v'Ap )^2 = ( v'Av )( p'Ap - 1 ). Taking
+   v = d + t u, where d is the direction to the center, and using p = -D d,
+   this reduces to a quadratic in t whose positive root is the tangent of
+   the limb's angle from the center in the direction u.
    */
+   SpiceDouble fixedCenter[3];
+   SpiceDouble fixedToward[3];
+   mxv_c( rotate, center, fixedCenter );
+   mxv_c( rotate, toward, fixedToward );
+
+   SpiceDouble dAd{ 0.0 };
+   SpiceDouble dAu{ 0.0 };
+   SpiceDouble uAu{ 0.0 };
+   for ( SpiceInt i = 0; i < 3; i++ ) {
+      SpiceDouble inverse = 1.0 / ( radii[i] * radii[i] );
+      dAd += fixedCenter[i] * fixedCenter[i] * inverse;
+      dAu += fixedCenter[i] * fixedToward[i] * inverse;
+      uAu += fixedToward[i] * fixedToward[i] * inverse;
+   }
+
+   SpiceDouble quadratic =
+      uAu - distance * distance * ( uAu * dAd - dAu * dAu );
+   if ( quadratic >= 0.0 ) {
+      return cppspice::PI / 2.0;
+   }
 
+   return atan(
+      ( dAu + sqrt( dAu * dAu - quadratic * dAd ) ) / -quadratic );
+}
+
+/*
+This is a helper which evaluates the signed overlap measures of two bodies
+from their light time corrected positions, for first and last contact, full
+occultation, and annular occultation. Each is negative exactly when the
+bodies, measured along the line between their centers, satisfy the
+condition.
+*/
+static void getLimbMeasures(
+   const SpiceDouble  epoch,
+   const SpiceDouble  frontPosition[3],
+   const SpiceDouble  frontLightTime,
+   const SpiceDouble  frontRadii[3],
+   const std::string& frontFrame,
+   const SpiceDouble  backPosition[3],
+   const SpiceDouble  backLightTime,
+   const SpiceDouble  backRadii[3],
+   const std::string& backFrame,
+   SpiceDouble        measures[3] ) {
    /*
-   First, let's convert the epoch bounds to doubles representing seconds
-   from J2000.
+   Each body's orientation is taken at its own light time corrected epoch,
+   as the GF occultation condition does.
    */
-   SpiceDouble lowerEpochTime{ 0.0 };
-   SpiceDouble upperEpochTime{ 0.0 };
-   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpochTime );
-   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpochTime );
+   SpiceDouble frontRotate[3][3];
+   SpiceDouble backRotate[3][3];
+   ident_c( frontRotate );
+   ident_c( backRotate );
+   if ( frontRadii[0] > 0.0 ) {
+      cppspice::getFrameRotation(
+         "J2000",
+         frontFrame,
+         epoch - frontLightTime,
+         frontRotate );
+   }
+   if ( backRadii[0] > 0.0 ) {
+      cppspice::getFrameRotation(
+         "J2000",
+         backFrame,
+         epoch - backLightTime,
+         backRotate );
+   }
 
    /*
-   Next, let's configure the cnfine using our bounds.
+   The direction in the plane of the sky from each center towards the
+   other. It's undefined when the centers line up, but any direction will
+   do then.
    */
-   SPICEDOUBLE_CELL( cnfine, CELLSIZE );
-   SPICEDOUBLE_CELL( result, CELLSIZE );
-   wninsd_c( lowerEpochTime, upperEpochTime, &cnfine );
+   SpiceDouble frontCenter[3];
+   SpiceDouble backCenter[3];
+   SpiceDouble frontToward[3];
+   SpiceDouble backToward[3];
+   vhat_c( frontPosition, frontCenter );
+   vhat_c( backPosition, backCenter );
+   vperp_c( backCenter, frontCenter, frontToward );
+   if ( vzero_c( frontToward ) ) {
+      SpiceDouble axis[3] = { frontCenter[1], -frontCenter[0], 0.0 };
+      if ( vzero_c( axis ) ) {
+         axis[1] = 1.0;
+      }
+      vperp_c( axis, frontCenter, frontToward );
+   }
+   vhat_c( frontToward, frontToward );
+   vperp_c( frontCenter, backCenter, backToward );
+   if ( vzero_c( backToward ) ) {
+      vminus_c( frontToward, backToward );
+   }
+   vhat_c( backToward, backToward );
+
+   SpiceDouble frontAway[3];
+   SpiceDouble backAway[3];
+   vminus_c( frontToward, frontAway );
+   vminus_c( backToward, backAway );
+
+   SpiceDouble frontDistance = vnorm_c( frontPosition );
+   SpiceDouble backDistance  = vnorm_c( backPosition );
+   SpiceDouble separation    = vsep_c( frontPosition, backPosition );
+
+   measures[0] = separation -
+                 getDirectionalRadius(
+                    frontRadii,
+                    frontRotate,
+                    frontCenter,
+                    frontToward,
+                    frontDistance ) -
+                 getDirectionalRadius(
+                    backRadii,
+                    backRotate,
+                    backCenter,
+                    backToward,
+                    backDistance );
+   measures[1] = separation +
+                 getDirectionalRadius(
+                    backRadii,
+                    backRotate,
+                    backCenter,
+                    backAway,
+                    backDistance ) -
+                 getDirectionalRadius(
+                    frontRadii,
+                    frontRotate,
+                    frontCenter,
+                    frontToward,
+                    frontDistance );
+   measures[2] = separation +
+                 getDirectionalRadius(
+                    frontRadii,
+                    frontRotate,
+                    frontCenter,
+                    frontAway,
+                    frontDistance ) -
+                 getDirectionalRadius(
+                    backRadii,
+                    backRotate,
+                    backCenter,
+                    backToward,
+                    backDistance );
+
+}
+
+/*
+This is a helper which evaluates the signed overlap measures of the two
+bodies of the current CSPICE search at an epoch, remembering the last few.
+*/
+static void getOverlapMeasures(
+   const SpiceDouble epoch,
+   SpiceDouble       measures[3] ) {
+   for ( SpiceInt i = 0; i < 4; i++ ) {
+      if ( refinement.Epochs[i] == epoch ) {
+         measures[0] = refinement.Measures[i][0];
+         measures[1] = refinement.Measures[i][1];
+         measures[2] = refinement.Measures[i][2];
+         return;
+      }
+   }
 
    /*
-   Finally, feed our SimulationData into gfoclt_c.
+   Place the bodies as the GF occultation condition does, at their light
+   time corrected positions.
    */
-   gfoclt_c(
-      data.OccultationType.c_str(),
-      std::get<0>( data.OcculterDetails ).c_str(),
-      std::get<1>( data.OcculterDetails ).c_str(),
-      std::get<2>( data.OcculterDetails ).c_str(),
-      std::get<0>( data.TargetDetails ).c_str(),
-      std::get<1>( data.TargetDetails ).c_str(),
-      std::get<2>( data.TargetDetails ).c_str(),
+   SpiceDouble frontPosition[3];
+   SpiceDouble backPosition[3];
+   SpiceDouble frontLightTime{ 0.0 };
+   SpiceDouble backLightTime{ 0.0 };
+   spkpos_c(
+      adaptiveStep.Front.c_str(),
+      epoch,
+      "J2000",
       "LT",
-      data.ObserverName.c_str(),
-      data.StepSize,
-      &cnfine,
-      &result );
+      adaptiveStep.Observer.c_str(),
+      frontPosition,
+      &frontLightTime );
+   spkpos_c(
+      adaptiveStep.Back.c_str(),
+      epoch,
+      "J2000",
+      "LT",
+      adaptiveStep.Observer.c_str(),
+      backPosition,
+      &backLightTime );
 
-   return &result;
+   getLimbMeasures(
+      epoch,
+      frontPosition,
+      frontLightTime,
+      refinement.FrontRadii,
+      refinement.FrontFrame,
+      backPosition,
+      backLightTime,
+      refinement.BackRadii,
+      refinement.BackFrame,
+      measures );
+
+   refinement.Epochs[refinement.Next]      = epoch;
+   refinement.Measures[refinement.Next][0] = measures[0];
+   refinement.Measures[refinement.Next][1] = measures[1];
+   refinement.Measures[refinement.Next][2] = measures[2];
+   refinement.Next                         = ( refinement.Next + 1 ) % 4;
 }
 
 /*
-This is the function which is used to results of the occultation search. The
-function accepts a SpiceCell and iterates through the results.
+This is the refinement function which is handed to gfocce_c. It picks the
+next epoch at which to test the occultation state within a bracket around
+a transition.
 */
-void cppspice::reportSearchSummary( SpiceCell* result ) {
-   SpiceInt    i{ 0 };
-   SpiceDouble left{ 0.0 };
-   SpiceDouble right{ 0.0 };
-   SpiceChar   beginEpoch[TIMELEN];
-   SpiceChar   endEpoch[TIMELEN];
+static void refineTransition(
+   SpiceDouble  lowerEpoch,
+   SpiceDouble  upperEpoch,
+   SpiceBoolean /* lowerState */,
+   SpiceBoolean /* upperState */,
+   SpiceDouble* epoch ) {
    /*
    - Brief I/O
 
-      Variable  I/O  DESCRIPTION
-      --------  ---  --------------------------------------------------
-      result     I   The results which have been output by gfoclt_c.
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble   I   The left epoch of the bracket.
+      SpiceDouble   I   The right epoch of the bracket.
+      SpiceBoolean  I   The occultation state at the left epoch.
+      SpiceBoolean  I   The occultation state at the right epoch.
+      SpiceDouble   O   The next epoch to test.
 
    - Detailed_Input
 
-      result   a SpiceCell which contains the results of the occultation
-               analysis. This will be parsed and the results will be iterated
-               through so that the results can be reported.
+      lowerEpoch, upperEpoch   the bracket around the transition, in
+   seconds past J2000 TDB, which is wider than the tolerance.
+
+      lowerState, upperState   the occultation states at the ends of the
+   bracket, which differ. They aren't needed, since the measures say more.
 
    - Detailed_Output
 
-      The function returns void.
+      epoch   an epoch strictly within the bracket.
 
    - Error Handling
 
-      Any errors encountered in the CSPICE routines will be handled by
-   CSPICE's native error handling. Otherwise, error messages are reported, and
-   the function returns.
+      CSPICE components are handled using the native error handling.
 
    - Particulars
 
-      None.
-
-   - Literature_References
-
-      None.
+      gfrefn_c bisects the bracket, which takes about log2( step / tol )
+   occultation tests per transition. Here, the overlap measure whose sign
+   changes across the bracket is used instead, with the Illinois variant of
+   the secant method: the estimate is where the line through the measures
+   at the ends of the bracket crosses zero, and the measure at an end which
+   has been kept twice in a row is halved, so that both ends converge.
+
+      The measures follow the limbs along the line between the centers,
+   while zzocced finds the exact contact to within its own precision, so
+   their roots can differ from the transitions by a small offset (tens of
+   microseconds for the Earth seen from the Moon). The bracket is always
+   kept by the occultation state, never by the measures, and the epoch is
+   kept at least a stride away from both ends of the bracket. The stride
+   starts at twice the offset seen at the previous transition (or just
+   under half the tolerance), and doubles whenever the same end is kept
+   again, so that an estimate on the wrong side of the transition is
+   corrected within a few tests. When the measure no longer changes sign
+   across the bracket, its root is just outside, and the estimate is the
+   end nearest to it. The stride can't exceed half the bracket, so at
+   worst this costs about twice as many tests as bisection.
 
    - Author
 
       C.P. Westphal     (self)
 
-   - Credits
-
-      This file references the CSPICE API, which was developed by the NAIF at
-      JPL.
-
-   - Restrictions
-
-      None.
-
    - Version
 
-      -Symmetrical-Enigma Version 1.X.X, 03-SEP-2022 (CPW)
-      -Symmetrical-Enigma Version 1.0.0, 28-AUG-2022 (CPW)
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
    */
+   SpiceDouble width = upperEpoch - lowerEpoch;
+   SpiceDouble lowerMeasures[3];
+   SpiceDouble upperMeasures[3];
+   getOverlapMeasures( lowerEpoch, lowerMeasures );
+   getOverlapMeasures( upperEpoch, upperMeasures );
 
    /*
-   First check if we actually have any results.
+   If the bracket is the previous one with our epoch at one end, keep
+   going. Otherwise, this is a new transition, so note how far the previous
+   one ended up from its estimate, and pick the measure which changes sign
+   across the new bracket.
    */
-   if ( wncard_c( result ) == 0 ) {
-      std::cout
-         << "No occultations were found within the specified time window."
+   SpiceInt retained{ -1 };
+   if ( lowerEpoch == refinement.Lower &&
+        upperEpoch == refinement.Proposal )
+   {
+      retained = 0;
+   }
+   else if (
+      lowerEpoch == refinement.Proposal && upperEpoch == refinement.Upper )
+   {
+      retained = 1;
+   }
+
+   if ( retained >= 0 && refinement.Measure >= 0 ) {
+      if ( retained == refinement.Retained ) {
+         refinement.Stride *= 2.0;
+         if ( retained == 0 ) {
+            refinement.LowerMeasure *= 0.5;
+         }
+         else {
+            refinement.UpperMeasure *= 0.5;
+         }
+      }
+      if ( retained == 0 ) {
+         refinement.UpperMeasure = upperMeasures[refinement.Measure];
+      }
+      else {
+         refinement.LowerMeasure = lowerMeasures[refinement.Measure];
+      }
+      refinement.Retained = retained;
+   }
+   else if ( retained < 0 ) {
+      if ( refinement.Measure >= 0 ) {
+         refinement.Offset =
+            std::abs( refinement.Proposal - refinement.Root );
+      }
+      refinement.Measure  = -1;
+      refinement.Retained = -1;
+      refinement.Stride   = std::max(
+         0.49 * refinement.Tolerance,
+         2.0 * refinement.Offset );
+      for ( SpiceInt i = 0; i < 3; i++ ) {
+         if ( lowerMeasures[i] * upperMeasures[i] < 0.0 ) {
+            refinement.Measure      = i;
+            refinement.LowerMeasure = lowerMeasures[i];
+            refinement.UpperMeasure = upperMeasures[i];
+            break;
+         }
+      }
+   }
+
+   SpiceDouble next = lowerEpoch + 0.5 * width;
+   if ( refinement.Measure >= 0 ) {
+      if ( refinement.LowerMeasure * refinement.UpperMeasure < 0.0 ) {
+         refinement.Estimate =
+            lowerEpoch - refinement.LowerMeasure * width /
+                            ( refinement.UpperMeasure -
+                              refinement.LowerMeasure );
+         refinement.Root = refinement.Estimate;
+      }
+      else if (
+         std::abs( refinement.LowerMeasure ) <
+         std::abs( refinement.UpperMeasure ) )
+      {
+         refinement.Estimate = lowerEpoch;
+      }
+      else {
+         refinement.Estimate = upperEpoch;
+      }
+
+      SpiceDouble margin = std::min( refinement.Stride, 0.5 * width );
+      next               = std::max(
+         lowerEpoch + margin,
+         std::min( refinement.Estimate, upperEpoch - margin ) );
+   }
+
+   refinement.Lower    = lowerEpoch;
+   refinement.Upper    = upperEpoch;
+   refinement.Proposal = next;
+   *epoch              = next;
+}
+
+/*
+The bookkeeping of the current CSPICE search. gfocce_c is handed wrappers
+around the step, refinement, reporting, and interrupt functions, which count
+and time the calls they pass through to the functions held here.
+*/
+struct SearchMonitor {
+   cppspice::SearchStatistics Statistics;
+   cppspice::SearchCallback   Callback{ nullptr };
+   const cppspice::SimulationData* Data{ nullptr };
+   void ( *StepFunction )( SpiceDouble, SpiceDouble* ){ nullptr };
+   void ( *RefineFunction )(
+      SpiceDouble,
+      SpiceDouble,
+      SpiceBoolean,
+      SpiceBoolean,
+      SpiceDouble* ){ nullptr };
+   std::chrono::steady_clock::time_point Start;
+   std::chrono::steady_clock::time_point LastReport;
+   SpiceDouble WindowMeasure{ 0.0 };
+   SpiceDouble Covered{ 0.0 };
+   SpiceDouble Interval[2]{ 0.0, 0.0 };
+   SpiceInt    Intervals{ 0 };
+   SpiceDouble Bracket[2]{ 0.0, 0.0 };
+   SpiceInt    BodyIDs[2]{ 0, 0 };
+   SpiceInt    ObserverID{ 0 };
+   SpiceDouble SampledSPK{ 0.0 };
+   SpiceDouble SampledFrames{ 0.0 };
+};
+static SearchMonitor searchMonitor;
+
+/*
+This is a helper which returns the wall clock seconds since a time point.
+*/
+static SpiceDouble getSecondsSince(
+   const std::chrono::steady_clock::time_point& start ) {
+   return std::chrono::duration<double>(
+             std::chrono::steady_clock::now() - start )
+      .count();
+}
+
+/*
+This is a helper which replays the lookups of one evaluation of the
+occultation condition, and adds the time of the SPK and frame stages to the
+sampled totals. The occultation test itself can't be replayed, since the
+public routine which performs it (occult_c) reinitializes the GF condition
+which is being searched.
+*/
+static void sampleConditionStages( const SpiceDouble epoch ) {
+   const cppspice::SimulationData& data = *searchMonitor.Data;
+   const cppspice::ParticipantDetails* bodies[2] = {
+      &data.OcculterDetails,
+      &data.TargetDetails };
+
+   auto        start = std::chrono::steady_clock::now();
+   SpiceDouble position[3];
+   SpiceDouble lightTimes[2];
+   for ( SpiceInt i = 0; i < 2; i++ ) {
+      spkezp_c(
+         searchMonitor.BodyIDs[i],
+         epoch,
+         "J2000",
+         "LT",
+         searchMonitor.ObserverID,
+         position,
+         &lightTimes[i] );
+   }
+   searchMonitor.SampledSPK += getSecondsSince( start );
+
+   start = std::chrono::steady_clock::now();
+   SpiceDouble rotate[3][3];
+   for ( SpiceInt i = 0; i < 2; i++ ) {
+      if ( std::get<1>( *bodies[i] ) != "POINT" ) {
+         pxform_c(
+            std::get<2>( *bodies[i] ).c_str(),
+            "J2000",
+            epoch - lightTimes[i],
+            rotate );
+      }
+   }
+   searchMonitor.SampledFrames += getSecondsSince( start );
+   searchMonitor.Statistics.StageSamples++;
+}
+
+/*
+This is the step function which is handed to gfocce_c. It samples the
+condition stages every STAGESAMPLEINTERVAL steps, and passes the call on.
+*/
+static void monitorStep( SpiceDouble epoch, SpiceDouble* step ) {
+   cppspice::SearchStatistics& statistics = searchMonitor.Statistics;
+   if ( statistics.StepEvaluations % cppspice::STAGESAMPLEINTERVAL == 0 ) {
+      auto start = std::chrono::steady_clock::now();
+      sampleConditionStages( epoch );
+      statistics.SampleTime += getSecondsSince( start );
+   }
+
+   auto start = std::chrono::steady_clock::now();
+   searchMonitor.StepFunction( epoch, step );
+   statistics.StepTime += getSecondsSince( start );
+   statistics.StepEvaluations++;
+   statistics.CurrentEpoch = epoch;
+}
+
+/*
+This is the refinement function which is handed to gfocce_c. A bracket which
+doesn't lie within the previous one starts a new transition.
+*/
+static void monitorRefine(
+   SpiceDouble  lowerEpoch,
+   SpiceDouble  upperEpoch,
+   SpiceBoolean lowerState,
+   SpiceBoolean upperState,
+   SpiceDouble* epoch ) {
+   cppspice::SearchStatistics& statistics = searchMonitor.Statistics;
+   if ( lowerEpoch < searchMonitor.Bracket[0] ||
+        upperEpoch > searchMonitor.Bracket[1] )
+   {
+      statistics.Transitions++;
+   }
+   searchMonitor.Bracket[0] = lowerEpoch;
+   searchMonitor.Bracket[1] = upperEpoch;
+
+   auto start = std::chrono::steady_clock::now();
+   searchMonitor.RefineFunction(
+      lowerEpoch,
+      upperEpoch,
+      lowerState,
+      upperState,
+      epoch );
+   statistics.RefineTime += getSecondsSince( start );
+   statistics.RefineEvaluations++;
+   statistics.CurrentEpoch = *epoch;
+}
+
+/*
+This is the progress initialization function which is handed to gfocce_c.
+It measures the confinement window and starts the clock.
+*/
+static void monitorReportInit(
+   SpiceCell*      cnfine,
+   ConstSpiceChar* /* prefix */,
+   ConstSpiceChar* /* suffix */ ) {
+   searchMonitor.WindowMeasure = 0.0;
+   for ( SpiceInt i = 0; i < wncard_c( cnfine ); i++ ) {
+      SpiceDouble left{ 0.0 };
+      SpiceDouble right{ 0.0 };
+      wnfetd_c( cnfine, i, &left, &right );
+      searchMonitor.WindowMeasure += right - left;
+   }
+   searchMonitor.Start      = std::chrono::steady_clock::now();
+   searchMonitor.LastReport = searchMonitor.Start;
+}
+
+/*
+This is the progress update function which is handed to gfocce_c, with the
+interval being searched and the latest epoch whose state is known. A line of
+progress is written at most every PROGRESSINTERVAL seconds.
+*/
+static void monitorReportUpdate(
+   SpiceDouble intervalBegin,
+   SpiceDouble intervalEnd,
+   SpiceDouble epoch ) {
+   auto                        start      = std::chrono::steady_clock::now();
+   cppspice::SearchStatistics& statistics = searchMonitor.Statistics;
+   if ( searchMonitor.Intervals == 0 ||
+        intervalBegin != searchMonitor.Interval[0] )
+   {
+      if ( searchMonitor.Intervals > 0 ) {
+         searchMonitor.Covered +=
+            searchMonitor.Interval[1] - searchMonitor.Interval[0];
+      }
+      searchMonitor.Interval[0] = intervalBegin;
+      searchMonitor.Interval[1] = intervalEnd;
+      searchMonitor.Intervals++;
+   }
+
+   if ( searchMonitor.WindowMeasure > 0.0 ) {
+      statistics.Fraction =
+         ( searchMonitor.Covered + epoch - intervalBegin ) /
+         searchMonitor.WindowMeasure;
+   }
+   statistics.CurrentEpoch = epoch;
+
+   if ( getSecondsSince( searchMonitor.LastReport ) >=
+        cppspice::PROGRESSINTERVAL )
+   {
+      SpiceChar epochString[cppspice::TIMELEN];
+      et2utc_c( epoch, "C", 0, cppspice::TIMELEN, epochString );
+      auto precision = std::cout.precision( 1 );
+      std::cout << "Search progress: " << std::fixed
+                << 100.0 * statistics.Fraction << "% (" << epochString
+                << "), "
+                << searchMonitor.Intervals + statistics.StepEvaluations +
+                      statistics.RefineEvaluations
+                << " evaluations" << std::defaultfloat << std::endl;
+      std::cout.precision( precision );
+      searchMonitor.LastReport = std::chrono::steady_clock::now();
+   }
+   statistics.ReportTime += getSecondsSince( start );
+}
+
+/*
+This is the progress finalization function which is handed to gfocce_c.
+*/
+static void monitorReportFinal() {
+   searchMonitor.Statistics.ElapsedTime =
+      getSecondsSince( searchMonitor.Start );
+}
+
+/*
+This is the interrupt function which is handed to gfocce_c. The search is
+cancelled by an interrupt signal (caught by gfinth_c), or by the callback.
+Once cancelled, it keeps returning true, as gfocce_c requires.
+*/
+static SpiceBoolean monitorBail() {
+   cppspice::SearchStatistics& statistics = searchMonitor.Statistics;
+   if ( !statistics.Cancelled ) {
+      statistics.ElapsedTime = getSecondsSince( searchMonitor.Start );
+      statistics.Cancelled =
+         gfbail_c() || ( searchMonitor.Callback != nullptr &&
+                         searchMonitor.Callback( statistics ) );
+   }
+   return statistics.Cancelled ? SPICETRUE : SPICEFALSE;
+}
+
+/*
+A function which sets the callback which can cancel a CSPICE search.
+*/
+void cppspice::setSearchCallback( SearchCallback callback ) {
+   searchMonitor.Callback = callback;
+}
+
+/*
+A function which returns the statistics of the latest CSPICE search.
+*/
+const cppspice::SearchStatistics& cppspice::getSearchStatistics() {
+   return searchMonitor.Statistics;
+}
+
+/*
+A function which writes search statistics as a JSON object.
+*/
+void cppspice::reportSearchStatistics( const SearchStatistics& statistics ) {
+   /*
+   - Brief I/O
+
+      Variable          I/O  DESCRIPTION
+      --------          ---  --------------------------------------------
+      SearchStatistics   I   The statistics of a CSPICE search.
+
+   - Detailed_Input
+
+      statistics   the counters, timers, and progress of a search, as
+   returned by getSearchStatistics.
+
+   - Detailed_Output
+
+      The function returns void. The object is written to standard output.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The keys are the names of the SearchStatistics members, with the
+   times in seconds. The keys ending in Estimate are estimates rather than
+   measurements (see SearchStatistics).
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   auto precision = std::cout.precision( 6 );
+   std::cout << "{\n"
+             << "   \"ConditionEvaluationsEstimate\": "
+             << statistics.ConditionEvaluationsEstimate << ",\n"
+             << "   \"StepEvaluations\": " << statistics.StepEvaluations
+             << ",\n"
+             << "   \"RefineEvaluations\": " << statistics.RefineEvaluations
+             << ",\n"
+             << "   \"Transitions\": " << statistics.Transitions << ",\n"
+             << "   \"CurrentEpoch\": " << std::fixed
+             << statistics.CurrentEpoch << std::defaultfloat << ",\n"
+             << "   \"Fraction\": " << statistics.Fraction << ",\n"
+             << "   \"Cancelled\": "
+             << ( statistics.Cancelled ? "true" : "false" ) << ",\n"
+             << "   \"ElapsedTime\": " << statistics.ElapsedTime << ",\n"
+             << "   \"StepTime\": " << statistics.StepTime << ",\n"
+             << "   \"RefineTime\": " << statistics.RefineTime << ",\n"
+             << "   \"ReportTime\": " << statistics.ReportTime << ",\n"
+             << "   \"SampleTime\": " << statistics.SampleTime << ",\n"
+             << "   \"ConditionTime\": " << statistics.ConditionTime
+             << ",\n"
+             << "   \"StageSamples\": " << statistics.StageSamples << ",\n"
+             << "   \"SPKTimeEstimate\": " << statistics.SPKTimeEstimate
+             << ",\n"
+             << "   \"FrameTimeEstimate\": " << statistics.FrameTimeEstimate
+             << ",\n"
+             << "   \"OccultationTimeEstimate\": "
+             << statistics.OccultationTimeEstimate << "\n"
+             << "}" << std::endl;
+   std::cout.precision( precision );
+}
+
+/*
+This is the function which is used to perform the occultation search using
+the cspice gfoclt_c routine. We feed in the SimulationData which was
+retrieved prior to this call.
+*/
+SpiceCell* cppspice::performCSPICEOccSrch( const SimulationData& data ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data which is fed into gfoclt_c.
+
+   - Detailed_Input
+
+      data     a struct which contains the simulation data used in the
+               occultation analysis. The struct members include:
+
+                  LowerBoundEpoch:  The epoch in TDB which begins the range.
+                  UpperBoundEpoch   The epoch in TDB which ends the range.
+                  StepSize          The step size in seconds.
+                  OccultationType   The type of the occultation. The supported
+                                    values are outlined in gfoclt_c.c
+                  OcculterDetails   A tuple containing the occulting object's
+                                    name, shape, and reference frame.
+                  TargetDetails     A tuple containing the occulting object's
+                                    name, shape, and reference frame.
+                  ObserverName      The name of the observing object.
+                  Tolerance         The tolerance in seconds.
+                  StepMode          FIXED or ADAPTIVE.
+                  RefineMode        BISECTION or SECANT.
+                  SearchMonitor     NONE or PROGRESS.
+
+   - Detailed_Output
+
+      The function returns a SPICE window representing the set of time
+   intervals, within the confinement period, when the specified occultation
+   occurs.
+
+      The endpoints of the time intervals comprising 'result' are interpreted
+   as seconds past J2000 TDB.
+
+      If the radii of the bodies can't be read for the ADAPTIVE step mode or
+   the SECANT refine mode, nullptr is returned instead.
+
+   - Error Handling
+
+      This function's error handling is performed by the CSPICE API. Errors
+   reading the radii of the bodies are reported, and nullptr is returned.
+
+   - Particulars
+
+      For more information, please see the CSPICE documentation for gfoclt_c.
+
+      In the FIXED step mode, which is the default, the window is stepped
+   through at StepSize as gfoclt_c does. In the ADAPTIVE step mode,
+   gfocce_c is handed a step function which takes long steps wherever the
+   bodies are far from any contact (see getAdaptiveStep). StepSize then only
+   sets the shortest step, and so the shortest event which is guaranteed to
+   be found. A search with a DSK body always steps at StepSize.
+
+      In the BISECTION refine mode, which is the default, each transition is
+   narrowed down by bisection as gfoclt_c does. In the SECANT refine mode,
+   it is narrowed down with secant steps on a continuous overlap measure
+   instead (see refineTransition). The state of a point target can flicker
+   within microseconds of a transition, where the two may then differ.
+
+      With the defaults, the search is gfoclt_c's own. Otherwise gfocce_c is
+   called directly, with the step and refinement functions which were asked
+   for.
+
+      With the PROGRESS search monitor, the search is followed through the
+   functions which are handed to gfocce_c. Progress is written as it goes,
+   and the final statistics are written as a JSON object (see
+   reportSearchStatistics). The search can be cancelled with an interrupt
+   signal, or by the callback which was set with setSearchCallback, in
+   which case the results cover the window up to the epoch it had reached.
+
+   - Literature_References
+
+      CSPICE's documentation.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+      -Symmetrical-Enigma Version 1.X.X, 03-SEP-2022 (CPW)
+      -Symmetrical-Enigma Version 1.0.0, 28-AUG-2022 (CPW)
+   */
+
+   /*
+   First, let's convert the epoch bounds to doubles representing seconds
+   from J2000.
+   */
+   SpiceDouble lowerEpochTime{ 0.0 };
+   SpiceDouble upperEpochTime{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpochTime );
+   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpochTime );
+
+   /*
+   Next, let's configure the cnfine using our bounds.
+   */
+   SPICEDOUBLE_CELL( cnfine, CELLSIZE );
+   SPICEDOUBLE_CELL( result, CELLSIZE );
+   wninsd_c( lowerEpochTime, upperEpochTime, &cnfine );
+
+   /*
+   The adaptive step and the secant refinement work from the ellipsoids of
+   the bodies, which don't bound a plate model, so a search with a DSK body
+   steps and refines as gfoclt_c does.
+   */
+   bool hasShapeModel =
+      std::get<1>( data.OcculterDetails ) == "DSK/UNPRIORITIZED" ||
+      std::get<1>( data.TargetDetails ) == "DSK/UNPRIORITIZED";
+   bool adaptive  = data.StepMode == "ADAPTIVE" && !hasShapeModel;
+   bool secant    = data.RefineMode == "SECANT" && !hasShapeModel;
+   bool monitored = data.SearchMonitor == "PROGRESS";
+   searchMonitor.Statistics = SearchStatistics();
+
+   /*
+   A search which steps, refines, and reports as gfoclt_c does is left to
+   it.
+   */
+   if ( !adaptive && !secant && !monitored ) {
+      gfoclt_c(
+         data.OccultationType.c_str(),
+         std::get<0>( data.OcculterDetails ).c_str(),
+         std::get<1>( data.OcculterDetails ).c_str(),
+         std::get<2>( data.OcculterDetails ).c_str(),
+         std::get<0>( data.TargetDetails ).c_str(),
+         std::get<1>( data.TargetDetails ).c_str(),
+         std::get<2>( data.TargetDetails ).c_str(),
+         "LT",
+         data.ObserverName.c_str(),
+         data.StepSize,
+         &cnfine,
+         &result );
+
+      return &result;
+   }
+
+   /*
+   Otherwise, hand gfocce_c the requested step and refinement functions.
+   gfoclt_c makes the same call with gfstep_c and gfrefn_c.
+   */
+   adaptiveStep.Front       = std::get<0>( data.OcculterDetails );
+   adaptiveStep.Back        = std::get<0>( data.TargetDetails );
+   adaptiveStep.Observer    = data.ObserverName;
+   adaptiveStep.MinimumStep = data.StepSize;
+   if ( !hasShapeModel &&
+        ( !getRadiusBounds( data.OcculterDetails, adaptiveStep.FrontRadii ) ||
+          !getRadiusBounds( data.TargetDetails, adaptiveStep.BackRadii ) ||
+          !getRadii( data.OcculterDetails, refinement.FrontRadii ) ||
+          !getRadii( data.TargetDetails, refinement.BackRadii ) ) )
+   {
+      return nullptr;
+   }
+
+   refinement.FrontFrame = std::get<2>( data.OcculterDetails );
+   refinement.BackFrame  = std::get<2>( data.TargetDetails );
+   refinement.Tolerance  = SPICE_GF_CNVTOL;
+   refinement.Lower      = -dpmax_c();
+   refinement.Upper      = -dpmax_c();
+   refinement.Proposal   = -dpmax_c();
+   refinement.Measure    = -1;
+   refinement.Offset     = 0.0;
+   refinement.Next       = 0;
+   for ( SpiceInt i = 0; i < 4; i++ ) {
+      refinement.Epochs[i] = -dpmax_c();
+   }
+
+   searchMonitor.StepFunction   = getAdaptiveStep;
+   searchMonitor.RefineFunction = refineTransition;
+   if ( !adaptive ) {
+      gfsstp_c( data.StepSize );
+      searchMonitor.StepFunction = gfstep_c;
+   }
+   if ( !secant ) {
+      searchMonitor.RefineFunction = gfrefn_c;
+   }
+
+   /*
+   An unmonitored search reports and bails as gfoclt_c's does.
+   */
+   if ( !monitored ) {
+      gfocce_c(
+         data.OccultationType.c_str(),
+         std::get<0>( data.OcculterDetails ).c_str(),
+         std::get<1>( data.OcculterDetails ).c_str(),
+         std::get<2>( data.OcculterDetails ).c_str(),
+         std::get<0>( data.TargetDetails ).c_str(),
+         std::get<1>( data.TargetDetails ).c_str(),
+         std::get<2>( data.TargetDetails ).c_str(),
+         "LT",
+         data.ObserverName.c_str(),
+         refinement.Tolerance,
+         searchMonitor.StepFunction,
+         searchMonitor.RefineFunction,
+         SPICEFALSE,
+         gfrepi_c,
+         gfrepu_c,
+         gfrepf_c,
+         SPICEFALSE,
+         gfbail_c,
+         &cnfine,
+         &result );
+
+      return &result;
+   }
+
+   /*
+   A monitored search is handed wrappers around those functions, which
+   follow it as it goes.
+   */
+   searchMonitor.Data          = &data;
+   searchMonitor.Covered       = 0.0;
+   searchMonitor.Intervals     = 0;
+   searchMonitor.Bracket[0]    = dpmax_c();
+   searchMonitor.Bracket[1]    = -dpmax_c();
+   searchMonitor.SampledSPK    = 0.0;
+   searchMonitor.SampledFrames = 0.0;
+   SpiceBoolean found{ SPICEFALSE };
+   bods2c_c(
+      std::get<0>( data.OcculterDetails ).c_str(),
+      &searchMonitor.BodyIDs[0],
+      &found );
+   bods2c_c(
+      std::get<0>( data.TargetDetails ).c_str(),
+      &searchMonitor.BodyIDs[1],
+      &found );
+   bods2c_c( data.ObserverName.c_str(), &searchMonitor.ObserverID, &found );
+
+   /*
+   The interrupt signal is caught by gfinth_c for the duration of the
+   search, as gfocce_c only does that itself for gfbail_c.
+   */
+   auto previousHandler = signal( SIGINT, gfinth_c );
+
+   gfocce_c(
+      data.OccultationType.c_str(),
+      std::get<0>( data.OcculterDetails ).c_str(),
+      std::get<1>( data.OcculterDetails ).c_str(),
+      std::get<2>( data.OcculterDetails ).c_str(),
+      std::get<0>( data.TargetDetails ).c_str(),
+      std::get<1>( data.TargetDetails ).c_str(),
+      std::get<2>( data.TargetDetails ).c_str(),
+      "LT",
+      data.ObserverName.c_str(),
+      refinement.Tolerance,
+      monitorStep,
+      monitorRefine,
+      SPICETRUE,
+      monitorReportInit,
+      monitorReportUpdate,
+      monitorReportFinal,
+      SPICETRUE,
+      monitorBail,
+      &cnfine,
+      &result );
+
+   if ( previousHandler != SIG_ERR ) {
+      signal( SIGINT, previousHandler );
+   }
+   gfclrh_c();
+
+   /*
+   Every step and refinement is followed by one evaluation of the condition,
+   as is the start of every interval, which gives an estimate of their
+   number. Whatever time the search didn't spend in our functions went to
+   those evaluations. The SPK and frame stages are estimated from their
+   mean sampled times, and the occultation test from what remains. The
+   estimates are left as they are, so that an overshoot shows as a
+   negative occultation time rather than being clamped away.
+   */
+   SearchStatistics& statistics = searchMonitor.Statistics;
+   statistics.ElapsedTime = getSecondsSince( searchMonitor.Start );
+   statistics.ConditionEvaluationsEstimate = searchMonitor.Intervals +
+                                     statistics.StepEvaluations +
+                                     statistics.RefineEvaluations;
+   statistics.ConditionTime = std::max(
+      0.0,
+      statistics.ElapsedTime - statistics.StepTime -
+         statistics.RefineTime - statistics.ReportTime -
+         statistics.SampleTime );
+   if ( statistics.StageSamples > 0 ) {
+      SpiceDouble scale =
+         static_cast<SpiceDouble>( statistics.ConditionEvaluationsEstimate ) /
+         statistics.StageSamples;
+      statistics.SPKTimeEstimate   = scale * searchMonitor.SampledSPK;
+      statistics.FrameTimeEstimate = scale * searchMonitor.SampledFrames;
+      statistics.OccultationTimeEstimate =
+         statistics.ConditionTime - statistics.SPKTimeEstimate -
+         statistics.FrameTimeEstimate;
+   }
+
+   if ( statistics.Cancelled ) {
+      SpiceChar epochString[TIMELEN];
+      et2utc_c( statistics.CurrentEpoch, "C", 0, TIMELEN, epochString );
+      std::cout << "The search was cancelled at " << epochString
+                << ", so the results only cover the window up to then."
+                << std::endl;
+   }
+   reportSearchStatistics( statistics );
+
+   return &result;
+}
+
+/*
+The measures of an occultation event at one epoch: the overlap measures for
+first and last contact, full occultation, and annular occultation, and half
+the rate of the squared separation of the centers, followed by the
+separation itself. The rate of the separation alone jumps from negative to
+positive when the centers pass close to each other, which would leave the
+secant steps no better than bisection.
+*/
+struct ContactSample {
+   SpiceDouble Epoch;
+   SpiceDouble Measures[4];
+   SpiceDouble Separation;
+};
+
+/*
+The participants of an event whose contacts are being found, and every
+epoch which has been evaluated for it, in order. All of the contacts are
+found from these samples, so an epoch which brackets one contact also
+brackets the others.
+*/
+struct ContactSearch {
+   std::string                Front;
+   std::string                Back;
+   std::string                Observer;
+   std::string                FrontFrame;
+   std::string                BackFrame;
+   SpiceDouble                FrontRadii[3];
+   SpiceDouble                BackRadii[3];
+   std::vector<ContactSample> Samples;
+};
+
+/*
+This is a helper which evaluates the measures of an event at an epoch, or
+finds them among those already evaluated.
+*/
+static const ContactSample& getContactSample(
+   ContactSearch&    search,
+   const SpiceDouble epoch ) {
+   auto sample = std::lower_bound(
+      search.Samples.begin(),
+      search.Samples.end(),
+      epoch,
+      []( const ContactSample& a, SpiceDouble b ) { return a.Epoch < b; } );
+   if ( sample != search.Samples.end() && sample->Epoch == epoch ) {
+      return *sample;
+   }
+
+   /*
+   One state of each body gives both the overlap measures and the rate of
+   the separation.
+   */
+   SpiceDouble   frontState[6];
+   SpiceDouble   backState[6];
+   SpiceDouble   frontLightTime{ 0.0 };
+   SpiceDouble   backLightTime{ 0.0 };
+   ContactSample result;
+   spkezr_c(
+      search.Front.c_str(),
+      epoch,
+      "J2000",
+      "LT",
+      search.Observer.c_str(),
+      frontState,
+      &frontLightTime );
+   spkezr_c(
+      search.Back.c_str(),
+      epoch,
+      "J2000",
+      "LT",
+      search.Observer.c_str(),
+      backState,
+      &backLightTime );
+   getLimbMeasures(
+      epoch,
+      frontState,
+      frontLightTime,
+      search.FrontRadii,
+      search.FrontFrame,
+      backState,
+      backLightTime,
+      search.BackRadii,
+      search.BackFrame,
+      result.Measures );
+   result.Epoch       = epoch;
+   result.Separation  = vsep_c( frontState, backState );
+   result.Measures[3] = result.Separation * dvsep_c( frontState, backState );
+   return *search.Samples.insert( sample, result );
+}
+
+/*
+This is a helper which finds where one of the measures of an event crosses
+zero within a span.
+*/
+static bool findContactRoot(
+   ContactSearch&    search,
+   const SpiceInt    measure,
+   const SpiceDouble lowerEpoch,
+   const SpiceDouble upperEpoch,
+   const SpiceDouble tolerance,
+   SpiceDouble&      root ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct       I/O  The event's participants and samples.
+      SpiceInt      I   The index of the measure.
+      SpiceDouble   I   The start of the span.
+      SpiceDouble   I   The end of the span.
+      SpiceDouble   I   The tolerance, in seconds.
+      SpiceDouble   O   The epoch at which the measure crosses zero.
+
+   - Detailed_Input
+
+      search      the event, whose samples include both ends of the span.
+      measure     the index of the measure within a ContactSample.
+      lowerEpoch  the start of the span, in seconds past J2000 TDB.
+      upperEpoch  the end of the span.
+      tolerance   the largest error which is acceptable in the root.
+
+   - Detailed_Output
+
+      root        the epoch at which the measure crosses zero.
+
+      The function returns false if the measure doesn't change sign across
+   the samples within the span, in which case root is not changed.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Particulars
+
+      The root is bracketed by the closest pair of samples on either side of
+   it, whichever root they were evaluated for, and then narrowed down with
+   the Illinois variant of the secant method, as the SECANT refinement of
+   the CSPICE search does.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble lower{ 0.0 };
+   SpiceDouble upper{ 0.0 };
+   SpiceDouble lowerMeasure{ 0.0 };
+   SpiceDouble upperMeasure{ 0.0 };
+   bool        bracketed{ false };
+   for ( size_t i = 1; i < search.Samples.size() && !bracketed; i++ ) {
+      const ContactSample& before = search.Samples[i - 1];
+      const ContactSample& after  = search.Samples[i];
+      if ( before.Epoch < lowerEpoch || after.Epoch > upperEpoch ) {
+         continue;
+      }
+      if ( ( before.Measures[measure] < 0.0 ) !=
+           ( after.Measures[measure] < 0.0 ) )
+      {
+         lower        = before.Epoch;
+         upper        = after.Epoch;
+         lowerMeasure = before.Measures[measure];
+         upperMeasure = after.Measures[measure];
+         bracketed    = true;
+      }
+   }
+   if ( !bracketed ) {
+      return false;
+   }
+
+   SpiceInt retained{ -1 };
+   for ( SpiceInt i = 0; i < cppspice::ITERLIMIT && upper - lower > tolerance;
+         i++ )
+   {
+      /*
+      Keep the next epoch a little inside the bracket, so that it always
+      shrinks by at least a fraction of the tolerance.
+      */
+      SpiceDouble width  = upper - lower;
+      SpiceDouble margin = std::min( 0.25 * tolerance, 0.5 * width );
+      SpiceDouble next =
+         lower - lowerMeasure * width / ( upperMeasure - lowerMeasure );
+      next = std::max( lower + margin, std::min( next, upper - margin ) );
+
+      SpiceDouble value = getContactSample( search, next ).Measures[measure];
+      if ( ( value < 0.0 ) == ( lowerMeasure < 0.0 ) ) {
+         lower        = next;
+         lowerMeasure = value;
+         if ( retained == 0 ) {
+            upperMeasure *= 0.5;
+         }
+         retained = 0;
+      }
+      else {
+         upper        = next;
+         upperMeasure = value;
+         if ( retained == 1 ) {
+            lowerMeasure *= 0.5;
+         }
+         retained = 1;
+      }
+   }
+
+   root = 0.5 * ( lower + upper );
+   return true;
+}
+
+/*
+This function finds the contacts of the occultation event around an
+interval found by a search.
+*/
+bool cppspice::getEventContacts(
+   const SimulationData& data,
+   const SpiceDouble     lowerEpoch,
+   const SpiceDouble     upperEpoch,
+   EventContacts&        contacts ) {
+   /*
+   - Brief I/O
+
+      Variable       I/O  DESCRIPTION
+      --------       ---  -----------------------------------------------
+      data            I   The simulation data.
+      SpiceDouble     I   The start of the interval.
+      SpiceDouble     I   The end of the interval.
+      EventContacts   O   The contacts of the event.
+
+   - Detailed_Input
+
+      data        the simulation data, of which the participants, span,
+                  step size, and tolerance are used.
+      lowerEpoch  the start of an interval found by either search, of any
+                  occultation type, in seconds past J2000 TDB.
+      upperEpoch  the end of the interval.
+
+   - Detailed_Output
+
+      contacts    the type of the event, as the most complete occultation
+   type it reaches, its contacts C1 to C4 and epoch of greatest occultation
+   to within the tolerance, the separation of the centers then, and the
+   number of epochs evaluated to find them. Contacts the event doesn't have,
+   or which are outside the simulation's span, are NaN.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Finding the four contacts and greatest occultation with gfoclt_c and
+   gfsep_c takes a search for each occultation type and another for the
+   minimum of the separation, each stepping through the span and refining
+   its own transitions. Here, the interval is first widened, doubling the
+   step each time, until the bodies are apart at both ends. The rate of the
+   separation is then zero at greatest occultation, between the ends, and
+   the first contact measure crosses zero on either side of it for C1 and
+   C4. If the full or annular measure is negative at greatest occultation,
+   it crosses zero between C1 and greatest occultation, and between that
+   and C4, for C2 and C3.
+
+      Every epoch is evaluated once, from one state of each body, for all
+   of the measures, and every root search starts from the closest samples
+   already evaluated around it, so the whole event takes about as many
+   evaluations as refining a single transition by bisection.
+
+      The limbs are measured along the line between the centers of the
+   ellipsoids (see getOverlapMeasures), so a body with a DSK shape is taken
+   as its ellipsoid here.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ContactSearch search;
+   search.Front      = std::get<0>( data.OcculterDetails );
+   search.Back       = std::get<0>( data.TargetDetails );
+   search.Observer   = data.ObserverName;
+   search.FrontFrame = std::get<2>( data.OcculterDetails );
+   search.BackFrame  = std::get<2>( data.TargetDetails );
+   if ( !getRadii( data.OcculterDetails, search.FrontRadii ) ||
+        !getRadii( data.TargetDetails, search.BackRadii ) )
+   {
+      return false;
+   }
+
+   SpiceDouble spanLower{ 0.0 };
+   SpiceDouble spanUpper{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &spanLower );
+   str2et_c( data.UpperBoundEpoch.c_str(), &spanUpper );
+
+   const SpiceDouble missing = std::numeric_limits<SpiceDouble>::quiet_NaN();
+   for ( auto& contact : contacts.Contacts ) {
+      contact = missing;
+   }
+   contacts.Greatest   = missing;
+   contacts.Separation = missing;
+
+   /*
+   Widen the interval until the bodies are apart at both ends, or it
+   reaches the ends of the span.
+   */
+   SpiceDouble lower = lowerEpoch;
+   SpiceDouble step  = data.StepSize;
+   while ( getContactSample( search, lower ).Measures[0] < 0.0 &&
+           lower > spanLower )
+   {
+      lower = std::max( spanLower, lower - step );
+      step *= 2.0;
+   }
+   SpiceDouble upper = upperEpoch;
+   step              = data.StepSize;
+   while ( getContactSample( search, upper ).Measures[0] < 0.0 &&
+           upper < spanUpper )
+   {
+      upper = std::min( spanUpper, upper + step );
+      step *= 2.0;
+   }
+
+   /*
+   Greatest occultation divides the event into its ingress and egress. If
+   it isn't within the span, the closest end stands in for it.
+   */
+   SpiceDouble greatest = upper;
+   if ( findContactRoot(
+           search,
+           3,
+           lower,
+           upper,
+           data.Tolerance,
+           greatest ) )
+   {
+      contacts.Greatest = greatest;
+   }
+   else if (
+      getContactSample( search, lower ).Separation <
+      getContactSample( search, upper ).Separation )
+   {
+      greatest = lower;
+   }
+   contacts.Separation = getContactSample( search, greatest ).Separation;
+
+   findContactRoot(
+      search,
+      0,
+      lower,
+      greatest,
+      data.Tolerance,
+      contacts.Contacts[0] );
+   findContactRoot(
+      search,
+      0,
+      greatest,
+      upper,
+      data.Tolerance,
+      contacts.Contacts[3] );
+
+   ContactSample center  = getContactSample( search, greatest );
+   SpiceInt      measure = -1;
+   contacts.Type         = "PARTIAL";
+   if ( center.Measures[1] < 0.0 ) {
+      measure       = 1;
+      contacts.Type = "FULL";
+   }
+   else if ( center.Measures[2] < 0.0 ) {
+      measure       = 2;
+      contacts.Type = "ANNULAR";
+   }
+   if ( measure > 0 ) {
+      findContactRoot(
+         search,
+         measure,
+         std::isnan( contacts.Contacts[0] ) ? lower : contacts.Contacts[0],
+         greatest,
+         data.Tolerance,
+         contacts.Contacts[1] );
+      findContactRoot(
+         search,
+         measure,
+         greatest,
+         std::isnan( contacts.Contacts[3] ) ? upper : contacts.Contacts[3],
+         data.Tolerance,
+         contacts.Contacts[2] );
+   }
+
+   contacts.Evaluations = static_cast<SpiceInt>( search.Samples.size() );
+   return true;
+}
+
+/*
+This function finds the contacts of every event in a search's results.
+*/
+bool cppspice::getSearchEvents(
+   const SimulationData&       data,
+   SpiceCell*                  result,
+   std::vector<EventContacts>& events ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+      result     I   The intervals found by a search.
+      vector     O   The contacts of each event.
+
+   - Detailed_Input
+
+      data     the simulation data which the search was run with.
+      result   a SPICE window of the intervals found by either search.
+
+   - Detailed_Output
+
+      events   the contacts of each event, in order.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      An event can hold several intervals, such as the two partial phases
+   of a full occultation which a PARTIAL search finds, so an interval
+   which ends before the last contact of the previous event is skipped.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   events.clear();
+   SpiceDouble covered = -dpmax_c();
+   for ( SpiceInt i = 0; i < wncard_c( result ); i++ ) {
+      SpiceDouble left{ 0.0 };
+      SpiceDouble right{ 0.0 };
+      wnfetd_c( result, i, &left, &right );
+      if ( right <= covered ) {
+         continue;
+      }
+
+      EventContacts contacts;
+      if ( !getEventContacts( data, left, right, contacts ) ) {
+         return false;
+      }
+      covered = std::isnan( contacts.Contacts[3] ) ? dpmax_c()
+                                                   : contacts.Contacts[3];
+      events.push_back( contacts );
+   }
+   return true;
+}
+
+/*
+This function writes the contacts of every event in a search's results as a
+JSON object.
+*/
+bool cppspice::reportEventContacts(
+   const SimulationData& data,
+   SpiceCell*            result ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+      result     I   The intervals found by a search.
+
+   - Detailed_Input
+
+      data     the simulation data which the search was run with.
+      result   a SPICE window of the intervals found by either search.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered. The object is
+   written to standard output, with an entry in its Events array for each
+   event, holding the members of its EventContacts. Epochs are in seconds
+   past J2000 TDB, the separation is in radians, and missing contacts are
+   null.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The events are found with getSearchEvents.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<EventContacts> events;
+   if ( !getSearchEvents( data, result, events ) ) {
+      return false;
+   }
+
+   auto writeEpoch = []( SpiceDouble epoch ) {
+      if ( std::isnan( epoch ) ) {
+         std::cout << "null";
+      }
+      else {
+         std::cout << std::fixed << epoch << std::defaultfloat;
+      }
+   };
+
+   auto precision = std::cout.precision( 6 );
+   std::cout << "{\n   \"Events\": [";
+   for ( size_t i = 0; i < events.size(); i++ ) {
+      const EventContacts& event = events[i];
+      std::cout << ( i > 0 ? "," : "" ) << "\n      {\n"
+                << "         \"Type\": \"" << event.Type << "\",\n";
+      for ( SpiceInt k = 0; k < 4; k++ ) {
+         std::cout << "         \"C" << k + 1 << "\": ";
+         writeEpoch( event.Contacts[k] );
+         std::cout << ",\n";
+      }
+      std::cout << "         \"Greatest\": ";
+      writeEpoch( event.Greatest );
+      std::cout << ",\n"
+                << "         \"Separation\": " << event.Separation << ",\n"
+                << "         \"Evaluations\": " << event.Evaluations
+                << "\n      }";
+   }
+   std::cout << ( events.empty() ? "]\n" : "\n   ]\n" ) << "}" << std::endl;
+   std::cout.precision( precision );
+   return true;
+}
+
+/*
+This is the function which is used to results of the occultation search. The
+function accepts a SpiceCell and iterates through the results.
+*/
+void cppspice::reportSearchSummary( SpiceCell* result ) {
+   SpiceInt    i{ 0 };
+   SpiceDouble left{ 0.0 };
+   SpiceDouble right{ 0.0 };
+   SpiceChar   beginEpoch[TIMELEN];
+   SpiceChar   endEpoch[TIMELEN];
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      result     I   The results which have been output by gfoclt_c.
+
+   - Detailed_Input
+
+      result   a SpiceCell which contains the results of the occultation
+               analysis. This will be parsed and the results will be iterated
+               through so that the results can be reported.
+
+   - Detailed_Output
+
+      The function returns void.
+
+   - Error Handling
+
+      Any errors encountered in the CSPICE routines will be handled by
+   CSPICE's native error handling. Otherwise, error messages are reported, and
+   the function returns.
+
+   - Particulars
+
+      None.
+
+   - Literature_References
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      -Symmetrical-Enigma Version 1.X.X, 03-SEP-2022 (CPW)
+      -Symmetrical-Enigma Version 1.0.0, 28-AUG-2022 (CPW)
+   */
+
+   /*
+   First check if we actually have any results.
+   */
+   if ( wncard_c( result ) == 0 ) {
+      std::cout
+         << "No occultations were found within the specified time window."
          << std::endl;
    }
    else {
@@ -930,4 +2770,248 @@ void cppspice::reportSearchSummary( SpiceCell* result ) {
       out.close();
    }
 }
+/*
+A function which times the GF sphere pre-classifier against zzocced_, and
+checks that they agree.
+*/
+void cppspice::benchmarkOccultationSpheres( const SpiceInt count ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      SpiceInt   I   The number of random geometries to classify.
+
+   - Detailed_Input
+
+      count   the number of random geometries to classify with each
+   approach. They are drawn from a fixed pseudorandom sequence, so that a
+   run can be repeated exactly.
+
+   - Detailed_Output
+
+      None. The time per geometry of zzocsph_ and of zzocced_ is reported,
+   along with the share of geometries which zzocsph_ decides, the number
+   decided with each occultation code, and the number of decided
+   geometries for which the two differ.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported.
+
+   - Particulars
+
+      Each geometry is a pair of randomly oriented triaxial ellipsoids seen
+   from the origin, with their largest radii between 1 and 1000 km and
+   their distances between about 1 and 1000 times those radii. Their
+   angular separation is placed close to one of the angles at which the
+   pre-classifier's decision changes, or is drawn at random, so that its
+   margins are exercised as well as its easy cases. Geometries in which
+   the circumscribed spheres overlap are drawn again, as such bodies
+   can't both be real.
+
+      zzocsph_ stands in for zzocced_ within the GF occultation search, so
+   this check is worth rerunning whenever CSPICE is updated.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   struct SphereGeometry {
+      SpiceDouble BackPosition[3];
+      SpiceDouble BackSemiAxes[3][3];
+      SpiceDouble BackMin;
+      SpiceDouble BackMax;
+      SpiceDouble FrontPosition[3];
+      SpiceDouble FrontSemiAxes[3][3];
+      SpiceDouble FrontMin;
+      SpiceDouble FrontMax;
+   };
+
+   unsigned long long seed = 88172645463325252ULL;
+   auto               next = [&seed]() {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      return static_cast<SpiceDouble>( seed >> 11 ) / 9007199254740992.0;
+   };
+   auto nextDirection = [&next]( SpiceDouble direction[3] ) {
+      do {
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            direction[k] = 2.0 * next() - 1.0;
+         }
+      } while ( vnorm_c( direction ) < 1.0e-3 );
+      vhat_c( direction, direction );
+   };
+
+   /*
+   The semi-axis matrices are passed to zzocced_ in column-major order, so
+   each row here holds one semi-axis vector.
+   */
+   auto nextEllipsoid = [&next](
+                           SpiceDouble  semiAxes[3][3],
+                           SpiceDouble& minRadius,
+                           SpiceDouble& maxRadius ) {
+      maxRadius = 1.0 + 999.0 * next();
+      SpiceDouble radii[3] = {
+         maxRadius,
+         maxRadius * ( 0.5 + 0.5 * next() ),
+         maxRadius * ( 0.5 + 0.5 * next() ) };
+      minRadius = std::min( radii[1], radii[2] );
+
+      SpiceDouble quaternion[4];
+      do {
+         for ( SpiceInt k = 0; k < 4; k++ ) {
+            quaternion[k] = 2.0 * next() - 1.0;
+         }
+      } while ( vnormg_c( quaternion, 4 ) < 1.0e-3 );
+      vhatg_c( quaternion, 4, quaternion );
+      SpiceDouble rotation[3][3];
+      q2m_c( quaternion, rotation );
+      for ( SpiceInt i = 0; i < 3; i++ ) {
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            semiAxes[i][k] = radii[i] * rotation[k][i];
+         }
+      }
+   };
+
+   auto nextGeometry = [&]( SphereGeometry& geometry ) {
+      do {
+         nextEllipsoid(
+            geometry.BackSemiAxes, geometry.BackMin, geometry.BackMax );
+         nextEllipsoid(
+            geometry.FrontSemiAxes, geometry.FrontMin, geometry.FrontMax );
+         SpiceDouble backDistance =
+            geometry.BackMax * std::pow( 10.0, 0.01 + 3.0 * next() );
+         SpiceDouble frontDistance =
+            geometry.FrontMax * std::pow( 10.0, 0.01 + 3.0 * next() );
+
+         SpiceDouble backMinAngle =
+            std::asin( geometry.BackMin / backDistance );
+         SpiceDouble backMaxAngle =
+            std::asin( geometry.BackMax / backDistance );
+         SpiceDouble frontMinAngle =
+            std::asin( geometry.FrontMin / frontDistance );
+         SpiceDouble frontMaxAngle =
+            std::asin( geometry.FrontMax / frontDistance );
+         SpiceDouble separation{ 0.0 };
+         SpiceDouble choice = next();
+         if ( choice < 0.25 ) {
+            separation = backMaxAngle + frontMaxAngle;
+         }
+         else if ( choice < 0.5 ) {
+            separation = std::abs( frontMinAngle - backMaxAngle );
+         }
+         else if ( choice < 0.75 ) {
+            separation = std::abs( backMinAngle - frontMaxAngle );
+         }
+         else {
+            separation = 2.0 * ( backMaxAngle + frontMaxAngle ) * next();
+         }
+         separation *= 1.0 + ( next() < 0.5 ? -1.0 : 1.0 ) *
+                                std::pow( 10.0, -1.0 - 9.0 * next() );
+         separation = std::min( std::max( separation, 0.0 ), pi_c() );
+
+         SpiceDouble backDirection[3];
+         SpiceDouble axis[3];
+         SpiceDouble frontDirection[3];
+         nextDirection( backDirection );
+         do {
+            nextDirection( axis );
+            ucrss_c( backDirection, axis, axis );
+         } while ( vzero_c( axis ) );
+         vrotv_c( backDirection, axis, separation, frontDirection );
+         vscl_c( backDistance, backDirection, geometry.BackPosition );
+         vscl_c( frontDistance, frontDirection, geometry.FrontPosition );
+      } while ( vdist_c( geometry.BackPosition, geometry.FrontPosition ) <=
+                geometry.BackMax + geometry.FrontMax );
+   };
+
+   /*
+   The geometries are generated and timed in blocks, which keeps the memory
+   bounded without timing each call on its own.
+   */
+   const SpiceInt              blockSize{ 4096 };
+   std::vector<SphereGeometry> block( blockSize );
+   std::vector<SpiceInt>       sphereCodes( blockSize );
+   std::vector<SpiceInt>       sphereDecided( blockSize );
+   std::vector<SpiceInt>       ellipsoidCodes( blockSize );
+   const std::vector<SpiceInt> codes = { 0, -3, 2, -2, 3 };
+   std::vector<SpiceInt>       codeCounts( codes.size(), 0 );
+   SpiceDouble                 origin[3] = { 0.0, 0.0, 0.0 };
+   SpiceInt                    decided{ 0 };
+   SpiceInt                    differences{ 0 };
+
+   std::chrono::duration<double, std::nano> sphereTime{ 0.0 };
+   std::chrono::duration<double, std::nano> ellipsoidTime{ 0.0 };
+   for ( SpiceInt done = 0; done < count; done += blockSize ) {
+      SpiceInt size = std::min( blockSize, count - done );
+      for ( SpiceInt i = 0; i < size; i++ ) {
+         nextGeometry( block[i] );
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      for ( SpiceInt i = 0; i < size; i++ ) {
+         SphereGeometry& geometry = block[i];
+         sphereDecided[i]         = zzocsph_(
+            geometry.BackPosition,
+            &geometry.BackMin,
+            &geometry.BackMax,
+            geometry.FrontPosition,
+            &geometry.FrontMin,
+            &geometry.FrontMax,
+            &sphereCodes[i] );
+      }
+      sphereTime += std::chrono::steady_clock::now() - start;
+
+      start = std::chrono::steady_clock::now();
+      for ( SpiceInt i = 0; i < size; i++ ) {
+         SphereGeometry& geometry = block[i];
+         ellipsoidCodes[i]        = zzocced_(
+            origin,
+            geometry.BackPosition,
+            &geometry.BackSemiAxes[0][0],
+            geometry.FrontPosition,
+            &geometry.FrontSemiAxes[0][0] );
+      }
+      ellipsoidTime += std::chrono::steady_clock::now() - start;
+
+      for ( SpiceInt i = 0; i < size; i++ ) {
+         if ( !sphereDecided[i] ) {
+            continue;
+         }
+         decided++;
+         for ( size_t c = 0; c < codes.size(); c++ ) {
+            codeCounts[c] += sphereCodes[i] == codes[c];
+         }
+         if ( sphereCodes[i] != ellipsoidCodes[i] ) {
+            if ( differences == 0 ) {
+               std::cout << "Error: geometry " << done + i
+                         << " is classified as " << sphereCodes[i]
+                         << " rather than " << ellipsoidCodes[i] << "."
+                         << std::endl;
+            }
+            differences++;
+         }
+      }
+   }
+
+   std::cout << "Occultation sphere benchmark over " << count
+             << " geometries (nanoseconds per geometry):" << std::endl
+             << "   zzocsph_: " << sphereTime.count() / count << " ("
+             << 100.0 * decided / count << "% decided), zzocced_: "
+             << ellipsoidTime.count() / count << ", " << differences
+             << " differ" << std::endl
+             << "   decided codes:";
+   for ( size_t c = 0; c < codes.size(); c++ ) {
+      std::cout << " " << codes[c] << ": " << codeCounts[c]
+                << ( c + 1 < codes.size() ? "," : "" );
+   }
+   std::cout << std::endl;
+}
 /* End OccultationUtils.cpp */
\ No newline at end of file
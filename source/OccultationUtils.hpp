@@ -54,9 +54,14 @@
 #pragma once
 
 /*
-Fortunately we only need to use the common includes for this file.
+We need the common includes, and the ephemeris, frame, and kernel utilities
+for this file.
 */
+#include "EphemerisUtils.hpp"
+#include "FrameUtils.hpp"
 #include "IncludesCommon.hpp"
+#include "KernelUtils.hpp"
+#include "ShapeUtils.hpp"
 
 /*
 All of our non-program functionality lives within the cppspice namespace. This
@@ -65,41 +70,143 @@ will ensure that everything is made available appropriately.
 namespace cppspice {
    /*
    A function which determines whether the target is occulted at a specified
-   epoch.
+   epoch. If a light time cache is provided, the light time solutions from
+   previous calls are used to warm-start the light time iteration.
     */
    bool isOccultedAtEpoch(
-      const SpiceInt    targetID,
-      const SpiceInt    occulterID,
-      const SpiceInt    observerID,
-      const SpiceDouble epoch,
-      const SpiceChar*  occulterFrame,
-      const SpiceChar*  occulterName,
-      const SpiceChar*  targetFrame,
-      const SpiceChar*  targetName,
-      SpiceBoolean&     isOcculted );
+      const SpiceInt         targetID,
+      const SpiceInt         occulterID,
+      const SpiceInt         observerID,
+      const SpiceDouble      epoch,
+      const FramePlanHandle  occulterRotationPlan,
+      const PoolHandle       occulterRadiiHandle,
+      const ShapeModelHandle occulterShape,
+      const SpiceChar*       targetFrame,
+      const PoolHandle       targetRadiiHandle,
+      SpiceBoolean&          isOcculted,
+      LightTimeCache*        lightTimes = nullptr );
 
    /*
    A bisection algorithm to find the transition.
    */
    bool bisectEpochs(
-      const SpiceInt     targetID,
-      const SpiceInt     occulterID,
-      const SpiceInt     observerID,
-      const SpiceDouble  lowerEpoch,
-      const SpiceBoolean lowerOcculted,
-      const SpiceDouble  upperEpoch,
-      const SpiceBoolean upperOcculted,
-      const SpiceChar*   occulterFrame,
-      const SpiceChar*   occulterName,
-      const SpiceChar*   targetFrame,
-      const SpiceChar*   targetName,
-      const SpiceDouble  tolerance );
+      const SpiceInt         targetID,
+      const SpiceInt         occulterID,
+      const SpiceInt         observerID,
+      const SpiceDouble      lowerEpoch,
+      const SpiceBoolean     lowerOcculted,
+      const SpiceDouble      upperEpoch,
+      const SpiceBoolean     upperOcculted,
+      const FramePlanHandle  occulterRotationPlan,
+      const PoolHandle       occulterRadiiHandle,
+      const ShapeModelHandle occulterShape,
+      const SpiceChar*       targetFrame,
+      const PoolHandle       targetRadiiHandle,
+      const SpiceDouble      tolerance );
 
    /*
    This is a function which is used to perform the occultation search using
-   a custom written algorithm.
+   a custom written algorithm. If a window is provided, the span of each
+   event which was found is inserted into it.
     */
-   bool performCustOccSrch( const SimulationData& data );
+   bool performCustOccSrch(
+      const SimulationData& data,
+      SpiceCell*            events = nullptr );
+
+   /*
+   The counters, timers, and progress of a CSPICE occultation search. The
+   times are wall clock seconds. The condition time is whatever the search
+   spent outside of our step, refinement, and reporting functions. The
+   condition is evaluated within CSPICE, so the members ending in Estimate
+   aren't measured: the number of evaluations is inferred from the steps
+   and refinements, the SPK and frame times are scaled up from a sample of
+   replayed lookups, and the occultation time is what the condition time
+   leaves of them, which is negative when they overshoot.
+   */
+   struct SearchStatistics {
+      SpiceInt    ConditionEvaluationsEstimate{ 0 };
+      SpiceInt    StepEvaluations{ 0 };
+      SpiceInt    RefineEvaluations{ 0 };
+      SpiceInt    Transitions{ 0 };
+      SpiceDouble CurrentEpoch{ 0.0 };
+      SpiceDouble Fraction{ 0.0 };
+      SpiceDouble ElapsedTime{ 0.0 };
+      SpiceDouble StepTime{ 0.0 };
+      SpiceDouble RefineTime{ 0.0 };
+      SpiceDouble ReportTime{ 0.0 };
+      SpiceDouble SampleTime{ 0.0 };
+      SpiceDouble ConditionTime{ 0.0 };
+      SpiceInt    StageSamples{ 0 };
+      SpiceDouble SPKTimeEstimate{ 0.0 };
+      SpiceDouble FrameTimeEstimate{ 0.0 };
+      SpiceDouble OccultationTimeEstimate{ 0.0 };
+      bool        Cancelled{ false };
+   };
+
+   /*
+   A function which is called with the statistics of a running search each
+   time the search checks for an interrupt, and which returns true to cancel
+   the search.
+   */
+   using SearchCallback = bool ( * )( const SearchStatistics& statistics );
+
+   /*
+   This function sets the callback which can cancel a CSPICE occultation
+   search. A null callback leaves only the interrupt signal.
+   */
+   void setSearchCallback( SearchCallback callback );
+
+   /*
+   This function returns the statistics of the current, or most recent,
+   CSPICE occultation search.
+   */
+   const SearchStatistics& getSearchStatistics();
+
+   /*
+   This function writes search statistics as a JSON object.
+   */
+   void reportSearchStatistics( const SearchStatistics& statistics );
+
+   /*
+   The contacts of an occultation event: C1 and C4, where the occulter
+   first and last touches the target, C2 and C3, where the full or annular
+   phase begins and ends, and the epoch of greatest occultation, where the
+   centers are closest. Contacts the event doesn't have are NaN.
+   */
+   struct EventContacts {
+      std::string Type;
+      SpiceDouble Contacts[4];
+      SpiceDouble Greatest;
+      SpiceDouble Separation;
+      SpiceInt    Evaluations{ 0 };
+   };
+
+   /*
+   This function finds the contacts of the occultation event around an
+   interval found by either search, from one set of shared evaluations.
+   */
+   bool getEventContacts(
+      const SimulationData& data,
+      const SpiceDouble     lowerEpoch,
+      const SpiceDouble     upperEpoch,
+      EventContacts&        contacts );
+
+   /*
+   This function finds the contacts of every event in a search's results,
+   counting the intervals which belong to the same event once.
+   */
+   bool getSearchEvents(
+      const SimulationData&       data,
+      SpiceCell*                  result,
+      std::vector<EventContacts>& events );
+
+   /*
+   This function writes the contacts of every event in a search's results
+   as a JSON object.
+   */
+   bool reportEventContacts(
+      const SimulationData& data,
+      SpiceCell*            result );
 
    /*
    This is the function which is used to perform the occultation search using
@@ -113,5 +220,11 @@ namespace cppspice {
    the occultation search and report the relevant statistics.
    */
    void reportSearchSummary( SpiceCell* result );
+
+   /*
+   This function times the GF sphere pre-classifier against zzocced_ on
+   random geometry, and reports any differences.
+   */
+   void benchmarkOccultationSpheres( const SpiceInt count );
 }   // namespace cppspice
     /* End OccultationUtils.hpp */
\ No newline at end of file
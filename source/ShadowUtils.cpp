@@ -0,0 +1,1279 @@
+// clang-format off
+/*
+
+- Source_File ShadowUtils.cpp (Shadow utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (ShadowUtils.hpp).
+
+   With t and o the vectors from a cell's surface point to the centers of
+   the target and the occulter, and R and r their radii, the target is at
+   least partly covered when the angle between them is less than the sum
+   of their angular radii, and centrally covered when it is less than the
+   difference. Taking the cosines of both sides and clearing the
+   denominators, these become
+
+      partial:  ( t.o + R r )^2 > ( |t|^2 - R^2 ) ( |o|^2 - r^2 )
+      central:  ( t.o - R r )^2 > ( |t|^2 - R^2 ) ( |o|^2 - r^2 )
+
+   with the left hand side taken with the sign of t.o +/- R r. The right
+   side minus the signed left side is a measure which is negative exactly
+   when the condition holds, and which varies smoothly, so contacts are
+   found by interpolating it through the steps on either side of a change
+   of sign and the step before. Greatest eclipse is where
+   the squared sine of the angle, |t x o|^2 / ( |t|^2 |o|^2 ), is least,
+   which is found by fitting a parabola through the three steps around the
+   least sample. None of this needs a square root or a branch.
+
+   A cell only counts as eclipsed if the center of the target is above its
+   horizon at some step of the partial phase.
+
+   The outline of each shadow is traced by its generators: for each
+   position angle about the axis, the line tangent to both spheres on that
+   side. It is intersected with the ellipsoid, and the intersection nearest
+   the target is kept if the target is above the horizon there. The umbral
+   generator runs on through the umbra's vertex into the antumbra, so the
+   same line traces whichever of the two reaches the body.
+
+   An event is found by the angle between the target and the occulter as
+   seen from the body's center, which can only fall below the sum of their
+   angular radii, as seen from somewhere on the body, and the parallax of
+   each over the body, while the penumbra might touch it. Away from events
+   the scan skips ahead as far as the angle's rate allows, as the adaptive
+   step of the searches does.
+
+- Literature_References
+
+   Meeus, J., "Elements of Solar Eclipses 1951-2200", Willmann-Bell, 1989.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, algorithm and cmath for the arithmetic,
+chrono for timing, the stream headers for the output file, limits for the
+missing contacts, thread for splitting the rows, and the ephemeris and frame
+utilities to place the bodies.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "EphemerisUtils.hpp"
+#include "FrameUtils.hpp"
+#include "KernelUtils.hpp"
+#include "ShadowUtils.hpp"
+
+/*
+The positions of the target and the occulter relative to the center of the
+observer's body, in its body-fixed frame, at one step.
+*/
+struct ShadowSample {
+   SpiceDouble Epoch;
+   SpiceDouble Target[3];
+   SpiceDouble Occulter[3];
+};
+
+/*
+The radii of the target and occulter spheres, and of the body's ellipsoid.
+*/
+struct ShadowBodies {
+   SpiceDouble TargetRadius;
+   SpiceDouble OcculterRadius;
+   SpiceDouble Radii[3];
+};
+
+/*
+The cells of the grid, by row, with each row padded to a whole number of
+blocks of FOOTPRINTLANES. Each cell holds its surface point, its local
+vertical, and the contact times C1 to C4 and of greatest eclipse found for
+it in the current event, which are NaN when they didn't happen. The state of
+the trace is kept alongside: the partial and central measures and the
+squared sine of the separation at the previous two steps.
+*/
+struct FootprintGrid {
+   SpiceInt                   Rows;
+   SpiceInt                   Columns;
+   SpiceInt                   Stride;
+   std::vector<SpiceDouble>   Latitudes;
+   std::vector<SpiceDouble>   Longitudes;
+   std::vector<SpiceDouble>   Point[3];
+   std::vector<SpiceDouble>   Up[3];
+   std::vector<SpiceDouble>   Contacts[5];
+   std::vector<SpiceDouble>   Partial;
+   std::vector<SpiceDouble>   Central;
+   std::vector<SpiceDouble>   Sine;
+   std::vector<SpiceDouble>   EarlierPartial;
+   std::vector<SpiceDouble>   EarlierCentral;
+   std::vector<SpiceDouble>   EarlierSine;
+   std::vector<unsigned char> Visible;
+};
+
+/*
+The number of threads which the rows may be split between, where zero means
+one per hardware thread.
+*/
+static SpiceInt footprintThreads = 0;
+
+/*
+This is a helper which lays out the grid's cells on the body's ellipsoid.
+*/
+static void buildFootprintGrid(
+   const SpiceDouble   resolution,
+   const ShadowBodies& bodies,
+   FootprintGrid&      grid ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble   I   The spacing of the cells, in degrees.
+      struct        I   The radii of the bodies.
+      struct        O   The grid.
+
+   - Detailed_Input
+
+      resolution  the requested spacing of the cells. The spacing used is
+                  the nearest which divides 180 degrees of latitude and
+                  360 degrees of longitude evenly.
+      bodies      the radii, of which those of the body's ellipsoid are
+                  used.
+
+   - Detailed_Output
+
+      grid        the cells, each at the center of its latitude and
+   longitude span on the ellipsoid, with the padding cells of each row
+   repeating its last cell.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::FOOTPRINTLANES;
+   grid.Rows = std::max(
+      static_cast<SpiceInt>( 1 ),
+      static_cast<SpiceInt>( std::lround( 180.0 / resolution ) ) );
+   grid.Columns = std::max(
+      static_cast<SpiceInt>( 1 ),
+      static_cast<SpiceInt>( std::lround( 360.0 / resolution ) ) );
+   grid.Stride = ( grid.Columns + FOOTPRINTLANES - 1 ) / FOOTPRINTLANES *
+                 FOOTPRINTLANES;
+
+   grid.Latitudes.resize( grid.Rows );
+   grid.Longitudes.resize( grid.Columns );
+   for ( SpiceInt row = 0; row < grid.Rows; row++ ) {
+      grid.Latitudes[row] = -90.0 + ( row + 0.5 ) * 180.0 / grid.Rows;
+   }
+   for ( SpiceInt column = 0; column < grid.Columns; column++ ) {
+      grid.Longitudes[column] =
+         -180.0 + ( column + 0.5 ) * 360.0 / grid.Columns;
+   }
+
+   size_t cells = static_cast<size_t>( grid.Rows ) * grid.Stride;
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      grid.Point[k].resize( cells );
+      grid.Up[k].resize( cells );
+   }
+   for ( auto& contact : grid.Contacts ) {
+      contact.resize( cells );
+   }
+   grid.Partial.resize( cells );
+   grid.Central.resize( cells );
+   grid.Sine.resize( cells );
+   grid.EarlierPartial.resize( cells );
+   grid.EarlierCentral.resize( cells );
+   grid.EarlierSine.resize( cells );
+   grid.Visible.resize( cells );
+
+   SpiceDouble flattening =
+      ( bodies.Radii[0] - bodies.Radii[2] ) / bodies.Radii[0];
+   for ( SpiceInt row = 0; row < grid.Rows; row++ ) {
+      SpiceDouble latitude = grid.Latitudes[row] * rpd_c();
+      for ( SpiceInt column = 0; column < grid.Stride; column++ ) {
+         SpiceDouble longitude =
+            grid.Longitudes[std::min( column, grid.Columns - 1 )] * rpd_c();
+         SpiceDouble point[3];
+         georec_c(
+            longitude,
+            latitude,
+            0.0,
+            bodies.Radii[0],
+            flattening,
+            point );
+         size_t cell = static_cast<size_t>( row ) * grid.Stride + column;
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            grid.Point[k][cell] = point[k];
+         }
+         grid.Up[0][cell] = cos( latitude ) * cos( longitude );
+         grid.Up[1][cell] = cos( latitude ) * sin( longitude );
+         grid.Up[2][cell] = sin( latitude );
+      }
+   }
+}
+
+/*
+This is a helper which measures the shadow at every cell of a row at one
+step. The loop over the lanes of a block has no branches, so that it is
+compiled to vector instructions.
+*/
+static void measureShadowRow(
+   const FootprintGrid& grid,
+   const SpiceInt       row,
+   const ShadowSample&  sample,
+   const ShadowBodies&  bodies,
+   SpiceDouble*         partial,
+   SpiceDouble*         central,
+   SpiceDouble*         sine,
+   SpiceDouble*         daylight ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        I   The grid.
+      SpiceInt      I   The row.
+      struct        I   The positions of the bodies at the step.
+      struct        I   The radii of the bodies.
+      SpiceDouble   O   The partial measure of each cell.
+      SpiceDouble   O   The central measure of each cell.
+      SpiceDouble   O   The squared sine of the separation at each cell.
+      SpiceDouble   O   The height of the target above each cell's horizon.
+
+   - Detailed_Input
+
+      grid     the grid, whose row is measured.
+      row      the index of the row.
+      sample   the body-fixed positions of the target and occulter.
+      bodies   the radii of the target and occulter.
+
+   - Detailed_Output
+
+      partial  the partial measure for each cell of the row, including its
+               padding, which is negative when the target is at least
+               partly covered.
+      central  the central measure, which is negative when the target is
+               entirely covered or surrounds the occulter.
+      sine     the squared sine of the angle between the two centers.
+      daylight the component of the direction to the target along the
+               cell's vertical, which is positive when the target's center
+               is above the horizon.
+
+   - Error Handling
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::FOOTPRINTLANES;
+   const size_t       base  = static_cast<size_t>( row ) * grid.Stride;
+   const SpiceDouble* x     = &grid.Point[0][base];
+   const SpiceDouble* y     = &grid.Point[1][base];
+   const SpiceDouble* z     = &grid.Point[2][base];
+   const SpiceDouble* upX   = &grid.Up[0][base];
+   const SpiceDouble* upY   = &grid.Up[1][base];
+   const SpiceDouble* upZ   = &grid.Up[2][base];
+   const SpiceDouble  both  = bodies.TargetRadius * bodies.OcculterRadius;
+   const SpiceDouble  big   = bodies.TargetRadius * bodies.TargetRadius;
+   const SpiceDouble  small = bodies.OcculterRadius * bodies.OcculterRadius;
+
+   for ( SpiceInt block = 0; block < grid.Stride; block += FOOTPRINTLANES ) {
+      SpiceDouble blockPartial[FOOTPRINTLANES];
+      SpiceDouble blockCentral[FOOTPRINTLANES];
+      SpiceDouble blockSine[FOOTPRINTLANES];
+      SpiceDouble blockDaylight[FOOTPRINTLANES];
+      for ( SpiceInt lane = 0; lane < FOOTPRINTLANES; lane++ ) {
+         SpiceInt    i        = block + lane;
+         SpiceDouble tx       = sample.Target[0] - x[i];
+         SpiceDouble ty       = sample.Target[1] - y[i];
+         SpiceDouble tz       = sample.Target[2] - z[i];
+         SpiceDouble ox       = sample.Occulter[0] - x[i];
+         SpiceDouble oy       = sample.Occulter[1] - y[i];
+         SpiceDouble oz       = sample.Occulter[2] - z[i];
+         SpiceDouble tt       = tx * tx + ty * ty + tz * tz;
+         SpiceDouble oo       = ox * ox + oy * oy + oz * oz;
+         SpiceDouble to       = tx * ox + ty * oy + tz * oz;
+         SpiceDouble cx       = ty * oz - tz * oy;
+         SpiceDouble cy       = tz * ox - tx * oz;
+         SpiceDouble cz       = tx * oy - ty * ox;
+         SpiceDouble tangents = ( tt - big ) * ( oo - small );
+         SpiceDouble outer    = to + both;
+         SpiceDouble inner    = to - both;
+
+         blockPartial[lane]  = tangents - outer * std::abs( outer );
+         blockCentral[lane]  = tangents - inner * std::abs( inner );
+         blockSine[lane]     = ( cx * cx + cy * cy + cz * cz ) / ( tt * oo );
+         blockDaylight[lane] = upX[i] * tx + upY[i] * ty + upZ[i] * tz;
+      }
+      std::copy(
+         blockPartial,
+         blockPartial + FOOTPRINTLANES,
+         partial + block );
+      std::copy(
+         blockCentral,
+         blockCentral + FOOTPRINTLANES,
+         central + block );
+      std::copy( blockSine, blockSine + FOOTPRINTLANES, sine + block );
+      std::copy(
+         blockDaylight,
+         blockDaylight + FOOTPRINTLANES,
+         daylight + block );
+   }
+}
+
+/*
+This is a helper which finds where a measure changes sign between two steps,
+as a fraction of the step.
+*/
+static SpiceDouble interpolateCrossing(
+   const SpiceDouble earlier,
+   const SpiceDouble last,
+   const SpiceDouble current ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble   I   The measure at the step before the last.
+      SpiceDouble   I   The measure at the last step.
+      SpiceDouble   I   The measure at the current step.
+
+   - Detailed_Input
+
+      earlier  the measure one step before last, or last itself if there
+               was no such step.
+      last     the measure at the last step.
+      current  the measure at the current step, which has the opposite sign
+               to last.
+
+   - Detailed_Output
+
+      The function returns the fraction of the step from the last step at
+   which the parabola through the three measures crosses zero, or at which
+   the line through the last two does if the parabola doesn't cross zero
+   within the step.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The measures are quadratic in the separation of the bodies, so near
+   the axis of the shadow, where the central phase of a cell may last only
+   a step or two, a line through two steps can place its contacts well off.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble linear = last / ( last - current );
+
+   /*
+   With the steps at -1, 0 and 1, the parabola is a x^2 + b x + last.
+   */
+   SpiceDouble a            = 0.5 * ( current + earlier ) - last;
+   SpiceDouble b            = 0.5 * ( current - earlier );
+   SpiceDouble discriminant = b * b - 4.0 * a * last;
+   if ( std::abs( a ) <= 1.0e-12 * std::abs( b ) || discriminant < 0.0 ) {
+      return linear;
+   }
+
+   /*
+   Take the root within the step, in the stable form, or the one nearer the
+   linear estimate if both are.
+   */
+   SpiceDouble spread = std::copysign( sqrt( discriminant ), b );
+   SpiceDouble q      = -0.5 * ( b + spread );
+   SpiceDouble root   = linear;
+   SpiceDouble error  = std::numeric_limits<SpiceDouble>::infinity();
+   for ( SpiceDouble candidate : { q / a, q != 0.0 ? last / q : linear } ) {
+      if ( candidate >= 0.0 && candidate <= 1.0 &&
+           std::abs( candidate - linear ) < error )
+      {
+         root  = candidate;
+         error = std::abs( candidate - linear );
+      }
+   }
+   return root;
+}
+
+/*
+This is a helper which traces a range of rows through the steps of an event,
+recording the contact times of their cells.
+*/
+static void traceFootprintRows(
+   FootprintGrid&                   grid,
+   const std::vector<ShadowSample>& samples,
+   const ShadowBodies&              bodies,
+   const SpiceInt                   firstRow,
+   const SpiceInt                   lastRow ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct    I/O  The grid.
+      vector     I   The steps of the event.
+      struct     I   The radii of the bodies.
+      SpiceInt   I   The first row to trace.
+      SpiceInt   I   The row after the last row to trace.
+
+   - Detailed_Input
+
+      grid     the grid, whose contact times have been reset.
+      samples  the positions of the bodies at evenly spaced steps, the
+               first and last of which are outside of the event.
+      bodies   the radii of the bodies.
+      firstRow the first row to trace.
+      lastRow  one past the last row to trace.
+
+   - Detailed_Output
+
+      grid     the contact times and visibility of the rows' cells.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      Only the rows in the range are written to, so that ranges can be
+   traced on separate threads.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<SpiceDouble> partial( grid.Stride );
+   std::vector<SpiceDouble> central( grid.Stride );
+   std::vector<SpiceDouble> sine( grid.Stride );
+   std::vector<SpiceDouble> daylight( grid.Stride );
+   for ( SpiceInt row = firstRow; row < lastRow; row++ ) {
+      const size_t base = static_cast<size_t>( row ) * grid.Stride;
+      for ( size_t k = 0; k < samples.size(); k++ ) {
+         measureShadowRow(
+            grid,
+            row,
+            samples[k],
+            bodies,
+            partial.data(),
+            central.data(),
+            sine.data(),
+            daylight.data() );
+         SpiceDouble before = k > 0 ? samples[k - 1].Epoch : 0.0;
+         SpiceDouble step   = samples[k].Epoch - before;
+         for ( SpiceInt column = 0; column < grid.Columns; column++ ) {
+            size_t cell = base + column;
+            if ( k > 0 ) {
+               SpiceDouble lastPartial = grid.Partial[cell];
+               SpiceDouble lastCentral = grid.Central[cell];
+               SpiceDouble earlierPartial =
+                  k > 1 ? grid.EarlierPartial[cell] : lastPartial;
+               SpiceDouble earlierCentral =
+                  k > 1 ? grid.EarlierCentral[cell] : lastCentral;
+               if ( lastPartial >= 0.0 && partial[column] < 0.0 &&
+                    std::isnan( grid.Contacts[0][cell] ) )
+               {
+                  grid.Contacts[0][cell] =
+                     before + step * interpolateCrossing(
+                                        earlierPartial,
+                                        lastPartial,
+                                        partial[column] );
+               }
+               if ( lastCentral >= 0.0 && central[column] < 0.0 &&
+                    std::isnan( grid.Contacts[1][cell] ) )
+               {
+                  grid.Contacts[1][cell] =
+                     before + step * interpolateCrossing(
+                                        earlierCentral,
+                                        lastCentral,
+                                        central[column] );
+               }
+               if ( lastCentral < 0.0 && central[column] >= 0.0 ) {
+                  grid.Contacts[2][cell] =
+                     before + step * interpolateCrossing(
+                                        earlierCentral,
+                                        lastCentral,
+                                        central[column] );
+               }
+               if ( lastPartial < 0.0 && partial[column] >= 0.0 ) {
+                  grid.Contacts[3][cell] =
+                     before + step * interpolateCrossing(
+                                        earlierPartial,
+                                        lastPartial,
+                                        partial[column] );
+               }
+
+               /*
+               If the previous step was the least separation, fit a
+               parabola through it and its neighbors.
+               */
+               SpiceDouble earlier = grid.EarlierSine[cell];
+               SpiceDouble last    = grid.Sine[cell];
+               if ( k > 1 && lastPartial < 0.0 && last <= earlier &&
+                    last < sine[column] )
+               {
+                  SpiceDouble curvature = earlier - 2.0 * last + sine[column];
+                  grid.Contacts[4][cell] =
+                     before +
+                     step * ( earlier - sine[column] ) / ( 2.0 * curvature );
+               }
+            }
+            if ( partial[column] < 0.0 && daylight[column] > 0.0 ) {
+               grid.Visible[cell] = 1;
+            }
+            grid.EarlierPartial[cell] = grid.Partial[cell];
+            grid.EarlierCentral[cell] = grid.Central[cell];
+            grid.EarlierSine[cell]    = grid.Sine[cell];
+            grid.Partial[cell]        = partial[column];
+            grid.Central[cell]        = central[column];
+            grid.Sine[cell]           = sine[column];
+         }
+      }
+   }
+}
+
+/*
+This is a helper which finds the nearer intersection of a ray with an
+ellipsoid, if the ray hits it.
+*/
+static bool intersectEllipsoid(
+   const SpiceDouble radii[3],
+   const SpiceDouble vertex[3],
+   const SpiceDouble direction[3],
+   SpiceDouble       point[3] ) {
+   SpiceDouble a{ 0.0 };
+   SpiceDouble b{ 0.0 };
+   SpiceDouble c{ -1.0 };
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      SpiceDouble v = vertex[k] / radii[k];
+      SpiceDouble d = direction[k] / radii[k];
+      a += d * d;
+      b += v * d;
+      c += v * v;
+   }
+   SpiceDouble discriminant = b * b - a * c;
+   if ( discriminant < 0.0 ) {
+      return false;
+   }
+   SpiceDouble distance = ( -b - sqrt( discriminant ) ) / a;
+   if ( distance < 0.0 ) {
+      return false;
+   }
+   vlcom_c( 1.0, vertex, distance, direction, point );
+   return true;
+}
+
+/*
+This is a helper which traces the outline of the penumbra, or of the umbra
+or antumbra, on the body's ellipsoid at one step.
+*/
+static void getShadowOutline(
+   const ShadowSample&                            sample,
+   const ShadowBodies&                            bodies,
+   const bool                                     central,
+   std::vector<std::pair<SpiceDouble, SpiceDouble>>& outline ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        I   The positions of the bodies at the step.
+      struct        I   The radii of the bodies.
+      bool          I   Whether to trace the umbra or antumbra.
+      vector        O   The latitudes and longitudes of the outline.
+
+   - Detailed_Input
+
+      sample   the body-fixed positions of the target and occulter.
+      bodies   the radii of the bodies.
+      central  true to trace the umbra or antumbra, and false to trace the
+               penumbra.
+
+   - Detailed_Output
+
+      outline  the planetodetic latitude and longitude, in degrees, of the
+   outline at each of FOOTPRINTOUTLINE position angles about the shadow's
+   axis, in order. Angles at which the shadow's edge misses the body, or
+   falls where the target is below the horizon, are left out, so the
+   outline is open where it runs off the body's limb.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Particulars
+
+      With u the direction from the target to the occulter, D the distance
+   between them, and e a direction perpendicular to u, the outward normal
+   shared by the two tangent points of the umbral generator on the side e
+   is
+
+      n = ( R - r ) / D u + sqrt( 1 - ( ( R - r ) / D )^2 ) e
+
+   and the generator runs from the occulter's tangent point, c + r n, away
+   from the target's, C + R n. The penumbral generator is the same with
+   R + r in place of R - r, and with the occulter's tangent point on the
+   far side, c - r n.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   outline.clear();
+   SpiceDouble axis[3];
+   vsub_c( sample.Occulter, sample.Target, axis );
+   SpiceDouble distance = vnorm_c( axis );
+   vhat_c( axis, axis );
+
+   SpiceDouble along =
+      ( bodies.TargetRadius +
+        ( central ? -bodies.OcculterRadius : bodies.OcculterRadius ) ) /
+      distance;
+   SpiceDouble across = sqrt( std::max( 0.0, 1.0 - along * along ) );
+   SpiceDouble side   = central ? 1.0 : -1.0;
+
+   SpiceDouble first[3];
+   SpiceDouble second[3];
+   SpiceDouble flattening =
+      ( bodies.Radii[0] - bodies.Radii[2] ) / bodies.Radii[0];
+   frame_c( axis, first, second );
+   for ( SpiceInt i = 0; i < cppspice::FOOTPRINTOUTLINE; i++ ) {
+      SpiceDouble angle = twopi_c() * i / cppspice::FOOTPRINTOUTLINE;
+      SpiceDouble toward[3];
+      SpiceDouble normal[3];
+      vlcom_c( cos( angle ), first, sin( angle ), second, toward );
+      vlcom_c( along, axis, across, toward, normal );
+
+      SpiceDouble targetPoint[3];
+      SpiceDouble occulterPoint[3];
+      SpiceDouble direction[3];
+      vlcom_c( 1.0, sample.Target, bodies.TargetRadius, normal, targetPoint );
+      vlcom_c(
+         1.0,
+         sample.Occulter,
+         side * bodies.OcculterRadius,
+         normal,
+         occulterPoint );
+      vsub_c( occulterPoint, targetPoint, direction );
+      vhat_c( direction, direction );
+
+      SpiceDouble point[3];
+      if ( !intersectEllipsoid(
+              bodies.Radii,
+              occulterPoint,
+              direction,
+              point ) )
+      {
+         continue;
+      }
+      SpiceDouble vertical[3];
+      SpiceDouble sunward[3];
+      surfnm_c(
+         bodies.Radii[0],
+         bodies.Radii[1],
+         bodies.Radii[2],
+         point,
+         vertical );
+      vsub_c( sample.Target, point, sunward );
+      if ( vdot_c( vertical, sunward ) <= 0.0 ) {
+         continue;
+      }
+
+      SpiceDouble longitude{ 0.0 };
+      SpiceDouble latitude{ 0.0 };
+      SpiceDouble altitude{ 0.0 };
+      recgeo_c(
+         point,
+         bodies.Radii[0],
+         flattening,
+         &longitude,
+         &latitude,
+         &altitude );
+      outline.emplace_back( latitude * dpr_c(), longitude * dpr_c() );
+   }
+}
+
+/*
+This is a helper which decides whether the central shadow reaching the body
+at one step is the umbra or the antumbra.
+*/
+static bool isUmbral(
+   const ShadowSample& sample,
+   const ShadowBodies& bodies ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        I   The positions of the bodies at the step.
+      struct        I   The radii of the bodies.
+
+   - Detailed_Input
+
+      sample   the body-fixed positions of the target and occulter.
+      bodies   the radii of the bodies.
+
+   - Detailed_Output
+
+      The function returns true if the umbra's vertex lies beyond where the
+   shadow's axis meets the body, or beyond its closest approach to the
+   body's center if the axis misses, and always if the occulter is at least
+   as large as the target, so that the umbra never ends.
+
+   - Error Handling
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( bodies.TargetRadius <= bodies.OcculterRadius ) {
+      return true;
+   }
+   SpiceDouble axis[3];
+   vsub_c( sample.Occulter, sample.Target, axis );
+   SpiceDouble vertex = vnorm_c( axis ) * bodies.OcculterRadius /
+                        ( bodies.TargetRadius - bodies.OcculterRadius );
+   vhat_c( axis, axis );
+
+   SpiceDouble point[3];
+   SpiceDouble reach = -vdot_c( sample.Occulter, axis );
+   if ( intersectEllipsoid( bodies.Radii, sample.Occulter, axis, point ) ) {
+      reach = vdist_c( point, sample.Occulter );
+   }
+   return vertex > reach;
+}
+
+/*
+This is a helper which places the target and occulter at an epoch, and
+decides whether the penumbra might touch the body.
+*/
+static bool sampleShadow(
+   const SpiceInt            targetID,
+   const SpiceInt            occulterID,
+   const SpiceInt            observerID,
+   const std::string&        observerFrame,
+   const ShadowBodies&       bodies,
+   const SpiceDouble         epoch,
+   cppspice::LightTimeCache& lightTimes,
+   ShadowSample&             sample,
+   SpiceDouble&              clearance ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceInt      I   The NAIF ID of the target.
+      SpiceInt      I   The NAIF ID of the occulter.
+      SpiceInt      I   The NAIF ID of the observer's body.
+      string        I   The body-fixed frame of the observer's body.
+      struct        I   The radii of the bodies.
+      SpiceDouble   I   The epoch.
+      struct       I/O  The light time solutions of the previous epochs.
+      struct        O   The positions of the bodies.
+      SpiceDouble   O   How long the penumbra can't touch the body for.
+
+   - Detailed_Input
+
+      targetID      the NAIF ID of the body which casts the light.
+      occulterID    the NAIF ID of the body which casts the shadow.
+      observerID    the NAIF ID of the body the shadow falls on.
+      observerFrame the body-fixed frame of the observer's body.
+      bodies        the radii of the bodies.
+      epoch         the epoch, in seconds past J2000 TDB.
+      lightTimes    the light time cache shared by the calls of a scan.
+
+   - Detailed_Output
+
+      sample        the light time corrected positions of the target and
+   occulter, relative to the body's center, in its body-fixed frame.
+      clearance     zero if the penumbra might touch the body at the epoch,
+   and otherwise the number of seconds for which it certainly can't.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<cppspice::BodyState> states;
+   SpiceDouble                      rotate[3][3];
+   if ( !cppspice::getMultiBodyStates(
+           { targetID, occulterID },
+           epoch,
+           observerID,
+           lightTimes,
+           states ) ||
+        !cppspice::getFrameRotation( "J2000", observerFrame, epoch, rotate ) )
+   {
+      return false;
+   }
+   const SpiceDouble* target   = states[0].State.data();
+   const SpiceDouble* occulter = states[1].State.data();
+   sample.Epoch                = epoch;
+   mxv_c( rotate, target, sample.Target );
+   mxv_c( rotate, occulter, sample.Occulter );
+
+   /*
+   Seen from anywhere on the body, the angular radius of each body is at
+   most that seen from the body's bounding radius closer to it, and the
+   direction to it is at most its parallax from the direction seen from
+   the center.
+   */
+   SpiceDouble bound = std::max(
+      { bodies.Radii[0], bodies.Radii[1], bodies.Radii[2] } );
+   SpiceDouble targetDistance   = vnorm_c( target );
+   SpiceDouble occulterDistance = vnorm_c( occulter );
+   if ( targetDistance <= bound + bodies.TargetRadius ||
+        occulterDistance <= bound + bodies.OcculterRadius )
+   {
+      clearance = 0.0;
+      return true;
+   }
+   SpiceDouble reach =
+      asin( bodies.TargetRadius / ( targetDistance - bound ) ) +
+      asin( bodies.OcculterRadius / ( occulterDistance - bound ) ) +
+      asin( bound / targetDistance ) + asin( bound / occulterDistance );
+   SpiceDouble separation = vsep_c( target, occulter );
+   SpiceDouble rate       = vnorm_c( target + 3 ) / targetDistance +
+                      vnorm_c( occulter + 3 ) / occulterDistance;
+   clearance = 0.0;
+   if ( separation > reach && rate > 0.0 ) {
+      clearance = std::min(
+         ( separation - reach ) / ( cppspice::ADAPTIVESAFETY * rate ),
+         cppspice::ADAPTIVEMAXSTEP );
+   }
+   return true;
+}
+
+/*
+This function maps the occulter's shadow on the observer's body.
+*/
+bool cppspice::mapShadowFootprint( const SimulationData& data ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+
+   - Detailed_Input
+
+      data     the simulation data, of which the occulter, target, observer,
+               span, and the footprint settings are used:
+
+                  FootprintOutput      The path of the file to write.
+                  FootprintResolution  The spacing of the grid in degrees,
+                                       FOOTPRINTRESOLUTION if zero.
+                  FootprintStep        The step through each event in
+                                       seconds, the StepSize if zero.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered. For each
+   event in which the penumbra reaches a cell of the grid while the target
+   is above its horizon, the file lists the event's first and last contact
+   on the grid, the outlines of the shadows at each step, and the latitude,
+   longitude, and contact times of each such cell. Times are in seconds
+   past J2000 TDB, with a dash for a contact which didn't happen, such as
+   the central contacts of a cell which only saw a partial eclipse.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      A cell's contact is only resolved to within the event's steps if the
+   cell is in the shadow at the first or last step of the simulation's
+   span, in which case it is missing. Phases shorter than a step may be
+   missed, as with the step of the GF searches.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble lowerEpoch{ 0.0 };
+   SpiceDouble upperEpoch{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpoch );
+   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpoch );
+
+   const std::string& targetName   = std::get<0>( data.TargetDetails );
+   const std::string& occulterName = std::get<0>( data.OcculterDetails );
+   SpiceInt           targetID{ 0 };
+   SpiceInt           occulterID{ 0 };
+   SpiceInt           observerID{ 0 };
+   SpiceBoolean       targetFound{ SPICEFALSE };
+   SpiceBoolean       occulterFound{ SPICEFALSE };
+   SpiceBoolean       observerFound{ SPICEFALSE };
+   bodn2c_c( targetName.c_str(), &targetID, &targetFound );
+   bodn2c_c( occulterName.c_str(), &occulterID, &occulterFound );
+   bodn2c_c( data.ObserverName.c_str(), &observerID, &observerFound );
+   if ( !targetFound || !occulterFound || !observerFound ) {
+      std::cout << "Error: the participants of the shadow footprint could "
+                   "not be resolved."
+                << std::endl;
+      return false;
+   }
+
+   /*
+   The target and occulter are taken as spheres of their mean radius, and
+   the observer's body as its ellipsoid, in its body-fixed frame.
+   */
+   ShadowBodies bodies;
+   SpiceDouble  targetRadii[3];
+   SpiceDouble  occulterRadii[3];
+   SpiceInt     n{ 0 };
+   for ( auto& body :
+         { std::make_pair( targetName, targetRadii ),
+           std::make_pair( occulterName, occulterRadii ),
+           std::make_pair( data.ObserverName, bodies.Radii ) } )
+   {
+      PoolHandle handle = getBodyConstantHandle( body.first, "RADII" );
+      if ( handle < 0 || !readPoolHandle( handle, 3, n, body.second ) ||
+           n != 3 )
+      {
+         std::cout << "Error: unable to read the radii of '" << body.first
+                   << "'." << std::endl;
+         return false;
+      }
+   }
+   bodies.TargetRadius =
+      ( targetRadii[0] + targetRadii[1] + targetRadii[2] ) / 3.0;
+   bodies.OcculterRadius =
+      ( occulterRadii[0] + occulterRadii[1] + occulterRadii[2] ) / 3.0;
+
+   SpiceInt     frameCode{ 0 };
+   SpiceChar    frameName[FRAMELEN];
+   SpiceBoolean frameFound{ SPICEFALSE };
+   cnmfrm_c(
+      data.ObserverName.c_str(),
+      FRAMELEN,
+      &frameCode,
+      frameName,
+      &frameFound );
+   if ( !frameFound ) {
+      std::cout << "Error: '" << data.ObserverName
+                << "' has no body-fixed frame for the shadow footprint."
+                << std::endl;
+      return false;
+   }
+   std::string observerFrame = frameName;
+
+   SpiceDouble resolution = data.FootprintResolution > 0.0
+                               ? data.FootprintResolution
+                               : FOOTPRINTRESOLUTION;
+   SpiceDouble step =
+      data.FootprintStep > 0.0 ? data.FootprintStep : data.StepSize;
+   if ( step <= 0.0 ) {
+      std::cout << "Error: the shadow footprint needs a positive step."
+                << std::endl;
+      return false;
+   }
+
+   std::ofstream out( data.FootprintOutput );
+   if ( !out ) {
+      std::cout << "Error: unable to open '" << data.FootprintOutput
+                << "' for the shadow footprint." << std::endl;
+      return false;
+   }
+
+   auto          start = std::chrono::steady_clock::now();
+   FootprintGrid grid;
+   buildFootprintGrid( resolution, bodies, grid );
+   out << "Shadow footprint of " << occulterName << " in the light of "
+       << targetName << " on " << data.ObserverName << " (" << observerFrame
+       << ")" << std::endl;
+   out << "Grid: " << grid.Rows << " x " << grid.Columns
+       << " cells, step: " << step << " s" << std::endl;
+
+   SpiceInt threads = footprintThreads;
+   if ( threads <= 0 ) {
+      threads = std::min(
+         static_cast<SpiceInt>( std::thread::hardware_concurrency() ),
+         MAXFOOTPRINTTHREADS );
+   }
+   threads = std::max(
+      static_cast<SpiceInt>( 1 ),
+      std::min( threads, grid.Rows ) );
+
+   /*
+   This traces an event's steps through the grid, and writes the event if
+   any cell saw it.
+   */
+   SpiceInt  events{ 0 };
+   long long steps{ 0 };
+   long long eclipsedCells{ 0 };
+   auto      finishEvent = [&]( const std::vector<ShadowSample>& samples ) {
+      for ( auto& contact : grid.Contacts ) {
+         std::fill(
+            contact.begin(),
+            contact.end(),
+            std::numeric_limits<SpiceDouble>::quiet_NaN() );
+      }
+      std::fill( grid.Visible.begin(), grid.Visible.end(), 0 );
+
+      std::vector<std::thread> workers;
+      for ( SpiceInt piece = 1; piece < threads; piece++ ) {
+         workers.emplace_back(
+            traceFootprintRows,
+            std::ref( grid ),
+            std::cref( samples ),
+            std::cref( bodies ),
+            grid.Rows * piece / threads,
+            grid.Rows * ( piece + 1 ) / threads );
+      }
+      traceFootprintRows( grid, samples, bodies, 0, grid.Rows / threads );
+      for ( auto& worker : workers ) {
+         worker.join();
+      }
+      steps += samples.size();
+
+      SpiceDouble first = std::numeric_limits<SpiceDouble>::infinity();
+      SpiceDouble last  = -std::numeric_limits<SpiceDouble>::infinity();
+      SpiceInt    cells{ 0 };
+      for ( size_t cell = 0; cell < grid.Visible.size(); cell++ ) {
+         if ( grid.Visible[cell] ) {
+            cells++;
+            first = std::min( first, grid.Contacts[0][cell] );
+            last  = std::max( last, grid.Contacts[3][cell] );
+         }
+      }
+      if ( cells == 0 ) {
+         return;
+      }
+
+      SpiceChar epochString[TIMELEN];
+      out << "Event " << events << std::endl;
+      timout_c(
+         std::isfinite( first ) ? first : samples.front().Epoch,
+         TIMEFORMAT,
+         TIMELEN,
+         epochString );
+      out << "   Start time: " << epochString << std::endl;
+      timout_c(
+         std::isfinite( last ) ? last : samples.back().Epoch,
+         TIMEFORMAT,
+         TIMELEN,
+         epochString );
+      out << "   Stop time:  " << epochString << std::endl;
+
+      std::vector<std::pair<SpiceDouble, SpiceDouble>> outline;
+      out << std::fixed << std::setprecision( 4 );
+      for ( auto& sample : samples ) {
+         for ( bool central : { false, true } ) {
+            getShadowOutline( sample, bodies, central, outline );
+            if ( outline.empty() ) {
+               continue;
+            }
+            timout_c( sample.Epoch, TIMEFORMAT, TIMELEN, epochString );
+            out << "   Outline " << epochString << " "
+                << ( !central                       ? "PENUMBRA "
+                     : isUmbral( sample, bodies ) ? "UMBRA "
+                                                  : "ANTUMBRA " )
+                << outline.size() << std::endl;
+            for ( auto& point : outline ) {
+               out << "      " << point.first << " " << point.second
+                   << std::endl;
+            }
+         }
+      }
+
+      out << "   Cells " << cells
+          << " (latitude, longitude, C1, C2, C3, C4, greatest)" << std::endl;
+      for ( SpiceInt row = 0; row < grid.Rows; row++ ) {
+         for ( SpiceInt column = 0; column < grid.Columns; column++ ) {
+            size_t cell = static_cast<size_t>( row ) * grid.Stride + column;
+            if ( !grid.Visible[cell] ) {
+               continue;
+            }
+            out << std::setprecision( 4 ) << "      " << grid.Latitudes[row]
+                << " " << grid.Longitudes[column] << std::setprecision( 3 );
+            for ( auto& contact : grid.Contacts ) {
+               if ( std::isnan( contact[cell] ) ) {
+                  out << " -";
+               }
+               else {
+                  out << " " << contact[cell];
+               }
+            }
+            out << std::endl;
+         }
+      }
+      out << std::defaultfloat;
+      eclipsedCells += cells;
+      events++;
+   };
+
+   /*
+   Scan the span on a fixed lattice of steps, skipping ahead while the
+   penumbra can't touch the body. An event's steps begin with the last step
+   before the penumbra might touch it, and end with the first step after.
+   */
+   LightTimeCache            lightTimes;
+   std::vector<ShadowSample> samples;
+   ShadowSample              sample;
+   ShadowSample              previous;
+   long long                 index{ 0 };
+   long long                 previousIndex{ -2 };
+   long long                 lastIndex = static_cast<long long>(
+      std::floor( ( upperEpoch - lowerEpoch ) / step ) );
+   while ( index <= lastIndex ) {
+      SpiceDouble clearance{ 0.0 };
+      if ( !sampleShadow(
+              targetID,
+              occulterID,
+              observerID,
+              observerFrame,
+              bodies,
+              lowerEpoch + index * step,
+              lightTimes,
+              sample,
+              clearance ) )
+      {
+         return false;
+      }
+
+      if ( clearance <= 0.0 ) {
+         if ( samples.empty() && index > 0 ) {
+            if ( previousIndex != index - 1 ) {
+               SpiceDouble unused{ 0.0 };
+               if ( !sampleShadow(
+                       targetID,
+                       occulterID,
+                       observerID,
+                       observerFrame,
+                       bodies,
+                       lowerEpoch + ( index - 1 ) * step,
+                       lightTimes,
+                       previous,
+                       unused ) )
+               {
+                  return false;
+               }
+            }
+            samples.push_back( previous );
+         }
+         samples.push_back( sample );
+         previous      = sample;
+         previousIndex = index;
+         index++;
+         continue;
+      }
+
+      if ( !samples.empty() ) {
+         samples.push_back( sample );
+         finishEvent( samples );
+         samples.clear();
+      }
+      previous      = sample;
+      previousIndex = index;
+      index += std::max(
+         static_cast<long long>( 1 ),
+         static_cast<long long>( clearance / step ) );
+   }
+   if ( !samples.empty() ) {
+      finishEvent( samples );
+   }
+   out.close();
+
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   std::cout << "Shadow footprint: " << events << " events, "
+             << eclipsedCells << " eclipsed cells over " << steps
+             << " steps of a " << grid.Rows << " x " << grid.Columns
+             << " grid on " << threads << " threads, in " << elapsed.count()
+             << " s" << std::endl;
+   return true;
+}
+
+/*
+This function sets the number of threads the rows may be split between.
+*/
+void cppspice::setFootprintThreads( const SpiceInt threads ) {
+   footprintThreads = std::max( static_cast<SpiceInt>( 0 ), threads );
+}
+/* End ShadowUtils.cpp */
@@ -0,0 +1,97 @@
+// clang-format off
+/*
+
+- Header_File ShadowUtils.hpp (Shadow utility code)
+
+- Abstract
+
+   Define utility functions which map the shadow which an occulter casts
+   on the observer's body, as an eclipse path over a latitude and
+   longitude grid.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   map shadow footprints. The target, which casts the light, and the
+   occulter are taken as spheres, so the shadow of the occulter is bounded
+   by two cones tangent to both of them: the penumbral cone, inside which
+   the target is at least partly covered, and the umbral cone, inside which
+   it is covered entirely (the umbra) or surrounded by the occulter's disk
+   (the antumbra, beyond the umbra's vertex).
+
+   The simulation's span is scanned for the epochs at which the penumbra
+   can reach the observer's body. For each such event, the outlines of the
+   penumbra and of the umbra or antumbra on the body's ellipsoid are found
+   at every step, and each cell of the grid is traced through the event to
+   find its contact times: C1 and C4 where the partial phase begins and
+   ends, C2 and C3 where the central (total or annular) phase begins and
+   ends, and the time of greatest eclipse.
+
+   The cells of a row are measured a block of FOOTPRINTLANES at a time, in
+   a loop without branches or square roots which the compiler turns into
+   vector instructions, and the rows are split between threads.
+
+- Literature_References
+
+   Meeus, J., "Elements of Solar Eclipses 1951-2200", Willmann-Bell, 1989.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   The observer must be a body with radii in the kernel pool and a body-
+   fixed frame. The positions of the target and occulter are corrected for
+   light time to the body's center, rather than to each cell.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes for this file.
+*/
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   This function maps the occulter's shadow on the observer's body over the
+   simulation's span, and writes the outlines and the contact times of the
+   grid's cells for each event to the simulation's FootprintOutput file.
+   */
+   bool mapShadowFootprint( const SimulationData& data );
+
+   /*
+   This function sets the number of threads which the rows of the grid may
+   be split between. Zero, the default, uses one per hardware thread up to
+   MAXFOOTPRINTTHREADS, and one traces every row on the calling thread.
+   */
+   void setFootprintThreads( const SpiceInt threads );
+}   // namespace cppspice
+    /* End ShadowUtils.hpp */
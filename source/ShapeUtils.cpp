@@ -0,0 +1,3131 @@
+// clang-format off
+/*
+
+- Source_File ShapeUtils.cpp (Shape utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   DAS
+   DSK
+   FRAMES
+   NAIF_IDS
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (ShapeUtils.hpp). The bounding volume
+   hierarchy is built top down. At each node, the plate centroids are
+   sorted into SHAPEBINS bins along each axis, and the node is split at the
+   bin boundary with the lowest surface area heuristic cost:
+
+      cost = 1 + ( A(left) N(left) + A(right) N(right) ) / A(node)
+
+   where A is the surface area of a box and N is the number of blocks of
+   SHAPELANES plates it fills, since a leaf's plates are tested a block at
+   a time. A node becomes a leaf when splitting it costs more than testing
+   its plates, which is N(node), so a node which fits in one block is
+   always a leaf.
+
+   The block test is the Moller-Trumbore test written once per lane
+   without branches, over plates stored with each component of the lanes
+   together, which the compiler turns into vector instructions. Arrays of
+   rays are split into runs which are cast on separate threads. Tracing
+   only reads the model, so the threads share it as it is.
+
+   Each node is 32 bytes: its box in single precision, rounded outward so
+   that it still contains its plates, and two integers. A leaf holds the
+   index of its first plate and the number of plates. An interior node
+   holds the index of its second child and the axis it was split along;
+   its first child is the node which follows it.
+
+   A hierarchy is built for each segment on its own, and cached with the
+   segment's plates. A model copies the plates and nodes of its segments
+   and links their hierarchies beneath a balanced tree over the segments'
+   root boxes, offsetting their indices, which is a copy rather than a
+   rebuild when the segments are cached.
+
+- Literature_References
+
+   Wald, I., "On fast Construction of SAH-based Bounding Volume
+   Hierarchies", IEEE Symposium on Interactive Ray Tracing, 2007.
+
+   Moller, T., Trumbore, B., "Fast, Minimum Storage Ray-Triangle
+   Intersection", Journal of Graphics Tools, 1997.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, algorithm and cmath for the arithmetic,
+map, tuple and vector for the registry and the segment cache, limits for
+its eviction, thread for casting arrays of rays, chrono for the build and
+benchmark times, the kernel utilities so that models can tell when the
+loaded kernels have changed, and the DAS utilities to map the DSKs.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "DASUtils.hpp"
+#include "KernelUtils.hpp"
+#include "ShapeUtils.hpp"
+
+/*
+A node of a bounding volume hierarchy. Count is the number of plates of a
+leaf, or -1 - axis for an interior node, whose second child is at Start.
+*/
+struct ShapeNode {
+   float    Lower[3];
+   float    Upper[3];
+   SpiceInt Start;
+   SpiceInt Count;
+};
+static_assert( sizeof( ShapeNode ) == 32, "ShapeNode must be 32 bytes." );
+
+/*
+The silhouette of a shape model as seen along one direction of the grid,
+with the east and north vectors which position angles are measured from.
+The inner radius at each angle is the extent to which the silhouette is
+solid, and the outer radius the extent beyond which it is empty. A table
+with no radii hasn't been built yet.
+*/
+struct SilhouetteTable {
+   SpiceDouble              Direction[3];
+   SpiceDouble              East[3];
+   SpiceDouble              North[3];
+   std::vector<SpiceDouble> Inner;
+   std::vector<SpiceDouble> Outer;
+   SpiceDouble              Nearest;
+   SpiceDouble              Farthest;
+};
+
+/*
+A DSK segment is identified by the file it is in and the base addresses of
+its integer and double precision data, which, unlike its DAS handle, stay
+the same when the file is unloaded and loaded again.
+*/
+using SegmentKey = std::tuple<std::string, SpiceInt, SpiceInt>;
+
+/*
+The plates of a segment and the hierarchy over them, stored in blocks as a
+model stores them, and kept so that a model can be assembled without
+reading the segment from its file or building its hierarchy again. The
+radius is that of the farthest vertex. While a resident model holds the
+segment's plates, the segment keeps only its hierarchy, so that every plate
+is stored, and counted against the cache, once.
+*/
+struct CachedSegment {
+   std::vector<SpiceDouble> Plates;
+   std::vector<SpiceInt>    PlateIDs;
+   std::vector<ShapeNode>   Nodes;
+   SpiceInt                 PlateCount;
+   SpiceDouble              Radius;
+   long long                LastUse;
+};
+
+/*
+A shape model built from the DSK type 2 segments of a body. Each plate is
+stored as its first vertex and its two edges from that vertex, as
+Moller-Trumbore uses them, in the order the leaves reference them. The
+plates are grouped in blocks of SHAPELANES, each holding one component of
+every lane in turn, and each leaf starts a block, so the plate slots
+include the empty plates which fill out the leaves' last blocks. The plate
+IDs are those of the segments the plates were read from, or zero for an
+empty plate. The offsets are the first plate slots of the model's source
+segments. A model which has been evicted from the cache has no plates and a
+generation of -1, and is rebuilt the next time it is resolved.
+*/
+struct ShapeModel {
+   SpiceInt                     BodyID;
+   std::string                  Frame;
+   SpiceInt                     Segments;
+   SpiceInt                     PlateCount;
+   std::vector<SpiceDouble>     Plates;
+   std::vector<SpiceInt>        PlateIDs;
+   std::vector<ShapeNode>       Nodes;
+   SpiceDouble                  BoundingRadius;
+   SpiceDouble                  BuildTime;
+   long long                    Generation;
+   std::vector<SilhouetteTable> Silhouettes;
+   std::vector<SegmentKey>      Sources;
+   std::vector<SpiceInt>        SourceOffsets;
+   long long                    LastUse;
+};
+static std::vector<ShapeModel>                       shapeModels;
+static std::map<SpiceInt, cppspice::ShapeModelHandle> shapeModelIndex;
+static bool                                           silhouetteCache = true;
+
+/*
+The segment cache, the clock which orders models and segments by their
+last use, the cache's counters, and its capacity in plates.
+*/
+static std::map<SegmentKey, CachedSegment> cachedSegments;
+static long long                           shapeCacheClock{ 0 };
+static cppspice::ShapeCacheStatistics      shapeCacheStatistics;
+
+static SpiceInt shapeCacheSize = cppspice::SHAPECACHEPLATES;
+
+/*
+The number of threads which arrays of rays may be cast on, where zero means
+one per hardware thread.
+*/
+static SpiceInt shapeThreads = 0;
+
+/*
+Whether segments are read from their files through a mapping, rather than
+through CSPICE.
+*/
+static bool mappedShapeReads = true;
+
+/*
+A DSK type 2 segment of a body, as found among the loaded kernels.
+*/
+struct ShapeSegment {
+   SpiceInt      Handle;
+   SpiceDLADescr Descriptor;
+   std::string   Frame;
+   std::string   File;
+};
+
+/*
+The bounds and centroids of the plates while a hierarchy is being built.
+*/
+struct ShapeBuild {
+   std::vector<SpiceDouble> Lower;
+   std::vector<SpiceDouble> Upper;
+   std::vector<SpiceDouble> Centroids;
+   std::vector<SpiceInt>    Order;
+   std::vector<ShapeNode>   Nodes;
+};
+
+/*
+This is a helper which finds every loaded DSK type 2 segment of a body.
+*/
+static bool findShapeSegments(
+   const SpiceInt             bodyID,
+   std::vector<ShapeSegment>& segments ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      SpiceInt   I   The NAIF ID of the body.
+      vector     O   The body's segments.
+
+   - Detailed_Input
+
+      bodyID   the NAIF ID of the body whose segments are wanted.
+
+   - Detailed_Output
+
+      segments    the DSK type 2 segments of the body, in the order of the
+   loaded DSKs. It is empty if the body has none.
+
+      The function returns true if the segments could be read, and all of
+   them use the same reference frame.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   segments.clear();
+   SpiceInt count{ 0 };
+   ktotal_c( "DSK", &count );
+   for ( SpiceInt i = 0; i < count; i++ ) {
+      SpiceChar    file[cppspice::FILENAMELEN];
+      SpiceChar    type[cppspice::FILETYPELEN];
+      SpiceChar    source[cppspice::FILENAMELEN];
+      SpiceInt     handle{ 0 };
+      SpiceBoolean found{ false };
+      kdata_c(
+         i,
+         "DSK",
+         cppspice::FILENAMELEN,
+         cppspice::FILETYPELEN,
+         cppspice::FILENAMELEN,
+         file,
+         type,
+         source,
+         &handle,
+         &found );
+      if ( !found ) {
+         continue;
+      }
+
+      SpiceDLADescr descriptor;
+      dlabfs_c( handle, &descriptor, &found );
+      while ( found ) {
+         SpiceDSKDescr summary;
+         dskgd_c( handle, &descriptor, &summary );
+         if ( summary.center == bodyID && summary.dtype == 2 ) {
+            SpiceChar frame[cppspice::FRAMELEN];
+            frmnam_c( summary.frmcde, cppspice::FRAMELEN, frame );
+            segments.push_back( { handle, descriptor, frame, file } );
+         }
+         SpiceDLADescr next;
+         dlafns_c( handle, &descriptor, &next, &found );
+         descriptor = next;
+      }
+   }
+   if ( failed_c() ) {
+      return false;
+   }
+
+   for ( auto& segment : segments ) {
+      if ( segment.Frame != segments.front().Frame ) {
+         std::cout << "Error: the DSK segments for the body " << bodyID
+                   << " use both the " << segments.front().Frame << " and "
+                   << segment.Frame << " frames." << std::endl;
+         return false;
+      }
+   }
+   return true;
+}
+
+/*
+This is a helper which rounds a box outward to single precision.
+*/
+static void storeNodeBounds(
+   const SpiceDouble lower[3],
+   const SpiceDouble upper[3],
+   ShapeNode&        node ) {
+   for ( SpiceInt i = 0; i < 3; i++ ) {
+      node.Lower[i] = static_cast<float>( lower[i] );
+      if ( node.Lower[i] > lower[i] ) {
+         node.Lower[i] = std::nextafter( node.Lower[i], -HUGE_VALF );
+      }
+      node.Upper[i] = static_cast<float>( upper[i] );
+      if ( node.Upper[i] < upper[i] ) {
+         node.Upper[i] = std::nextafter( node.Upper[i], HUGE_VALF );
+      }
+   }
+}
+
+/*
+This is a helper which computes half the surface area of a box, which is
+all the surface area heuristic needs.
+*/
+static SpiceDouble getHalfArea(
+   const SpiceDouble lower[3],
+   const SpiceDouble upper[3] ) {
+   SpiceDouble x = std::max( 0.0, upper[0] - lower[0] );
+   SpiceDouble y = std::max( 0.0, upper[1] - lower[1] );
+   SpiceDouble z = std::max( 0.0, upper[2] - lower[2] );
+   return x * y + y * z + z * x;
+}
+
+/*
+This is a helper which gives the cost of testing a number of plates, which
+is the number of blocks of SHAPELANES they fill.
+*/
+static SpiceDouble getBlocks( const SpiceInt plates ) {
+   return static_cast<SpiceDouble>(
+      ( plates + cppspice::SHAPELANES - 1 ) / cppspice::SHAPELANES );
+}
+
+/*
+This is a helper which builds the node for a run of plates, and then the
+nodes beneath it, depth first.
+*/
+static void buildShapeNodes(
+   ShapeBuild&    build,
+   const SpiceInt first,
+   const SpiceInt count,
+   const SpiceInt depth ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct    I/O  The hierarchy being built.
+      SpiceInt   I   The first entry of the run in the plate order.
+      SpiceInt   I   The number of plates in the run.
+      SpiceInt   I   The depth of the node.
+
+   - Detailed_Input
+
+      build    the plate bounds and centroids, the plate order, and the
+               nodes built so far.
+      first    the index of the run's first plate in build.Order.
+      count    the number of plates in the run, which must be positive.
+      depth    the depth of the node, which is zero for the root.
+
+   - Detailed_Output
+
+      build    with the node and all of its descendants appended to
+   build.Nodes, and the run reordered so that each leaf's plates are
+   contiguous.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      Nodes at SHAPEMAXDEPTH become leaves however many plates they hold,
+   so that a traversal never needs a deeper stack.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::SHAPEBINS;
+
+   SpiceDouble lower[3]         = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+   SpiceDouble upper[3]         = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL };
+   SpiceDouble centroidLower[3] = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+   SpiceDouble centroidUpper[3] = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL };
+   for ( SpiceInt i = first; i < first + count; i++ ) {
+      SpiceInt plate = build.Order[i];
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         lower[k] = std::min( lower[k], build.Lower[3 * plate + k] );
+         upper[k] = std::max( upper[k], build.Upper[3 * plate + k] );
+         SpiceDouble centroid = build.Centroids[3 * plate + k];
+         centroidLower[k]     = std::min( centroidLower[k], centroid );
+         centroidUpper[k]     = std::max( centroidUpper[k], centroid );
+      }
+   }
+
+   SpiceInt index = static_cast<SpiceInt>( build.Nodes.size() );
+   build.Nodes.emplace_back();
+   storeNodeBounds( lower, upper, build.Nodes[index] );
+   build.Nodes[index].Start = first;
+   build.Nodes[index].Count = count;
+   if ( count <= cppspice::SHAPELANES ||
+        depth >= cppspice::SHAPEMAXDEPTH )
+   {
+      return;
+   }
+
+   /*
+   Find the cheapest split over the bins of every axis. The costs are kept
+   relative to the node's area until the comparison with the leaf.
+   */
+   SpiceInt    bestAxis{ -1 };
+   SpiceInt    bestBin{ 0 };
+   SpiceDouble bestCost = HUGE_VAL;
+   for ( SpiceInt axis = 0; axis < 3; axis++ ) {
+      SpiceDouble extent = centroidUpper[axis] - centroidLower[axis];
+      if ( extent <= 0.0 ) {
+         continue;
+      }
+      SpiceDouble scale = SHAPEBINS / extent;
+
+      SpiceInt    binCounts[SHAPEBINS] = {};
+      SpiceDouble binLower[SHAPEBINS][3];
+      SpiceDouble binUpper[SHAPEBINS][3];
+      std::fill_n( &binLower[0][0], 3 * SHAPEBINS, HUGE_VAL );
+      std::fill_n( &binUpper[0][0], 3 * SHAPEBINS, -HUGE_VAL );
+      for ( SpiceInt i = first; i < first + count; i++ ) {
+         SpiceInt plate = build.Order[i];
+         SpiceInt bin   = std::min(
+            SHAPEBINS - 1,
+            static_cast<SpiceInt>(
+               ( build.Centroids[3 * plate + axis] - centroidLower[axis] ) *
+               scale ) );
+         binCounts[bin]++;
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            binLower[bin][k] =
+               std::min( binLower[bin][k], build.Lower[3 * plate + k] );
+            binUpper[bin][k] =
+               std::max( binUpper[bin][k], build.Upper[3 * plate + k] );
+         }
+      }
+
+      /*
+      Sweep from the right to get the cost of every right side, and then
+      from the left to complete each split.
+      */
+      SpiceDouble rightCost[SHAPEBINS];
+      SpiceDouble sweepLower[3] = { HUGE_VAL, HUGE_VAL, HUGE_VAL };
+      SpiceDouble sweepUpper[3] = { -HUGE_VAL, -HUGE_VAL, -HUGE_VAL };
+      SpiceInt    sweepCount{ 0 };
+      for ( SpiceInt bin = SHAPEBINS - 1; bin > 0; bin-- ) {
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            sweepLower[k] = std::min( sweepLower[k], binLower[bin][k] );
+            sweepUpper[k] = std::max( sweepUpper[k], binUpper[bin][k] );
+         }
+         sweepCount += binCounts[bin];
+         rightCost[bin] =
+            getBlocks( sweepCount ) * getHalfArea( sweepLower, sweepUpper );
+      }
+      std::fill( sweepLower, sweepLower + 3, HUGE_VAL );
+      std::fill( sweepUpper, sweepUpper + 3, -HUGE_VAL );
+      sweepCount = 0;
+      for ( SpiceInt bin = 0; bin < SHAPEBINS - 1; bin++ ) {
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            sweepLower[k] = std::min( sweepLower[k], binLower[bin][k] );
+            sweepUpper[k] = std::max( sweepUpper[k], binUpper[bin][k] );
+         }
+         sweepCount += binCounts[bin];
+         if ( sweepCount == 0 || sweepCount == count ) {
+            continue;
+         }
+         SpiceDouble cost =
+            getBlocks( sweepCount ) * getHalfArea( sweepLower, sweepUpper ) +
+            rightCost[bin + 1];
+         if ( cost < bestCost ) {
+            bestAxis = axis;
+            bestBin  = bin;
+            bestCost = cost;
+         }
+      }
+   }
+
+   /*
+   Make a leaf if the plates can't be told apart, or if splitting doesn't
+   pay and the leaf is small enough.
+   */
+   SpiceDouble area = getHalfArea( lower, upper );
+   if ( bestAxis < 0 ) {
+      if ( count <= cppspice::SHAPEMAXLEAF ) {
+         return;
+      }
+   }
+   else if (
+      count <= cppspice::SHAPEMAXLEAF &&
+      area + bestCost >= area * getBlocks( count ) )
+   {
+      return;
+   }
+
+   SpiceInt* begin = build.Order.data() + first;
+   SpiceInt* end   = begin + count;
+   SpiceInt* middle{ nullptr };
+   if ( bestAxis >= 0 ) {
+      SpiceDouble scale =
+         SHAPEBINS / ( centroidUpper[bestAxis] - centroidLower[bestAxis] );
+      middle = std::partition( begin, end, [&]( SpiceInt plate ) {
+         SpiceInt bin = std::min(
+            SHAPEBINS - 1,
+            static_cast<SpiceInt>(
+               ( build.Centroids[3 * plate + bestAxis] -
+                 centroidLower[bestAxis] ) *
+               scale ) );
+         return bin <= bestBin;
+      } );
+   }
+   else {
+      /*
+      Every centroid is the same, so any even split will do.
+      */
+      bestAxis = 0;
+      middle   = begin + count / 2;
+   }
+
+   SpiceInt leftCount = static_cast<SpiceInt>( middle - begin );
+   buildShapeNodes( build, first, leftCount, depth + 1 );
+   build.Nodes[index].Start = static_cast<SpiceInt>( build.Nodes.size() );
+   build.Nodes[index].Count = -1 - bestAxis;
+   buildShapeNodes( build, first + leftCount, count - leftCount, depth + 1 );
+}
+
+/*
+This is a helper which finds the plates and hierarchy of a segment, reading
+the segment from its file and building its hierarchy if they aren't cached.
+*/
+static const CachedSegment* loadShapeSegment( const ShapeSegment& segment ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct     I   The segment.
+
+   - Detailed_Input
+
+      segment  a DSK type 2 segment found by findShapeSegments.
+
+   - Detailed_Output
+
+      Returns the segment's plates and hierarchy, or a null pointer if the
+   segment couldn't be read. They stay in the cache until it is trimmed.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SegmentKey key(
+      segment.File,
+      segment.Descriptor.ibase,
+      segment.Descriptor.dbase );
+   auto existing = cachedSegments.find( key );
+   if ( existing != cachedSegments.end() ) {
+      if ( !existing->second.PlateIDs.empty() ) {
+         shapeCacheStatistics.SegmentHits++;
+         existing->second.LastUse = ++shapeCacheClock;
+         return &existing->second;
+      }
+
+      /*
+      The segment's plates are held by another model, so read it again.
+      */
+      cachedSegments.erase( existing );
+   }
+
+   SpiceInt vertexCount{ 0 };
+   SpiceInt plateCount{ 0 };
+   dskz02_c( segment.Handle, &segment.Descriptor, &vertexCount, &plateCount );
+   if ( failed_c() ) {
+      return nullptr;
+   }
+
+   /*
+   When the file can be mapped, the vertices and plates are used in place,
+   or copied out of the mapping if they span clusters. Otherwise they are
+   read through CSPICE.
+   */
+   auto                     readStart = std::chrono::steady_clock::now();
+   cppspice::MappedDASFile  file;
+   const SpiceDouble*       vertices{ nullptr };
+   const SpiceInt*          plates{ nullptr };
+   std::vector<SpiceDouble> vertexCopy;
+   std::vector<SpiceInt>    plateCopy;
+   if ( mappedShapeReads && file.open( segment.File ) ) {
+      SpiceInt vertexFirst =
+         segment.Descriptor.dbase + cppspice::DSKVERTEXSTART;
+      SpiceInt vertexLast = vertexFirst + 3 * vertexCount - 1;
+      SpiceInt plateFirst =
+         segment.Descriptor.ibase + cppspice::DSKPLATESTART;
+      SpiceInt plateLast = plateFirst + 3 * plateCount - 1;
+
+      vertices = file.getDoubles( vertexFirst, vertexLast );
+      if ( vertices == nullptr ) {
+         vertexCopy.resize( 3 * vertexCount );
+         if ( file.readDoubles( vertexFirst, vertexLast, vertexCopy.data() ) )
+         {
+            vertices = vertexCopy.data();
+         }
+      }
+      plates = file.getIntegers( plateFirst, plateLast );
+      if ( plates == nullptr ) {
+         plateCopy.resize( 3 * plateCount );
+         if ( file.readIntegers( plateFirst, plateLast, plateCopy.data() ) ) {
+            plates = plateCopy.data();
+         }
+      }
+   }
+   if ( vertices != nullptr && plates != nullptr ) {
+      shapeCacheStatistics.MappedReads++;
+   }
+   else {
+      SpiceInt n{ 0 };
+      vertexCopy.resize( 3 * vertexCount );
+      plateCopy.resize( 3 * plateCount );
+      dskv02_c(
+         segment.Handle,
+         &segment.Descriptor,
+         1,
+         vertexCount,
+         &n,
+         reinterpret_cast<SpiceDouble( * )[3]>( vertexCopy.data() ) );
+      dskp02_c(
+         segment.Handle,
+         &segment.Descriptor,
+         1,
+         plateCount,
+         &n,
+         reinterpret_cast<SpiceInt( * )[3]>( plateCopy.data() ) );
+      if ( failed_c() ) {
+         return nullptr;
+      }
+      vertices = vertexCopy.data();
+      plates   = plateCopy.data();
+   }
+   std::chrono::duration<double> readTime =
+      std::chrono::steady_clock::now() - readStart;
+   shapeCacheStatistics.ReadTime += readTime.count();
+   shapeCacheStatistics.SegmentReads++;
+   shapeCacheStatistics.PlatesRead += plateCount;
+
+   CachedSegment cached;
+   cached.Radius = 0.0;
+   for ( SpiceInt i = 0; i < vertexCount; i++ ) {
+      cached.Radius = std::max( cached.Radius, vnorm_c( &vertices[3 * i] ) );
+   }
+
+   /*
+   Build the hierarchy over the plates' bounds and centroids.
+   */
+   ShapeBuild build;
+   build.Lower.resize( 3 * plateCount );
+   build.Upper.resize( 3 * plateCount );
+   build.Centroids.resize( 3 * plateCount );
+   build.Order.resize( plateCount );
+   for ( SpiceInt i = 0; i < plateCount; i++ ) {
+      const SpiceDouble* corner[3] = {
+         &vertices[3 * ( plates[3 * i] - 1 )],
+         &vertices[3 * ( plates[3 * i + 1] - 1 )],
+         &vertices[3 * ( plates[3 * i + 2] - 1 )] };
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         build.Lower[3 * i + k] =
+            std::min( { corner[0][k], corner[1][k], corner[2][k] } );
+         build.Upper[3 * i + k] =
+            std::max( { corner[0][k], corner[1][k], corner[2][k] } );
+         build.Centroids[3 * i + k] =
+            ( corner[0][k] + corner[1][k] + corner[2][k] ) / 3.0;
+      }
+      build.Order[i] = i;
+   }
+   build.Nodes.reserve( plateCount );
+   buildShapeNodes( build, 0, plateCount, 0 );
+
+   /*
+   Store the plates in the order the leaves reference them, in blocks of
+   SHAPELANES. Each leaf starts a block, and the rest of its last block is
+   left as empty plates with an ID of zero.
+   */
+   using cppspice::SHAPELANES;
+   SpiceInt slots{ 0 };
+   for ( auto& node : build.Nodes ) {
+      if ( node.Count > 0 ) {
+         slots += ( node.Count + SHAPELANES - 1 ) / SHAPELANES * SHAPELANES;
+      }
+   }
+   cached.Plates.assign( 9 * slots, 0.0 );
+   cached.PlateIDs.assign( slots, 0 );
+   cached.PlateCount = plateCount;
+
+   SpiceInt slot{ 0 };
+   for ( auto& node : build.Nodes ) {
+      if ( node.Count <= 0 ) {
+         continue;
+      }
+      for ( SpiceInt i = 0; i < node.Count; i++ ) {
+         SpiceInt           index  = build.Order[node.Start + i];
+         SpiceInt           lane   = ( slot + i ) % SHAPELANES;
+         const SpiceInt*    plate  = &plates[3 * index];
+         const SpiceDouble* first  = &vertices[3 * ( plate[0] - 1 )];
+         const SpiceDouble* second = &vertices[3 * ( plate[1] - 1 )];
+         const SpiceDouble* third  = &vertices[3 * ( plate[2] - 1 )];
+         SpiceDouble*       block  = &cached.Plates[9 * ( slot + i - lane )];
+         for ( SpiceInt k = 0; k < 3; k++ ) {
+            block[k * SHAPELANES + lane]         = first[k];
+            block[( 3 + k ) * SHAPELANES + lane] = second[k] - first[k];
+            block[( 6 + k ) * SHAPELANES + lane] = third[k] - first[k];
+         }
+         cached.PlateIDs[slot + i] = index + 1;
+      }
+      node.Start = slot;
+      slot += ( node.Count + SHAPELANES - 1 ) / SHAPELANES * SHAPELANES;
+   }
+   cached.Nodes.swap( build.Nodes );
+   cached.Nodes.shrink_to_fit();
+   cached.LastUse = ++shapeCacheClock;
+
+   auto inserted = cachedSegments.emplace( key, std::move( cached ) );
+   return &inserted.first->second;
+}
+
+/*
+This is a helper which links the hierarchies of a model's segments beneath
+a tree over their root boxes, depth first.
+*/
+static void linkShapeNodes(
+   const std::vector<const CachedSegment*>& pieces,
+   const std::vector<SpiceInt>&             plateOffsets,
+   std::vector<SpiceInt>&                   order,
+   const SpiceInt                           first,
+   const SpiceInt                           count,
+   std::vector<ShapeNode>&                  nodes ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      vector     I   The segments of the model.
+      vector     I   The index of each segment's first plate in the model.
+      vector    I/O  The order of the segments.
+      SpiceInt   I   The first entry of the run in the segment order.
+      SpiceInt   I   The number of segments in the run.
+      vector    I/O  The nodes of the model.
+
+   - Detailed_Input
+
+      pieces         the cached segments, in the order of the model's plates.
+      plateOffsets   the index in the model of each segment's first plate.
+      order          the indices of the segments, of which those in the run
+                     are to be linked.
+      nodes          the nodes linked so far.
+
+   - Detailed_Output
+
+      order    with the run reordered as the segments were split.
+      nodes    with the run's nodes appended. A run of one segment is its
+               hierarchy, with its indices offset to where its nodes and
+               plates are in the model.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      A run of several segments is split in half along the longest axis of
+   its box, by the centers of the segments' root boxes. The tree over the
+   segments is therefore balanced, and adds no more than 32 levels to the
+   deepest of the segments' hierarchies.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   if ( count == 1 ) {
+      const CachedSegment& piece     = *pieces[order[first]];
+      SpiceInt             nodeBase  = static_cast<SpiceInt>( nodes.size() );
+      SpiceInt             plateBase = plateOffsets[order[first]];
+      for ( ShapeNode node : piece.Nodes ) {
+         node.Start += node.Count < 0 ? nodeBase : plateBase;
+         nodes.push_back( node );
+      }
+      return;
+   }
+
+   ShapeNode node;
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      node.Lower[k] = HUGE_VALF;
+      node.Upper[k] = -HUGE_VALF;
+   }
+   for ( SpiceInt i = first; i < first + count; i++ ) {
+      const ShapeNode& root = pieces[order[i]]->Nodes.front();
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         node.Lower[k] = std::min( node.Lower[k], root.Lower[k] );
+         node.Upper[k] = std::max( node.Upper[k], root.Upper[k] );
+      }
+   }
+   SpiceInt axis{ 0 };
+   for ( SpiceInt k = 1; k < 3; k++ ) {
+      if ( node.Upper[k] - node.Lower[k] >
+           node.Upper[axis] - node.Lower[axis] )
+      {
+         axis = k;
+      }
+   }
+   auto center = [&]( const SpiceInt piece ) {
+      const ShapeNode& root = pieces[piece]->Nodes.front();
+      return root.Lower[axis] + root.Upper[axis];
+   };
+   SpiceInt leftCount = count / 2;
+   std::nth_element(
+      order.begin() + first,
+      order.begin() + first + leftCount,
+      order.begin() + first + count,
+      [&]( const SpiceInt a, const SpiceInt b ) {
+         return center( a ) < center( b );
+      } );
+
+   SpiceInt index = static_cast<SpiceInt>( nodes.size() );
+   nodes.push_back( node );
+   linkShapeNodes( pieces, plateOffsets, order, first, leftCount, nodes );
+   nodes[index].Start = static_cast<SpiceInt>( nodes.size() );
+   nodes[index].Count = -1 - axis;
+   linkShapeNodes(
+      pieces,
+      plateOffsets,
+      order,
+      first + leftCount,
+      count - leftCount,
+      nodes );
+}
+
+/*
+This is a helper which hands the plates of a model's segments back to the
+segment cache, so that the model can be rebuilt without reading them again.
+If the cache is disabled, the segments are dropped instead.
+*/
+static void returnShapePlates( ShapeModel& model ) {
+   for ( size_t i = 0; i < model.Sources.size(); i++ ) {
+      auto entry = cachedSegments.find( model.Sources[i] );
+      if ( entry == cachedSegments.end() ||
+           !entry->second.PlateIDs.empty() )
+      {
+         continue;
+      }
+      if ( shapeCacheSize <= 0 ) {
+         cachedSegments.erase( entry );
+         continue;
+      }
+      size_t first = model.SourceOffsets[i];
+      size_t last  = i + 1 < model.Sources.size() ? model.SourceOffsets[i + 1]
+                                                  : model.PlateIDs.size();
+      entry->second.Plates.assign(
+         model.Plates.begin() + 9 * first,
+         model.Plates.begin() + 9 * last );
+      entry->second.PlateIDs.assign(
+         model.PlateIDs.begin() + first,
+         model.PlateIDs.begin() + last );
+   }
+}
+
+/*
+This is a helper which releases the storage of a model, leaving it to be
+rebuilt the next time it is resolved. The segments whose plates it held go
+with it.
+*/
+static void evictShapeModel( ShapeModel& model ) {
+   for ( auto& source : model.Sources ) {
+      auto entry = cachedSegments.find( source );
+      if ( entry != cachedSegments.end() &&
+           entry->second.PlateIDs.empty() )
+      {
+         cachedSegments.erase( entry );
+      }
+   }
+   std::vector<SpiceDouble>().swap( model.Plates );
+   std::vector<SpiceInt>().swap( model.PlateIDs );
+   std::vector<ShapeNode>().swap( model.Nodes );
+   std::vector<SilhouetteTable>().swap( model.Silhouettes );
+   model.Sources.clear();
+   model.SourceOffsets.clear();
+   model.Generation = -1;
+}
+
+/*
+This is a helper which evicts the least recently used models and decoded
+segments until the plates they hold fit in the cache.
+*/
+static void trimShapeCache( const ShapeModel* keep ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      ShapeModel*   I   A model which must not be evicted.
+
+   - Detailed_Input
+
+      keep     the model which is being built or used, which is never
+               evicted, or a null pointer.
+
+   - Detailed_Output
+
+      None. Models and segments are evicted, oldest first, until the plates
+   of the resident models and of the decoded segments together fit in
+   shapeCacheSize, or only the kept model is left. A segment whose plates
+   are held by a model holds none itself, and goes with the model.
+
+   - Error Handling
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   long long resident{ 0 };
+   for ( auto& model : shapeModels ) {
+      resident += static_cast<long long>( model.PlateIDs.size() );
+   }
+   for ( auto& entry : cachedSegments ) {
+      resident += static_cast<long long>( entry.second.PlateIDs.size() );
+   }
+
+   while ( resident > shapeCacheSize ) {
+      ShapeModel* oldestModel{ nullptr };
+      auto        oldestSegment = cachedSegments.end();
+      long long   oldest        = std::numeric_limits<long long>::max();
+      for ( auto& model : shapeModels ) {
+         if ( &model != keep && !model.PlateIDs.empty() &&
+              model.LastUse < oldest )
+         {
+            oldestModel = &model;
+            oldest      = model.LastUse;
+         }
+      }
+      for ( auto entry = cachedSegments.begin();
+            entry != cachedSegments.end();
+            ++entry )
+      {
+         if ( !entry->second.PlateIDs.empty() &&
+              entry->second.LastUse < oldest )
+         {
+            oldestSegment = entry;
+            oldest        = entry->second.LastUse;
+         }
+      }
+
+      if ( oldestSegment != cachedSegments.end() ) {
+         resident -=
+            static_cast<long long>( oldestSegment->second.PlateIDs.size() );
+         cachedSegments.erase( oldestSegment );
+      }
+      else if ( oldestModel != nullptr ) {
+         resident -= static_cast<long long>( oldestModel->PlateIDs.size() );
+         evictShapeModel( *oldestModel );
+      }
+      else {
+         break;
+      }
+      shapeCacheStatistics.Evictions++;
+   }
+   shapeCacheStatistics.ResidentPlates = resident;
+}
+
+/*
+This is a helper which assembles a body's model from its segments.
+*/
+static bool buildShapeModel( ShapeModel& model ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct    I/O  The shape model.
+
+   - Detailed_Input
+
+      model    a ShapeModel whose BodyID is set.
+
+   - Detailed_Output
+
+      model    the ShapeModel, built from the currently loaded DSKs.
+
+      The function returns true if the model could be built.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      When the cache is enabled and the model is resident, a model whose
+   segments are the same as when it was built is kept without reading or
+   building anything. Otherwise, each segment's plates and hierarchy are
+   taken from the segment cache, or read and built if they aren't there,
+   and the hierarchies are linked beneath a tree over the segments. The
+   cache is then trimmed to its capacity.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   auto start = std::chrono::steady_clock::now();
+
+   std::vector<ShapeSegment> segments;
+   if ( !findShapeSegments( model.BodyID, segments ) ) {
+      return false;
+   }
+   if ( segments.empty() ) {
+      std::cout << "Error: no DSK type 2 segments for the body "
+                << model.BodyID << " are loaded." << std::endl;
+      return false;
+   }
+
+   /*
+   Loading or unloading an unrelated kernel, or loading the model's own DSK
+   again, leaves its segments as they were, so a resident model is kept.
+   */
+   std::vector<SegmentKey> sources;
+   for ( auto& segment : segments ) {
+      sources.emplace_back(
+         segment.File,
+         segment.Descriptor.ibase,
+         segment.Descriptor.dbase );
+   }
+   if ( shapeCacheSize > 0 && !model.Nodes.empty() &&
+        sources == model.Sources )
+   {
+      shapeCacheStatistics.ModelReuses++;
+      model.Frame      = segments.front().Frame;
+      model.Generation = cppspice::getKernelGeneration();
+      return true;
+   }
+
+   /*
+   Find the plates and hierarchy of every segment, handing back the plates
+   the model held first.
+   */
+   returnShapePlates( model );
+   std::vector<const CachedSegment*> pieces;
+   std::vector<SpiceInt>             plateOffsets;
+   SpiceInt                          slots{ 0 };
+   SpiceInt                          nodeCount{ 0 };
+   model.PlateCount     = 0;
+   model.BoundingRadius = 0.0;
+   for ( auto& segment : segments ) {
+      const CachedSegment* piece = loadShapeSegment( segment );
+      if ( piece == nullptr ) {
+         return false;
+      }
+      pieces.push_back( piece );
+      plateOffsets.push_back( slots );
+      slots += static_cast<SpiceInt>( piece->PlateIDs.size() );
+      nodeCount += static_cast<SpiceInt>( piece->Nodes.size() );
+      model.PlateCount += piece->PlateCount;
+      model.BoundingRadius = std::max( model.BoundingRadius, piece->Radius );
+   }
+
+   /*
+   Copy the segments' plates into the model, and link their hierarchies.
+   */
+   model.Plates.clear();
+   model.Plates.reserve( 9 * slots );
+   model.PlateIDs.clear();
+   model.PlateIDs.reserve( slots );
+   for ( auto piece : pieces ) {
+      model.Plates.insert(
+         model.Plates.end(),
+         piece->Plates.begin(),
+         piece->Plates.end() );
+      model.PlateIDs.insert(
+         model.PlateIDs.end(),
+         piece->PlateIDs.begin(),
+         piece->PlateIDs.end() );
+   }
+   std::vector<SpiceInt> order( pieces.size() );
+   for ( size_t i = 0; i < pieces.size(); i++ ) {
+      order[i] = static_cast<SpiceInt>( i );
+   }
+   model.Nodes.clear();
+   model.Nodes.reserve( nodeCount + pieces.size() - 1 );
+   linkShapeNodes(
+      pieces,
+      plateOffsets,
+      order,
+      0,
+      static_cast<SpiceInt>( pieces.size() ),
+      model.Nodes );
+   model.Silhouettes.clear();
+   model.Silhouettes.resize(
+      cppspice::SILHOUETTELATS * cppspice::SILHOUETTELONS );
+   model.Frame      = segments.front().Frame;
+   model.Segments   = static_cast<SpiceInt>( segments.size() );
+   model.Generation = cppspice::getKernelGeneration();
+   model.Sources.swap( sources );
+   model.SourceOffsets.swap( plateOffsets );
+
+   /*
+   The model holds the segments' plates from now on, so release the copies
+   the segment cache had.
+   */
+   for ( auto& source : model.Sources ) {
+      auto& entry = cachedSegments.at( source );
+      std::vector<SpiceDouble>().swap( entry.Plates );
+      std::vector<SpiceInt>().swap( entry.PlateIDs );
+   }
+   model.LastUse = ++shapeCacheClock;
+   shapeCacheStatistics.ModelBuilds++;
+   trimShapeCache( &model );
+
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   model.BuildTime = elapsed.count();
+   return true;
+}
+
+/*
+This is a helper which resolves a handle to its model, rebuilding the model
+if the loaded kernels have changed.
+*/
+static ShapeModel* resolveShapeModel(
+   const cppspice::ShapeModelHandle handle ) {
+   if ( handle < 0 ||
+        handle >=
+           static_cast<cppspice::ShapeModelHandle>( shapeModels.size() ) )
+   {
+      std::cout << "Error: the shape model handle " << handle
+                << " is not valid." << std::endl;
+      return nullptr;
+   }
+
+   auto& model = shapeModels[handle];
+   if ( model.Generation != cppspice::getKernelGeneration() &&
+        !buildShapeModel( model ) )
+   {
+      return nullptr;
+   }
+   model.LastUse = ++shapeCacheClock;
+   return &model;
+}
+
+/*
+This is a helper which intersects a ray with a block of SHAPELANES plates.
+*/
+static inline void intersectPlates(
+   const SpiceDouble* block,
+   const SpiceDouble  vertex[3],
+   const SpiceDouble  direction[3],
+   const SpiceDouble  limit,
+   SpiceDouble        distances[] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble*  I   The plates' first vertices and edges.
+      SpiceDouble   I   The ray's vertex.
+      SpiceDouble   I   The ray's direction.
+      SpiceDouble   I   The farthest distance of interest.
+      SpiceDouble   O   The distances to the intercepts.
+
+   - Detailed_Input
+
+      block       9 * SHAPELANES doubles: the x, y and z of the plates'
+                  first vertices, then of the edges from them to the second
+                  vertices, then to the third, each for every lane in turn.
+      vertex      the vertex of the ray.
+      direction   the direction of the ray, which needn't be a unit vector.
+      limit       the largest distance, in multiples of direction, at which
+                  an intercept is of interest.
+
+   - Detailed_Output
+
+      distances   for each lane, the distance to the intercept, in
+                  multiples of direction, if the ray hits the plate at a
+                  distance between zero and limit, and -1 otherwise.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      This is the Moller-Trumbore test, written without branches so that
+   the compiler can run the lanes side by side in vector registers. Each
+   lane gives exactly the result the test would give on its own. A plate
+   whose edges are zero, as fills the end of a leaf's last block, is never
+   hit.
+
+      The plate is expanded by SHAPEEDGEMARGIN of its edges, so that a ray
+   through a shared edge or vertex can't slip between plates. Both sides of
+   a plate are hit, as with dskx02_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::SHAPEEDGEMARGIN;
+   using cppspice::SHAPELANES;
+
+   const SpiceDouble* x  = block;
+   const SpiceDouble* y  = block + SHAPELANES;
+   const SpiceDouble* z  = block + 2 * SHAPELANES;
+   const SpiceDouble* ax = block + 3 * SHAPELANES;
+   const SpiceDouble* ay = block + 4 * SHAPELANES;
+   const SpiceDouble* az = block + 5 * SHAPELANES;
+   const SpiceDouble* bx = block + 6 * SHAPELANES;
+   const SpiceDouble* by = block + 7 * SHAPELANES;
+   const SpiceDouble* bz = block + 8 * SHAPELANES;
+   for ( SpiceInt lane = 0; lane < SHAPELANES; lane++ ) {
+      SpiceDouble px = direction[1] * bz[lane] - direction[2] * by[lane];
+      SpiceDouble py = direction[2] * bx[lane] - direction[0] * bz[lane];
+      SpiceDouble pz = direction[0] * by[lane] - direction[1] * bx[lane];
+      SpiceDouble determinant = ax[lane] * px + ay[lane] * py + az[lane] * pz;
+      SpiceDouble inverse     = 1.0 / determinant;
+
+      SpiceDouble sx = vertex[0] - x[lane];
+      SpiceDouble sy = vertex[1] - y[lane];
+      SpiceDouble sz = vertex[2] - z[lane];
+      SpiceDouble u  = ( sx * px + sy * py + sz * pz ) * inverse;
+
+      SpiceDouble qx = sy * az[lane] - sz * ay[lane];
+      SpiceDouble qy = sz * ax[lane] - sx * az[lane];
+      SpiceDouble qz = sx * ay[lane] - sy * ax[lane];
+      SpiceDouble v  =
+         ( direction[0] * qx + direction[1] * qy + direction[2] * qz ) *
+         inverse;
+      SpiceDouble distance =
+         ( bx[lane] * qx + by[lane] * qy + bz[lane] * qz ) * inverse;
+
+      bool hit = ( determinant != 0.0 ) & ( u >= -SHAPEEDGEMARGIN ) &
+                 ( u <= 1.0 + SHAPEEDGEMARGIN ) &
+                 ( v >= -SHAPEEDGEMARGIN ) &
+                 ( u + v <= 1.0 + SHAPEEDGEMARGIN ) & ( distance >= 0.0 ) &
+                 ( distance <= limit );
+      distances[lane] = hit ? distance : -1.0;
+   }
+}
+
+/*
+This is a helper which traces a ray through a model's hierarchy.
+*/
+static bool traceShapeModel(
+   const ShapeModel&  model,
+   const SpiceDouble  vertex[3],
+   const SpiceDouble  direction[3],
+   const bool         anyHit,
+   SpiceDouble&       limit,
+   SpiceInt&          plate ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        I   The shape model.
+      SpiceDouble   I   The ray's vertex.
+      SpiceDouble   I   The ray's direction.
+      bool          I   Whether any intercept will do.
+      SpiceDouble  I/O  The distance to the intercept.
+      SpiceInt      O   The index of the plate which was hit.
+
+   - Detailed_Input
+
+      model       the shape model, which must be up to date.
+      vertex      the vertex of the ray.
+      direction   the direction of the ray, which needn't be a unit vector.
+      anyHit      true to stop at the first plate which is hit, rather than
+                  finding the nearest.
+      limit       the largest distance, in multiples of direction, at which
+                  an intercept is of interest.
+
+   - Detailed_Output
+
+      limit    the distance to the intercept, if there is one.
+      plate    the index of the plate which was hit, in the model's order.
+
+      The function returns true if the ray hits the model.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The nearer child of each node is visited first, judged by the sign of
+   the direction along the axis the node was split on, and the farther
+   child is skipped when the intercept found so far is nearer than its box.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+
+   /*
+   A zero component gets a huge, rather than infinite, inverse, so that a
+   ray along a box face gives zero instead of NaN.
+   */
+   SpiceDouble inverse[3];
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      inverse[k] = direction[k] != 0.0
+                      ? 1.0 / direction[k]
+                      : std::copysign( 1.0e300, direction[k] );
+   }
+   auto enters = [&]( const ShapeNode& node ) {
+      SpiceDouble nearest{ 0.0 };
+      SpiceDouble farthest = limit;
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         SpiceDouble a = ( node.Lower[k] - vertex[k] ) * inverse[k];
+         SpiceDouble b = ( node.Upper[k] - vertex[k] ) * inverse[k];
+         if ( inverse[k] < 0.0 ) {
+            std::swap( a, b );
+         }
+         nearest  = std::max( nearest, a );
+         farthest = std::min( farthest, b );
+      }
+      return nearest <= farthest;
+   };
+
+   const ShapeNode* nodes = model.Nodes.data();
+   if ( model.Nodes.empty() || !enters( nodes[0] ) ) {
+      return false;
+   }
+
+   /*
+   The tree which links the segments' hierarchies adds at most 32 levels.
+   */
+   SpiceInt stack[cppspice::SHAPEMAXDEPTH + 33];
+   SpiceInt depth{ 0 };
+   SpiceInt index{ 0 };
+   bool     found{ false };
+   while ( true ) {
+      const ShapeNode& node = nodes[index];
+      if ( node.Count > 0 ) {
+         for ( SpiceInt first = node.Start; first < node.Start + node.Count;
+               first += cppspice::SHAPELANES )
+         {
+            SpiceDouble distances[cppspice::SHAPELANES];
+            intersectPlates(
+               &model.Plates[9 * first],
+               vertex,
+               direction,
+               limit,
+               distances );
+            for ( SpiceInt lane = 0; lane < cppspice::SHAPELANES; lane++ ) {
+               if ( distances[lane] >= 0.0 && distances[lane] <= limit ) {
+                  limit = distances[lane];
+                  plate = first + lane;
+                  found = true;
+                  if ( anyHit ) {
+                     return true;
+                  }
+               }
+            }
+         }
+      }
+      else {
+         SpiceInt nearChild = index + 1;
+         SpiceInt farChild  = node.Start;
+         if ( direction[-1 - node.Count] < 0.0 ) {
+            std::swap( nearChild, farChild );
+         }
+         bool nearHit = enters( nodes[nearChild] );
+         bool farHit  = enters( nodes[farChild] );
+         if ( nearHit ) {
+            if ( farHit ) {
+               stack[depth++] = farChild;
+            }
+            index = nearChild;
+            continue;
+         }
+         if ( farHit ) {
+            index = farChild;
+            continue;
+         }
+      }
+
+      /*
+      Resume with the nearest deferred node which the ray still enters
+      within the intercept found so far.
+      */
+      do {
+         if ( depth == 0 ) {
+            return found;
+         }
+         index = stack[--depth];
+      } while ( !enters( nodes[index] ) );
+   }
+}
+
+/*
+This is a helper which fills in the silhouette of a model, as seen along
+one of the grid directions.
+*/
+static void buildSilhouetteTable(
+   const ShapeModel& model,
+   const SpiceInt    row,
+   const SpiceInt    column,
+   SilhouetteTable&  table ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      struct     I   The shape model.
+      SpiceInt   I   The latitude row of the grid direction.
+      SpiceInt   I   The longitude column of the grid direction.
+      struct     O   The silhouette.
+
+   - Detailed_Input
+
+      model    the shape model, which must be up to date.
+      row      the row of the direction, from 0 at the south to
+               SILHOUETTELATS - 1 at the north. The rows sit at the centers
+               of equal bands of latitude, so none of them is a pole.
+      column   the column of the direction, from 0 at zero longitude to
+               SILHOUETTELONS - 1.
+
+   - Detailed_Output
+
+      table    the direction, its east and north vectors, and the inner and
+   outer radii of the silhouette at each of SILHOUETTEANGLES position
+   angles, measured from east towards north.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      Each radius is found by casting rays along the direction. For the
+   outer radius, rays are cast inwards from the bounding radius in
+   SILHOUETTESTEPS steps until one hits the model, and for the inner
+   radius, outwards from the center until one misses. Each crossing is
+   then narrowed by SILHOUETTEBISECTIONS bisections, keeping the outer
+   radius on the clear side and the inner radius on the blocked side.
+
+      Between the two radii the silhouette may have notches, so only lines
+   of sight inside the inner radius or outside the outer one are settled
+   by the table. Features smaller than a step may still be missed.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::SILHOUETTEANGLES;
+   using cppspice::SILHOUETTEBISECTIONS;
+   using cppspice::SILHOUETTESTEPS;
+
+   SpiceDouble latitude = -cppspice::PI / 2.0 +
+                          ( row + 0.5 ) * cppspice::PI /
+                             cppspice::SILHOUETTELATS;
+   SpiceDouble longitude =
+      2.0 * cppspice::PI * column / cppspice::SILHOUETTELONS;
+   SpiceDouble pole[3] = { 0.0, 0.0, 1.0 };
+   latrec_c( 1.0, longitude, latitude, table.Direction );
+   ucrss_c( pole, table.Direction, table.East );
+   vcrss_c( table.Direction, table.East, table.North );
+
+   SpiceDouble bound = model.BoundingRadius;
+   SpiceDouble step  = bound / SILHOUETTESTEPS;
+   auto        isBlocked = [&]( SpiceDouble angle, SpiceDouble radius ) {
+      SpiceDouble vertex[3];
+      vlcom3_c(
+         radius * std::cos( angle ),
+         table.East,
+         radius * std::sin( angle ),
+         table.North,
+         -2.0 * bound,
+         table.Direction,
+         vertex );
+      SpiceDouble limit = 4.0 * bound;
+      SpiceInt    plate{ 0 };
+      return traceShapeModel(
+         model,
+         vertex,
+         table.Direction,
+         true,
+         limit,
+         plate );
+   };
+   auto narrow = [&]( SpiceDouble angle,
+                      SpiceDouble blocked,
+                      SpiceDouble clear,
+                      bool        keepClear ) {
+      for ( SpiceInt i = 0; i < SILHOUETTEBISECTIONS; i++ ) {
+         SpiceDouble middle = 0.5 * ( blocked + clear );
+         if ( isBlocked( angle, middle ) ) {
+            blocked = middle;
+         }
+         else {
+            clear = middle;
+         }
+      }
+      return keepClear ? clear : blocked;
+   };
+
+   table.Inner.assign( SILHOUETTEANGLES, 0.0 );
+   table.Outer.assign( SILHOUETTEANGLES, 0.0 );
+   for ( SpiceInt i = 0; i < SILHOUETTEANGLES; i++ ) {
+      SpiceDouble angle = 2.0 * cppspice::PI * i / SILHOUETTEANGLES;
+
+      SpiceInt outer = SILHOUETTESTEPS;
+      while ( outer >= 0 && !isBlocked( angle, outer * step ) ) {
+         outer--;
+      }
+      if ( outer < 0 ) {
+         continue;
+      }
+      table.Outer[i] =
+         narrow( angle, outer * step, ( outer + 1 ) * step, true );
+
+      if ( !isBlocked( angle, 0.0 ) ) {
+         continue;
+      }
+      SpiceInt inner = 1;
+      while ( inner <= outer && isBlocked( angle, inner * step ) ) {
+         inner++;
+      }
+      table.Inner[i] =
+         narrow( angle, ( inner - 1 ) * step, inner * step, false );
+   }
+   table.Nearest =
+      *std::min_element( table.Inner.begin(), table.Inner.end() );
+   table.Farthest =
+      *std::max_element( table.Outer.begin(), table.Outer.end() );
+}
+
+/*
+This is a helper which settles a cone of lines of sight from the
+silhouettes at the grid directions around it, if it can.
+*/
+static SpiceInt classifyLinesOfSight(
+   const SilhouetteTable* const tables[4],
+   const SpiceDouble            bound,
+   const SpiceDouble            observer[3],
+   const SpiceDouble            direction[3],
+   const SpiceDouble            halfAngle ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct        I   The silhouettes around the lines of sight.
+      SpiceDouble   I   The model's bounding radius (km).
+      SpiceDouble   I   The observer's position (km).
+      SpiceDouble   I   The direction of the cone's axis.
+      SpiceDouble   I   The cone's half angle (radians).
+
+   - Detailed_Input
+
+      tables      the silhouettes at four grid directions around the
+                  direction of the cone's axis.
+      bound       the model's bounding radius.
+      observer    the observer's position, relative to the body's center,
+                  in the model's frame. It must be outside of the bounding
+                  sphere.
+      direction   the direction of the cone's axis.
+      halfAngle   the half angle of the cone, which is zero for a single
+                  line of sight.
+
+   - Detailed_Output
+
+      Returns 1 if every line of sight in the cone is blocked, -1 if every
+   one is clear, and 0 if the cone comes too close to the silhouette to
+   tell.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      Seen along its axis, the cone crosses the body within a circle around
+   the part of the observer's position across the axis. That circle is
+   compared with each of the four silhouettes in turn, over the position
+   angles it spans, and the cone is only settled if all four agree by more
+   than a margin.
+
+      Tilting the view by an angle a moves every point of the body across
+   the line of sight by up to the bounding radius times sin(a), but the
+   limb moves much less, since it is where the surface turns away from the
+   view. The margin is the bounding radius times 1 - cos(a), where a is the
+   angle from the farthest of the grid directions to the farthest line of
+   sight in the cone, and is checked by benchmarkShapeModel.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::SILHOUETTEANGLES;
+
+   SpiceDouble axis[3];
+   vhat_c( direction, axis );
+   SpiceDouble along = vdot_c( observer, axis );
+   if ( along >= 0.0 ) {
+      return 0;
+   }
+   SpiceDouble offset[3];
+   vlcom_c( 1.0, observer, -along, axis, offset );
+   SpiceDouble width = ( bound - along ) * std::tan( halfAngle );
+
+   SpiceDouble closest{ 1.0 };
+   for ( SpiceInt k = 0; k < 4; k++ ) {
+      closest = std::min( closest, vdot_c( axis, tables[k]->Direction ) );
+   }
+   SpiceDouble tilt   = std::acos( std::max( -1.0, closest ) ) + halfAngle;
+   SpiceDouble margin = bound * ( 1.0 - std::cos( tilt ) );
+
+   SpiceInt verdict{ 0 };
+   for ( SpiceInt k = 0; k < 4; k++ ) {
+      const SilhouetteTable& table  = *tables[k];
+      SpiceDouble            east   = vdot_c( offset, table.East );
+      SpiceDouble            north  = vdot_c( offset, table.North );
+      SpiceDouble            radius = std::hypot( east, north );
+
+      /*
+      Find the bins of position angle which the circle spans, which are
+      all of them if it covers the center.
+      */
+      SpiceDouble outer = table.Farthest;
+      SpiceDouble inner = table.Nearest;
+      if ( radius > width ) {
+         SpiceDouble scale    = SILHOUETTEANGLES / ( 2.0 * cppspice::PI );
+         SpiceDouble position = std::atan2( north, east ) * scale;
+         SpiceDouble span     = std::asin( width / radius ) * scale;
+         if ( position < 0.0 ) {
+            position += SILHOUETTEANGLES;
+         }
+         SpiceInt first = static_cast<SpiceInt>( position - span + 1.0 ) - 1;
+         SpiceInt last  = static_cast<SpiceInt>( position + span ) + 1;
+         if ( last - first < SILHOUETTEANGLES ) {
+            outer = 0.0;
+            inner = HUGE_VAL;
+            SpiceInt bin =
+               first < 0 ? first + SILHOUETTEANGLES : first;
+            for ( SpiceInt i = first; i <= last; i++ ) {
+               outer = std::max( outer, table.Outer[bin] );
+               inner = std::min( inner, table.Inner[bin] );
+               bin   = bin + 1 < SILHOUETTEANGLES ? bin + 1 : 0;
+            }
+         }
+      }
+
+      SpiceInt vote{ 0 };
+      if ( radius - width > outer + margin ) {
+         vote = -1;
+      }
+      else if ( radius + width < inner - margin ) {
+         vote = 1;
+      }
+      if ( vote == 0 || ( k > 0 && vote != verdict ) ) {
+         return 0;
+      }
+      verdict = vote;
+   }
+   return verdict;
+}
+
+/*
+This is a helper which finds the silhouettes at the grid directions around
+a view direction, building any which are missing.
+*/
+static void selectSilhouettes(
+   ShapeModel&            model,
+   const SpiceDouble      view[3],
+   const SilhouetteTable* tables[4] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      struct       I/O  The shape model.
+      SpiceDouble   I   The view direction.
+      struct        O   The silhouettes around the view direction.
+
+   - Detailed_Input
+
+      model    the shape model, which must be up to date.
+      view     the direction from the observer to the body's center, in the
+               model's frame.
+
+   - Detailed_Output
+
+      model    with the silhouettes which were needed built.
+      tables   the silhouettes at the two rows and columns of the grid
+               which surround the view direction. Beyond the outermost
+               rows, the outermost row is used twice.
+
+   - Error Handling
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::SILHOUETTELATS;
+   using cppspice::SILHOUETTELONS;
+
+   SpiceDouble radius{ 0.0 };
+   SpiceDouble longitude{ 0.0 };
+   SpiceDouble latitude{ 0.0 };
+   reclat_c( view, &radius, &longitude, &latitude );
+   SpiceDouble row =
+      ( latitude + cppspice::PI / 2.0 ) / cppspice::PI * SILHOUETTELATS -
+      0.5;
+   SpiceDouble column = longitude / ( 2.0 * cppspice::PI ) * SILHOUETTELONS;
+   if ( column < 0.0 ) {
+      column += SILHOUETTELONS;
+   }
+   SpiceInt rows[2];
+   rows[0] = std::min(
+      static_cast<SpiceInt>( std::max( 0.0, std::floor( row ) ) ),
+      SILHOUETTELATS - 1 );
+   rows[1] =
+      row < 0.0 ? rows[0] : std::min( rows[0] + 1, SILHOUETTELATS - 1 );
+   SpiceInt columns[2];
+   columns[0] =
+      std::min( static_cast<SpiceInt>( column ), SILHOUETTELONS - 1 );
+   columns[1] = ( columns[0] + 1 ) % SILHOUETTELONS;
+
+   for ( SpiceInt k = 0; k < 4; k++ ) {
+      SilhouetteTable& table =
+         model.Silhouettes[rows[k / 2] * SILHOUETTELONS + columns[k % 2]];
+      if ( table.Outer.empty() ) {
+         buildSilhouetteTable( model, rows[k / 2], columns[k % 2], table );
+      }
+      tables[k] = &table;
+   }
+}
+
+/*
+This is a helper which times getBlockedFraction with and without the
+silhouette cache, for targets which straddle a model's limb.
+*/
+static void benchmarkSilhouetteCache(
+   const cppspice::ShapeModelHandle handle,
+   const SpiceInt                   evaluations ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      handle     I   The shape model.
+      SpiceInt   I   The number of geometries to evaluate.
+
+   - Detailed_Input
+
+      handle         a handle returned by getShapeModel.
+      evaluations    the number of geometries. The observers are between 20
+                     and 200 bounding radii from the body, and each target
+                     appears between half and twice as large as the body,
+                     placed so that its disk is partly or wholly covered, or
+                     just clear.
+
+   - Detailed_Output
+
+      None. The time taken to build the silhouettes, the time per
+   evaluation with and without the cache, and the number of evaluations on
+   which the two differ are reported.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::PI;
+
+   unsigned long long seed   = 2463534242ULL;
+   auto               random = [&seed]() {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      return static_cast<SpiceDouble>( seed >> 11 ) / 9007199254740992.0;
+   };
+
+   SpiceDouble              bound = shapeModels[handle].BoundingRadius;
+   std::vector<SpiceDouble> observers( 3 * evaluations );
+   std::vector<SpiceDouble> targets( 3 * evaluations );
+   std::vector<SpiceDouble> radii( evaluations );
+   for ( SpiceInt i = 0; i < evaluations; i++ ) {
+      SpiceDouble* observer = &observers[3 * i];
+      SpiceDouble  range    = bound * ( 20.0 + 180.0 * random() );
+      latrec_c(
+         range,
+         2.0 * PI * random(),
+         std::asin( 2.0 * random() - 1.0 ),
+         observer );
+
+      SpiceDouble view[3];
+      SpiceDouble across[2][3];
+      vscl_c( -1.0 / range, observer, view );
+      frame_c( view, across[0], across[1] );
+      SpiceDouble bodyAngle   = std::asin( bound / range );
+      SpiceDouble targetAngle = bodyAngle * ( 0.1 + 1.9 * random() );
+      SpiceDouble separation =
+         ( bodyAngle + targetAngle ) * 1.05 * random();
+      SpiceDouble turn = 2.0 * PI * random();
+      SpiceDouble toward[3];
+      vlcom3_c(
+         std::cos( separation ),
+         view,
+         std::sin( separation ) * std::cos( turn ),
+         across[0],
+         std::sin( separation ) * std::sin( turn ),
+         across[1],
+         toward );
+      SpiceDouble distance = range * ( 2.0 + 8.0 * random() );
+      vlcom_c( 1.0, observer, distance, toward, &targets[3 * i] );
+      radii[i] = distance * std::sin( targetAngle );
+   }
+
+   std::vector<SpiceDouble> exact( evaluations );
+   std::vector<SpiceDouble> cached( evaluations );
+   auto                     evaluate = [&]( std::vector<SpiceDouble>& out ) {
+      auto start = std::chrono::steady_clock::now();
+      for ( SpiceInt i = 0; i < evaluations; i++ ) {
+         cppspice::getBlockedFraction(
+            handle,
+            &observers[3 * i],
+            &targets[3 * i],
+            radii[i],
+            out[i] );
+      }
+      std::chrono::duration<double, std::micro> elapsed =
+         std::chrono::steady_clock::now() - start;
+      return elapsed.count() / evaluations;
+   };
+
+   /*
+   The first pass with the cache builds the silhouettes. After that, the
+   two are alternated and the best of three passes is kept for each.
+   */
+   cppspice::setSilhouetteCache( true );
+   double firstTime  = evaluate( cached );
+   double exactTime  = HUGE_VAL;
+   double cachedTime = HUGE_VAL;
+   for ( SpiceInt pass = 0; pass < 3; pass++ ) {
+      cppspice::setSilhouetteCache( false );
+      exactTime = std::min( exactTime, evaluate( exact ) );
+      cppspice::setSilhouetteCache( true );
+      cachedTime = std::min( cachedTime, evaluate( cached ) );
+   }
+
+   SpiceInt tables{ 0 };
+   for ( auto& table : shapeModels[handle].Silhouettes ) {
+      tables += table.Outer.empty() ? 0 : 1;
+   }
+   SpiceInt mismatches{ 0 };
+   for ( SpiceInt i = 0; i < evaluations; i++ ) {
+      mismatches += exact[i] != cached[i] ? 1 : 0;
+   }
+
+   std::cout << "   Silhouette cache over " << evaluations
+             << " targets near the limb (" << tables
+             << " silhouettes built, "
+             << ( firstTime - cachedTime ) * evaluations / 1.0e6 << " s):"
+             << std::endl;
+   std::cout << "      exact:  " << exactTime << " us per target"
+             << std::endl;
+   std::cout << "      cached: " << cachedTime << " us per target, "
+             << mismatches << " differ" << std::endl;
+}
+
+/*
+This function resolves a body to its shape model.
+*/
+cppspice::ShapeModelHandle cppspice::getShapeModel(
+   const std::string& bodyName ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the body.
+
+   - Detailed_Input
+
+      bodyName    the name or NAIF ID of the body.
+
+   - Detailed_Output
+
+      Returns a handle which can be used with the other functions here, or
+   -1 if the body can't be resolved or has no DSK type 2 segments loaded.
+   Resolving the same body twice returns the same handle.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and -1 is returned.
+
+   - Particulars
+
+      The model is built on the first request, which reads every plate of
+   the body and may take a second or more for a large model. Later requests
+   only rebuild it if its segments have changed, or if it was evicted from
+   the cache, in which case the plates of segments which are still cached
+   aren't read again.
+
+   - Literature_References
+
+      CSPICE's documentation for dskx02_c and the DSK required reading.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      Models are only rebuilt when kernels are loaded or unloaded through
+   furnishKernel and unloadKernel, or when a pool snapshot is restored.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt     bodyID{ 0 };
+   SpiceBoolean found{ false };
+   bods2c_c( bodyName.c_str(), &bodyID, &found );
+   if ( !found ) {
+      std::cout << "Error: the body '" << bodyName
+                << "' could not be resolved." << std::endl;
+      return -1;
+   }
+
+   auto existing = shapeModelIndex.find( bodyID );
+   if ( existing != shapeModelIndex.end() ) {
+      return resolveShapeModel( existing->second ) != nullptr
+                ? existing->second
+                : -1;
+   }
+
+   /*
+   The model is added before it is built, so that the cache counts its
+   plates when it is trimmed.
+   */
+   shapeModels.emplace_back();
+   shapeModels.back().BodyID     = bodyID;
+   shapeModels.back().Generation = -1;
+   if ( !buildShapeModel( shapeModels.back() ) ) {
+      shapeModels.pop_back();
+      return -1;
+   }
+
+   auto handle = static_cast<ShapeModelHandle>( shapeModels.size() - 1 );
+   shapeModelIndex[bodyID] = handle;
+   return handle;
+}
+
+/*
+This function describes a shape model.
+*/
+bool cppspice::getShapeSummary(
+   const ShapeModelHandle handle,
+   ShapeSummary&          summary ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      handle     I   The shape model.
+      struct     O   The description of the model.
+
+   - Detailed_Input
+
+      handle   a handle returned by getShapeModel.
+
+   - Detailed_Output
+
+      summary  the model's frame, the number of segments, plates and nodes
+   it was built from, the radius of the sphere about the body's center which
+   contains it (km), and the time taken to build it (seconds).
+
+      The function returns true if the handle is valid.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   const ShapeModel* model = resolveShapeModel( handle );
+   if ( model == nullptr ) {
+      return false;
+   }
+
+   summary.Frame          = model->Frame;
+   summary.Segments       = model->Segments;
+   summary.Plates         = model->PlateCount;
+   summary.Nodes          = static_cast<SpiceInt>( model->Nodes.size() );
+   summary.BoundingRadius = model->BoundingRadius;
+   summary.BuildTime      = model->BuildTime;
+   return true;
+}
+
+/*
+This function finds the nearest intercept of a ray with a shape model.
+*/
+bool cppspice::getRayIntercept(
+   const ShapeModelHandle handle,
+   const SpiceDouble      vertex[3],
+   const SpiceDouble      direction[3],
+   SpiceInt&              plateID,
+   SpiceDouble            point[3],
+   SpiceBoolean&          found ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The shape model.
+      SpiceDouble   I   The ray's vertex (km).
+      SpiceDouble   I   The ray's direction.
+      SpiceInt      O   The ID of the plate which was hit.
+      SpiceDouble   O   The intercept (km).
+      SpiceBoolean  O   Whether the ray hits the model.
+
+   - Detailed_Input
+
+      handle      a handle returned by getShapeModel.
+      vertex      the vertex of the ray, relative to the body's center, in
+                  the model's frame.
+      direction   the direction of the ray, in the model's frame.
+
+   - Detailed_Output
+
+      plateID  the ID of the plate which was hit, within its segment.
+      point    the intercept, relative to the body's center, in the
+               model's frame.
+      found    true if the ray hits the model, in which case plateID and
+               point are set.
+
+      The function returns true if the handle is valid.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Where the ray passes through an edge or vertex shared by several
+   plates, any of them may be reported, so the plate may differ from that
+   of dskx02_c while the intercept agrees.
+
+   - Literature_References
+
+      CSPICE's documentation for dskx02_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   const ShapeModel* model = resolveShapeModel( handle );
+   if ( model == nullptr ) {
+      return false;
+   }
+
+   SpiceDouble distance = HUGE_VAL;
+   SpiceInt    plate{ 0 };
+   found =
+      traceShapeModel( *model, vertex, direction, false, distance, plate )
+         ? SPICETRUE
+         : SPICEFALSE;
+   if ( found ) {
+      plateID = model->PlateIDs[plate];
+      vlcom_c( 1.0, vertex, distance, direction, point );
+   }
+   return true;
+}
+
+/*
+This function determines whether a ray hits a shape model within an extent.
+*/
+bool cppspice::isRayBlocked(
+   const ShapeModelHandle handle,
+   const SpiceDouble      vertex[3],
+   const SpiceDouble      direction[3],
+   const SpiceDouble      extent,
+   SpiceBoolean&          blocked ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The shape model.
+      SpiceDouble   I   The ray's vertex (km).
+      SpiceDouble   I   The ray's direction.
+      SpiceDouble   I   The extent of the ray, in multiples of direction.
+      SpiceBoolean  O   Whether the ray hits the model within its extent.
+
+   - Detailed_Input
+
+      handle      a handle returned by getShapeModel.
+      vertex      the vertex of the ray, relative to the body's center, in
+                  the model's frame.
+      direction   the direction of the ray, in the model's frame.
+      extent      how far along the ray to look, so that a segment from
+                  vertex to point is tested by passing point - vertex and 1.
+
+   - Detailed_Output
+
+      blocked  true if the ray hits a plate between its vertex and extent.
+
+      The function returns true if the handle is valid.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   const ShapeModel* model = resolveShapeModel( handle );
+   if ( model == nullptr ) {
+      return false;
+   }
+
+   SpiceDouble limit = extent;
+   SpiceInt    plate{ 0 };
+   blocked = traceShapeModel( *model, vertex, direction, true, limit, plate )
+                ? SPICETRUE
+                : SPICEFALSE;
+   return true;
+}
+
+/*
+This function finds the nearest intercepts of an array of rays with a
+shape model.
+*/
+bool cppspice::getRayIntercepts(
+   const ShapeModelHandle handle,
+   const SpiceInt         count,
+   const SpiceDouble      vertices[][3],
+   const SpiceDouble      directions[][3],
+   SpiceInt               plateIDs[],
+   SpiceDouble            points[][3],
+   SpiceBoolean           found[] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The shape model.
+      SpiceInt      I   The number of rays.
+      SpiceDouble   I   The rays' vertices (km).
+      SpiceDouble   I   The rays' directions.
+      SpiceInt      O   The IDs of the plates which were hit.
+      SpiceDouble   O   The intercepts (km).
+      SpiceBoolean  O   Whether each ray hits the model.
+
+   - Detailed_Input
+
+      handle         a handle returned by getShapeModel.
+      count          the number of rays.
+      vertices       the vertices of the rays, relative to the body's
+                     center, in the model's frame.
+      directions     the directions of the rays, in the model's frame.
+
+   - Detailed_Output
+
+      plateIDs    for each ray which hits the model, the ID of the plate
+                  which was hit, within its segment.
+      points      for each ray which hits the model, the intercept,
+                  relative to the body's center, in the model's frame.
+      found       true for each ray which hits the model.
+
+      The function returns true if the handle is valid.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      This is the array form of getRayIntercept, as dskxv_c is of dskx02_c,
+   and each ray gives exactly the result getRayIntercept would give for it.
+   The model is resolved once, and the rays are then split into contiguous
+   runs, each cast on its own thread. The threads only read the model,
+   which no two of them write, and call no CSPICE routines, so they share
+   its plates and hierarchy without locking.
+
+   - Literature_References
+
+      CSPICE's documentation for dskxv_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Restrictions
+
+      Kernels must not be loaded or unloaded, and the model must not be
+   resolved, on other threads while the rays are being cast.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   const ShapeModel* model = resolveShapeModel( handle );
+   if ( model == nullptr ) {
+      return false;
+   }
+   if ( count < 0 ) {
+      std::cout << "Error: the number of rays, " << count
+                << ", is negative." << std::endl;
+      return false;
+   }
+
+   auto castRun = [&]( const SpiceInt first, const SpiceInt last ) {
+      for ( SpiceInt i = first; i < last; i++ ) {
+         SpiceDouble distance = HUGE_VAL;
+         SpiceInt    plate{ 0 };
+         found[i] = traceShapeModel(
+                       *model,
+                       vertices[i],
+                       directions[i],
+                       false,
+                       distance,
+                       plate )
+                       ? SPICETRUE
+                       : SPICEFALSE;
+         if ( found[i] ) {
+            plateIDs[i] = model->PlateIDs[plate];
+            for ( SpiceInt k = 0; k < 3; k++ ) {
+               points[i][k] = vertices[i][k] + distance * directions[i][k];
+            }
+         }
+      }
+   };
+
+   SpiceInt threads = shapeThreads;
+   if ( threads <= 0 ) {
+      threads = std::min(
+         static_cast<SpiceInt>( std::thread::hardware_concurrency() ),
+         MAXSHAPETHREADS );
+   }
+   threads = std::max(
+      static_cast<SpiceInt>( 1 ),
+      std::min( threads, count / SHAPERAYCHUNK ) );
+
+   /*
+   The first run is cast on this thread while the others are cast on their
+   own.
+   */
+   std::vector<std::thread> workers;
+   for ( SpiceInt piece = 1; piece < threads; piece++ ) {
+      workers.emplace_back(
+         castRun,
+         static_cast<SpiceInt>(
+            static_cast<long long>( count ) * piece / threads ),
+         static_cast<SpiceInt>(
+            static_cast<long long>( count ) * ( piece + 1 ) / threads ) );
+   }
+   castRun( 0, static_cast<SpiceInt>( count / threads ) );
+   for ( auto& worker : workers ) {
+      worker.join();
+   }
+   return true;
+}
+
+/*
+This function estimates the fraction of a target's disk which a shape model
+covers.
+*/
+bool cppspice::getBlockedFraction(
+   const ShapeModelHandle handle,
+   const SpiceDouble      observer[3],
+   const SpiceDouble      targetCenter[3],
+   const SpiceDouble      targetRadius,
+   SpiceDouble&           fraction ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      handle        I   The shape model.
+      SpiceDouble   I   The observer's position (km).
+      SpiceDouble   I   The target's center (km).
+      SpiceDouble   I   The target's radius (km).
+      SpiceDouble   O   The fraction of the samples which are blocked.
+
+   - Detailed_Input
+
+      handle         a handle returned by getShapeModel.
+      observer       the observer's position, relative to the body's center,
+                     in the model's frame.
+      targetCenter   the target's center, relative to the body's center, in
+                     the model's frame.
+      targetRadius   the radius of the sphere which represents the target.
+
+   - Detailed_Output
+
+      fraction    the fraction of the sample points on the target's disk
+   whose line of sight from the observer hits the model, between 0 and 1.
+
+      The function returns true if the handle is valid and the observer is
+   outside of the target.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The disk is the circle along which the lines of sight graze the
+   target's sphere, so that its outermost ring of samples lies on the
+   target's limb. The samples on each ring are offset by half a spoke from
+   the ring inside it.
+
+      No rays are cast when the body's bounding sphere is disjoint from the
+   target's disk as seen by the observer, or lies entirely beyond it. When
+   the silhouette cache is enabled and the body lies entirely in front of
+   the target's disk, at more than twice its bounding radius from the
+   observer, only the lines of sight which the cache can't settle are cast.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ShapeModel* model = resolveShapeModel( handle );
+   if ( model == nullptr ) {
+      return false;
+   }
+
+   SpiceDouble lineOfSight[3];
+   vsub_c( targetCenter, observer, lineOfSight );
+   SpiceDouble distance = vnorm_c( lineOfSight );
+   if ( distance <= targetRadius ) {
+      std::cout << "Error: observer is within the target's radius."
+                << std::endl;
+      return false;
+   }
+
+   /*
+   Check the bounding sphere first. An observer inside it could be looking
+   in any direction, so it always gets the rays.
+   */
+   fraction                 = 0.0;
+   SpiceDouble bodyDistance = vnorm_c( observer );
+   if ( bodyDistance > model->BoundingRadius ) {
+      if ( bodyDistance - model->BoundingRadius >= distance ) {
+         return true;
+      }
+      SpiceDouble toBody[3];
+      vminus_c( observer, toBody );
+      if ( vsep_c( lineOfSight, toBody ) >=
+           asin( model->BoundingRadius / bodyDistance ) +
+              asin( targetRadius / distance ) )
+      {
+         return true;
+      }
+   }
+
+   /*
+   Lay out the limb circle, with two unit vectors across the line of sight.
+   */
+   SpiceDouble ratio = targetRadius / distance;
+   SpiceDouble diskCenter[3];
+   vlcom_c( 1.0, observer, 1.0 - ratio * ratio, lineOfSight, diskCenter );
+   SpiceDouble diskRadius = targetRadius * std::sqrt( 1.0 - ratio * ratio );
+   SpiceDouble axis[3];
+   SpiceDouble across[2][3];
+   vequ_c( lineOfSight, axis );
+   frame_c( axis, across[0], across[1] );
+
+   /*
+   If the whole body lies well in front of the target, most lines of sight
+   can be settled from the silhouettes around the view direction, and only
+   those which pass close to the limb need to be cast.
+   */
+   const SilhouetteTable* tables[4];
+   bool                   useSilhouettes =
+      silhouetteCache &&
+      bodyDistance > 2.0 * model->BoundingRadius &&
+      bodyDistance + model->BoundingRadius <
+         distance * ( 1.0 - ratio * ratio );
+   if ( useSilhouettes ) {
+      SpiceDouble view[3];
+      vminus_c( observer, view );
+      selectSilhouettes( *model, view, tables );
+
+      /*
+      The whole disk may be settled at once, in which case no lines of
+      sight are needed.
+      */
+      SpiceInt verdict = classifyLinesOfSight(
+         tables,
+         model->BoundingRadius,
+         observer,
+         lineOfSight,
+         asin( ratio ) );
+      if ( verdict != 0 ) {
+         fraction = verdict > 0 ? 1.0 : 0.0;
+         return true;
+      }
+   }
+
+   SpiceInt blocked{ 0 };
+   SpiceInt samples{ 0 };
+   auto     sample = [&]( const SpiceDouble point[3] ) {
+      SpiceDouble direction[3];
+      vsub_c( point, observer, direction );
+      SpiceDouble limit = 1.0;
+      SpiceInt    plate{ 0 };
+      if ( traceShapeModel(
+              *model,
+              observer,
+              direction,
+              true,
+              limit,
+              plate ) )
+      {
+         blocked++;
+      }
+      samples++;
+   };
+
+   sample( diskCenter );
+   for ( SpiceInt ring = 1; ring <= SHAPERINGS; ring++ ) {
+      SpiceDouble radius = diskRadius * ring / SHAPERINGS;
+      for ( SpiceInt spoke = 0; spoke < SHAPESPOKES; spoke++ ) {
+         SpiceDouble angle = 2.0 * PI * ( spoke + 0.5 * ( ring % 2 ) ) /
+                             SHAPESPOKES;
+         SpiceDouble point[3];
+         vlcom3_c(
+            1.0,
+            diskCenter,
+            radius * std::cos( angle ),
+            across[0],
+            radius * std::sin( angle ),
+            across[1],
+            point );
+         sample( point );
+      }
+   }
+
+   fraction = static_cast<SpiceDouble>( blocked ) / samples;
+   return true;
+}
+
+/*
+This function enables or disables the silhouette cache.
+*/
+void cppspice::setSilhouetteCache( const bool enabled ) {
+   silhouetteCache = enabled;
+}
+
+/*
+This function sets the capacity of the shape cache.
+*/
+void cppspice::setShapeCacheSize( const SpiceInt plates ) {
+   shapeCacheSize = std::max( static_cast<SpiceInt>( 0 ), plates );
+   trimShapeCache( nullptr );
+}
+
+/*
+This function sets the number of threads arrays of rays may be cast on.
+*/
+void cppspice::setShapeThreads( const SpiceInt threads ) {
+   shapeThreads = std::max( static_cast<SpiceInt>( 0 ), threads );
+}
+
+/*
+This function chooses whether segments are read through a mapping.
+*/
+void cppspice::setMappedShapeReads( const bool enabled ) {
+   mappedShapeReads = enabled;
+}
+
+/*
+This function returns the counters of the shape cache.
+*/
+const cppspice::ShapeCacheStatistics& cppspice::getShapeCacheStatistics() {
+   return shapeCacheStatistics;
+}
+
+/*
+This function times dskx02_c against a body's shape model.
+*/
+void cppspice::benchmarkShapeModel(
+   const std::string& bodyName,
+   const SpiceInt     rays ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the body.
+      SpiceInt   I   The number of rays to cast.
+
+   - Detailed_Input
+
+      bodyName    the name or NAIF ID of a body with DSK type 2 segments.
+      rays        the number of rays to cast. Their vertices lie on a sphere
+                  of twice the model's bounding radius, and they are aimed
+                  at points drawn from within the bounding sphere, so most
+                  of them hit.
+
+   - Detailed_Output
+
+      None. The time taken to build the model and the rays per second of
+   dskx02_c and of the hierarchy are reported, along with the number of
+   rays on which the two agree and the largest distance between their
+   intercepts.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and nothing is timed.
+
+   - Particulars
+
+      When the body has several segments, dskx02_c is called for each of
+   them and the nearest intercept is kept, which is how the hierarchy
+   treats them.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ShapeModelHandle handle = getShapeModel( bodyName );
+   ShapeSummary     summary;
+   if ( handle < 0 || !getShapeSummary( handle, summary ) || rays <= 0 ) {
+      return;
+   }
+   std::vector<ShapeSegment> segments;
+   if ( !findShapeSegments( shapeModels[handle].BodyID, segments ) ) {
+      return;
+   }
+
+   /*
+   Draw the rays from a fixed pseudorandom sequence.
+   */
+   unsigned long long seed   = 88172645463325252ULL;
+   auto               random = [&seed]() {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      return static_cast<SpiceDouble>( seed >> 11 ) / 9007199254740992.0;
+   };
+   auto randomUnit = [&random]( SpiceDouble unit[3] ) {
+      SpiceDouble z     = 2.0 * random() - 1.0;
+      SpiceDouble angle = 2.0 * PI * random();
+      SpiceDouble r     = std::sqrt( 1.0 - z * z );
+      unit[0]           = r * std::cos( angle );
+      unit[1]           = r * std::sin( angle );
+      unit[2]           = z;
+   };
+   std::vector<SpiceDouble> vertices( 3 * rays );
+   std::vector<SpiceDouble> directions( 3 * rays );
+   for ( SpiceInt i = 0; i < rays; i++ ) {
+      SpiceDouble aim[3];
+      randomUnit( &vertices[3 * i] );
+      vscl_c(
+         2.0 * summary.BoundingRadius,
+         &vertices[3 * i],
+         &vertices[3 * i] );
+      randomUnit( aim );
+      vscl_c( summary.BoundingRadius * std::cbrt( random() ), aim, aim );
+      vsub_c( aim, &vertices[3 * i], &directions[3 * i] );
+   }
+
+   auto elapsed = []( std::chrono::steady_clock::time_point start ) {
+      return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start )
+         .count();
+   };
+
+   std::vector<SpiceBoolean> expectedFound( rays );
+   std::vector<SpiceInt>     expectedPlates( rays );
+   std::vector<SpiceDouble>  expectedPoints( 3 * rays );
+   auto                      start = std::chrono::steady_clock::now();
+   for ( SpiceInt i = 0; i < rays; i++ ) {
+      SpiceDouble nearest = HUGE_VAL;
+      expectedFound[i]    = SPICEFALSE;
+      for ( auto& segment : segments ) {
+         SpiceInt     plateID{ 0 };
+         SpiceDouble  point[3];
+         SpiceBoolean found{ SPICEFALSE };
+         dskx02_c(
+            segment.Handle,
+            &segment.Descriptor,
+            &vertices[3 * i],
+            &directions[3 * i],
+            &plateID,
+            point,
+            &found );
+         SpiceDouble range = vdist_c( point, &vertices[3 * i] );
+         if ( found && range < nearest ) {
+            nearest           = range;
+            expectedFound[i]  = SPICETRUE;
+            expectedPlates[i] = plateID;
+            vequ_c( point, &expectedPoints[3 * i] );
+         }
+      }
+   }
+   double cspiceTime = elapsed( start );
+   if ( failed_c() ) {
+      return;
+   }
+
+   std::vector<SpiceBoolean> foundRays( rays );
+   std::vector<SpiceInt>     plates( rays );
+   std::vector<SpiceDouble>  points( 3 * rays );
+   start = std::chrono::steady_clock::now();
+   for ( SpiceInt i = 0; i < rays; i++ ) {
+      getRayIntercept(
+         handle,
+         &vertices[3 * i],
+         &directions[3 * i],
+         plates[i],
+         &points[3 * i],
+         foundRays[i] );
+   }
+   double hierarchyTime = elapsed( start );
+
+   SpiceInt    hits{ 0 };
+   SpiceInt    foundAgreements{ 0 };
+   SpiceInt    plateAgreements{ 0 };
+   SpiceDouble maxDistance{ 0.0 };
+   for ( SpiceInt i = 0; i < rays; i++ ) {
+      hits += expectedFound[i] ? 1 : 0;
+      if ( foundRays[i] != expectedFound[i] ) {
+         continue;
+      }
+      foundAgreements++;
+      if ( expectedFound[i] ) {
+         plateAgreements += plates[i] == expectedPlates[i] ? 1 : 0;
+         maxDistance = std::max(
+            maxDistance,
+            vdist_c( &points[3 * i], &expectedPoints[3 * i] ) );
+      }
+   }
+
+   std::cout << "Shape model benchmark for " << bodyName << " over "
+             << rays << " rays (" << hits << " hits):" << std::endl;
+   std::cout << "   Model: " << summary.Plates << " plates in "
+             << summary.Segments << " segments, " << summary.Nodes
+             << " nodes, built in " << summary.BuildTime << " s"
+             << std::endl;
+   std::cout << "   dskx02_c:        " << rays / cspiceTime << " rays per s"
+             << std::endl;
+   std::cout << "   getRayIntercept: " << rays / hierarchyTime
+             << " rays per s" << std::endl;
+   std::cout << "   Agreement: " << foundAgreements << " found, "
+             << plateAgreements << " plates, largest intercept difference "
+             << maxDistance << " km" << std::endl;
+
+   /*
+   Cast the rays as one array with dskxv_c, which treats the segments as
+   unprioritized, and with getRayIntercepts on an increasing number of
+   threads. Each thread count must match getRayIntercept exactly.
+   */
+   using RayArray = SpiceDouble( * )[3];
+   auto rayArray  = []( std::vector<SpiceDouble>& values ) {
+      return reinterpret_cast<RayArray>( values.data() );
+   };
+   std::vector<SpiceBoolean> arrayFound( rays );
+   std::vector<SpiceDouble>  arrayPoints( 3 * rays );
+   SpiceInt                  surfaces[1] = { 0 };
+
+   start = std::chrono::steady_clock::now();
+   dskxv_c(
+      SPICEFALSE,
+      bodyName.c_str(),
+      0,
+      surfaces,
+      0.0,
+      summary.Frame.c_str(),
+      rays,
+      rayArray( vertices ),
+      rayArray( directions ),
+      rayArray( arrayPoints ),
+      arrayFound.data() );
+   double vectorTime = elapsed( start );
+   if ( failed_c() ) {
+      return;
+   }
+   SpiceInt    vectorAgreements{ 0 };
+   SpiceDouble vectorDistance{ 0.0 };
+   for ( SpiceInt i = 0; i < rays; i++ ) {
+      if ( arrayFound[i] != foundRays[i] ) {
+         continue;
+      }
+      vectorAgreements++;
+      if ( foundRays[i] ) {
+         vectorDistance = std::max(
+            vectorDistance,
+            vdist_c( &points[3 * i], &arrayPoints[3 * i] ) );
+      }
+   }
+   std::cout << "   dskxv_c:         " << rays / vectorTime
+             << " rays per s, " << vectorAgreements
+             << " found agree, largest intercept difference "
+             << vectorDistance << " km" << std::endl;
+
+   std::vector<SpiceInt> arrayPlates( rays );
+   SpiceInt              configuredThreads = shapeThreads;
+   for ( SpiceInt threads = 1; threads <= MAXSHAPETHREADS; threads *= 2 ) {
+      setShapeThreads( threads );
+      start = std::chrono::steady_clock::now();
+      getRayIntercepts(
+         handle,
+         rays,
+         rayArray( vertices ),
+         rayArray( directions ),
+         arrayPlates.data(),
+         rayArray( arrayPoints ),
+         arrayFound.data() );
+      double arrayTime = elapsed( start );
+
+      bool identical = arrayFound == foundRays;
+      for ( SpiceInt i = 0; i < rays && identical; i++ ) {
+         identical = !foundRays[i] ||
+                     ( arrayPlates[i] == plates[i] &&
+                       std::equal(
+                          &points[3 * i],
+                          &points[3 * i + 3],
+                          &arrayPoints[3 * i] ) );
+      }
+      std::cout << "   getRayIntercepts (" << threads
+                << ( threads == 1 ? " thread): " : " threads): " )
+                << rays / arrayTime << " rays per s"
+                << ( identical ? ", identical" : ", MISMATCH" ) << std::endl;
+   }
+   setShapeThreads( configuredThreads );
+
+   benchmarkSilhouetteCache( handle, std::max( rays / 100, 1 ) );
+}
+
+/*
+This function times the rebuilding of a body's shape model with and without
+the shape cache, as its DSKs are unloaded and loaded again.
+*/
+void cppspice::benchmarkShapeCache(
+   const std::string& bodyName,
+   const SpiceInt     rounds ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the body.
+      SpiceInt   I   The number of rounds.
+
+   - Detailed_Input
+
+      bodyName    the name or NAIF ID of a body with DSK type 2 segments.
+      rounds      the number of times each of the body's DSKs is unloaded
+                  and loaded again.
+
+   - Detailed_Output
+
+      None. The time per round, and the segments read, models built and
+   models kept, are reported with the cache disabled and at its configured
+   capacity.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and nothing is timed.
+
+   - Particulars
+
+      In each round, each DSK holding the body's segments is unloaded and
+   loaded again, and a ray is cast at the model after each change. When
+   the body's segments are spread over several DSKs, as with a tiled shape,
+   the model is also resolved while one of them is unloaded, so that it is
+   rebuilt from the remaining tiles.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ShapeModelHandle handle = getShapeModel( bodyName );
+   ShapeSummary     summary;
+   if ( handle < 0 || !getShapeSummary( handle, summary ) || rounds <= 0 ) {
+      return;
+   }
+   std::vector<ShapeSegment> segments;
+   if ( !findShapeSegments( shapeModels[handle].BodyID, segments ) ) {
+      return;
+   }
+   std::vector<std::string> files;
+   for ( auto& segment : segments ) {
+      if ( std::find( files.begin(), files.end(), segment.File ) ==
+           files.end() )
+      {
+         files.push_back( segment.File );
+      }
+   }
+
+   SpiceDouble vertex[3]    = { 2.0 * summary.BoundingRadius, 0.0, 0.0 };
+   SpiceDouble direction[3] = { -1.0, 0.0, 0.0 };
+   auto        cast         = [&]() {
+      SpiceInt         plateID{ 0 };
+      SpiceDouble      point[3];
+      SpiceBoolean     found{ SPICEFALSE };
+      ShapeModelHandle current = getShapeModel( bodyName );
+      return current >= 0 &&
+             getRayIntercept(
+                current,
+                vertex,
+                direction,
+                plateID,
+                point,
+                found );
+   };
+   auto run = [&]() {
+      shapeCacheStatistics = ShapeCacheStatistics{};
+      auto start           = std::chrono::steady_clock::now();
+      for ( SpiceInt round = 0; round < rounds; round++ ) {
+         for ( auto& file : files ) {
+            unloadKernel( file );
+            if ( files.size() > 1 && !cast() ) {
+               return -1.0;
+            }
+            furnishKernel( file );
+            if ( !cast() ) {
+               return -1.0;
+            }
+         }
+      }
+      std::chrono::duration<double, std::milli> elapsed =
+         std::chrono::steady_clock::now() - start;
+      return elapsed.count() / rounds;
+   };
+
+   SpiceInt             configuredSize = shapeCacheSize;
+   ShapeCacheStatistics uncached;
+   ShapeCacheStatistics cached;
+   setShapeCacheSize( 0 );
+   double uncachedTime = run();
+   uncached            = shapeCacheStatistics;
+   setShapeCacheSize( configuredSize );
+   double cachedTime = run();
+   cached            = shapeCacheStatistics;
+   if ( uncachedTime < 0.0 || cachedTime < 0.0 ) {
+      return;
+   }
+
+   std::cout << "Shape cache benchmark for " << bodyName << " over "
+             << rounds << " rounds (" << summary.Plates << " plates in "
+             << segments.size() << " segments of " << files.size()
+             << " files):" << std::endl;
+   auto report = [&]( const char*                 label,
+                      const double                time,
+                      const ShapeCacheStatistics& counters ) {
+      std::cout << label << time << " ms per round, "
+                << counters.SegmentReads << " segment reads ("
+                << counters.PlatesRead << " plates), "
+                << counters.SegmentHits << " segment hits, "
+                << counters.ModelBuilds << " builds, "
+                << counters.ModelReuses << " reuses, "
+                << counters.Evictions << " evictions" << std::endl;
+   };
+   report( "   uncached: ", uncachedTime, uncached );
+   report( "   cached:   ", cachedTime, cached );
+}
+
+/*
+This function times the first intercept with a body's shape model after
+its DSKs are loaded.
+*/
+void cppspice::benchmarkShapeLoad(
+   const std::string& bodyName,
+   const SpiceInt     rounds ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      string     I   The name of the body.
+      SpiceInt   I   The number of rounds.
+
+   - Detailed_Input
+
+      bodyName    the name or NAIF ID of a body with DSK type 2 segments.
+      rounds      the number of times the body's DSKs are unloaded and
+                  loaded again for each way of reading them.
+
+   - Detailed_Output
+
+      None. The time from loading the DSKs to the first intercept, and the
+   part of it spent reading segments, are reported for segments read
+   through CSPICE and through a mapping, along with whether the two find
+   the same intercept.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and nothing is timed.
+
+   - Particulars
+
+      The shape cache is disabled while timing, so that every round reads
+   the segments from their files. The files will be in the operating
+   system's file cache after the first round, so the times are those of a
+   warm start. Through a mapping, the pages of a file are only touched as
+   the hierarchy is built, so copying them out is counted in the build
+   rather than in the reads.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   ShapeModelHandle handle = getShapeModel( bodyName );
+   ShapeSummary     summary;
+   if ( handle < 0 || !getShapeSummary( handle, summary ) || rounds <= 0 ) {
+      return;
+   }
+   std::vector<ShapeSegment> segments;
+   if ( !findShapeSegments( shapeModels[handle].BodyID, segments ) ) {
+      return;
+   }
+   std::vector<std::string> files;
+   for ( auto& segment : segments ) {
+      if ( std::find( files.begin(), files.end(), segment.File ) ==
+           files.end() )
+      {
+         files.push_back( segment.File );
+      }
+   }
+
+   SpiceDouble vertex[3]    = { 2.0 * summary.BoundingRadius, 0.0, 0.0 };
+   SpiceDouble direction[3] = { -1.0, 0.0, 0.0 };
+   struct FirstIntercept {
+      SpiceInt     PlateID{ 0 };
+      SpiceDouble  Point[3]{ 0.0, 0.0, 0.0 };
+      SpiceBoolean Found{ SPICEFALSE };
+   };
+   auto run = [&]( const bool mapped, FirstIntercept& first ) {
+      setMappedShapeReads( mapped );
+      shapeCacheStatistics = ShapeCacheStatistics{};
+      double total{ 0.0 };
+      for ( SpiceInt round = 0; round < rounds; round++ ) {
+         for ( auto& file : files ) {
+            unloadKernel( file );
+         }
+         auto start = std::chrono::steady_clock::now();
+         for ( auto& file : files ) {
+            furnishKernel( file );
+         }
+         ShapeModelHandle current = getShapeModel( bodyName );
+         if ( current < 0 ||
+              !getRayIntercept(
+                 current,
+                 vertex,
+                 direction,
+                 first.PlateID,
+                 first.Point,
+                 first.Found ) )
+         {
+            return -1.0;
+         }
+         std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+         total += elapsed.count();
+      }
+      return total / rounds;
+   };
+
+   SpiceInt             configuredSize = shapeCacheSize;
+   bool                 configuredMode = mappedShapeReads;
+   FirstIntercept       read;
+   FirstIntercept       mapped;
+   ShapeCacheStatistics readCounters;
+   ShapeCacheStatistics mappedCounters;
+   setShapeCacheSize( 0 );
+   double readTime = run( false, read );
+   readCounters    = shapeCacheStatistics;
+   double mappedTime = run( true, mapped );
+   mappedCounters    = shapeCacheStatistics;
+   setMappedShapeReads( configuredMode );
+   setShapeCacheSize( configuredSize );
+   if ( readTime < 0.0 || mappedTime < 0.0 ) {
+      return;
+   }
+
+   std::cout << "Shape load benchmark for " << bodyName << " over " << rounds
+             << " rounds (" << summary.Plates << " plates in "
+             << segments.size() << " segments of " << files.size()
+             << " files):" << std::endl;
+   auto report = [&]( const char*                 label,
+                      const double                time,
+                      const ShapeCacheStatistics& counters ) {
+      std::cout << label << time << " ms to the first intercept, "
+                << 1000.0 * counters.ReadTime / rounds
+                << " ms of it reading " << counters.SegmentReads
+                << " segments (" << counters.MappedReads << " mapped)"
+                << std::endl;
+   };
+   report( "   dskv02_c/dskp02_c: ", readTime, readCounters );
+   report( "   mapped:            ", mappedTime, mappedCounters );
+   bool same = read.Found == mapped.Found && read.PlateID == mapped.PlateID &&
+               vdist_c( read.Point, mapped.Point ) == 0.0;
+   std::cout << "   first intercepts " << ( same ? "agree" : "differ" )
+             << std::endl;
+}
+/* End ShapeUtils.cpp */
@@ -0,0 +1,269 @@
+// clang-format off
+/*
+
+- Header_File ShapeUtils.hpp (Shape utility code)
+
+- Abstract
+
+   Define utility functions which cast rays against the plate models of
+   bodies, as stored in DSK type 2 segments, without going through the
+   CSPICE DSK subsystem.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   DAS
+   DSK
+   FRAMES
+   NAIF_IDS
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   intersect rays with the plate models of bodies. When a body's shape model
+   is first requested, the plates of every loaded DSK type 2 segment for the
+   body are read, and a bounding volume hierarchy is built over them. Every
+   segment is used, without priority, as with the DSK/UNPRIORITIZED shape
+   in the GF routines. The plates are used in place from a mapping of the
+   DSK where the file allows it, rather than copied out with dskv02_c and
+   dskp02_c.
+
+   The hierarchy is kept as a flat array of 32 byte nodes in depth first
+   order, so that a node's first child directly follows it. Rays are then
+   traced through it in place of dskx02_c's voxel grid. The plates of each
+   leaf are tested SHAPELANES at a time, and arrays of rays are cast on
+   several threads, which share the model since tracing only reads it.
+
+   On top of the ray queries, a target's disk can be sampled with rays from
+   an observer to estimate how much of it a body covers, which is how the
+   custom search decides whether a DSK occulter occults the target.
+
+   Since the direction a body is viewed from changes slowly over a search,
+   its silhouette is cached for a grid of body-fixed view directions, each
+   built the first time it is needed. A target whose whole disk the
+   silhouettes around the view direction place well inside or outside the
+   limb is settled without casting any rays, and only the targets near the
+   limb are sampled.
+
+   Models, and the plates and hierarchy of each segment, are kept in a
+   cache whose capacity is a number of plates. When kernels are loaded or
+   unloaded, a model whose segments haven't changed is kept as it is. A
+   model which must be rebuilt, such as that of a tiled shape when a tile
+   is loaded or unloaded, is assembled from the segments which are cached
+   rather than read from their files again. When the cache is full, the
+   least recently used models and segments are evicted.
+
+- Literature_References
+
+   Wald, I., "On fast Construction of SAH-based Bounding Volume
+   Hierarchies", IEEE Symposium on Interactive Ray Tracing, 2007.
+
+   Moller, T., Trumbore, B., "Fast, Minimum Storage Ray-Triangle
+   Intersection", Journal of Graphics Tools, 1997.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   Only DSK type 2 (plate model) segments are supported, and all of a
+   body's segments must use the same reference frame.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes for this file.
+*/
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   An opaque handle to a body's shape model.
+   */
+   using ShapeModelHandle = SpiceInt;
+
+   /*
+   A description of a shape model, as it was built from the loaded DSKs.
+   */
+   struct ShapeSummary {
+      std::string Frame;
+      SpiceInt    Segments;
+      SpiceInt    Plates;
+      SpiceInt    Nodes;
+      SpiceDouble BoundingRadius;
+      SpiceDouble BuildTime;
+   };
+
+   /*
+   The counters of the shape cache. Segment reads are the segments whose
+   plates were read from their files, and segment hits those which were
+   found in the cache. Model reuses are the models which were kept when
+   the loaded kernels changed, rather than being rebuilt. Mapped reads are
+   the segment reads which were made through a mapping of the file, and
+   the read time is the seconds spent reading segments either way.
+   */
+   struct ShapeCacheStatistics {
+      SpiceInt    SegmentReads{ 0 };
+      SpiceInt    SegmentHits{ 0 };
+      long long   PlatesRead{ 0 };
+      SpiceInt    ModelBuilds{ 0 };
+      SpiceInt    ModelReuses{ 0 };
+      SpiceInt    Evictions{ 0 };
+      long long   ResidentPlates{ 0 };
+      SpiceInt    MappedReads{ 0 };
+      SpiceDouble ReadTime{ 0.0 };
+   };
+
+   /*
+   This function resolves a body to its shape model, building the model if
+   needed. A handle of -1 is returned if no DSK type 2 segment for the body
+   is loaded.
+   */
+   ShapeModelHandle getShapeModel( const std::string& bodyName );
+
+   /*
+   This function describes a shape model. The model is rebuilt first if the
+   loaded kernels have changed.
+   */
+   bool getShapeSummary(
+      const ShapeModelHandle handle,
+      ShapeSummary&          summary );
+
+   /*
+   This function finds the nearest intercept of a ray with a shape model,
+   as dskx02_c does for a single segment. The vertex and direction are
+   given in the model's frame.
+   */
+   bool getRayIntercept(
+      const ShapeModelHandle handle,
+      const SpiceDouble      vertex[3],
+      const SpiceDouble      direction[3],
+      SpiceInt&              plateID,
+      SpiceDouble            point[3],
+      SpiceBoolean&          found );
+
+   /*
+   This function finds the nearest intercepts of an array of rays with a
+   shape model, as dskxv_c does, with each ray giving the same result as
+   getRayIntercept. The rays are split between threads, which share the
+   model without locking.
+   */
+   bool getRayIntercepts(
+      const ShapeModelHandle handle,
+      const SpiceInt         count,
+      const SpiceDouble      vertices[][3],
+      const SpiceDouble      directions[][3],
+      SpiceInt               plateIDs[],
+      SpiceDouble            points[][3],
+      SpiceBoolean           found[] );
+
+   /*
+   This function determines whether a ray hits a shape model between its
+   vertex and vertex + extent * direction. It stops at the first plate
+   which is hit, so it is cheaper than finding the nearest intercept.
+   */
+   bool isRayBlocked(
+      const ShapeModelHandle handle,
+      const SpiceDouble      vertex[3],
+      const SpiceDouble      direction[3],
+      const SpiceDouble      extent,
+      SpiceBoolean&          blocked );
+
+   /*
+   This function estimates the fraction of a target's disk, as seen from an
+   observer, which a shape model covers. The disk is sampled with rays from
+   the observer to its center and to SHAPERINGS rings of SHAPESPOKES points.
+   The positions are given relative to the body, in the model's frame.
+   */
+   bool getBlockedFraction(
+      const ShapeModelHandle handle,
+      const SpiceDouble      observer[3],
+      const SpiceDouble      targetCenter[3],
+      const SpiceDouble      targetRadius,
+      SpiceDouble&           fraction );
+
+   /*
+   This function enables or disables the silhouette cache, which
+   getBlockedFraction uses to settle targets which are well clear of a
+   model's limb without casting rays. It is enabled by default.
+   */
+   void setSilhouetteCache( const bool enabled );
+
+   /*
+   This function sets the number of plates which the shape cache may hold,
+   across the models and the decoded segments, evicting the least recently
+   used as needed. The default is SHAPECACHEPLATES, and zero disables the
+   cache, so that every change to the loaded kernels rebuilds the models
+   from their files. The model in use is never evicted.
+   */
+   void setShapeCacheSize( const SpiceInt plates );
+
+   /*
+   This function sets the number of threads getRayIntercepts may use. Zero,
+   the default, uses one per hardware thread up to MAXSHAPETHREADS, and one
+   casts every ray on the calling thread. Each thread is given at least
+   SHAPERAYCHUNK rays.
+   */
+   void setShapeThreads( const SpiceInt threads );
+
+   /*
+   This function chooses whether segments are read through a mapping of
+   their files, which is the default, or through dskv02_c and dskp02_c. A
+   file which can't be mapped is always read through CSPICE.
+   */
+   void setMappedShapeReads( const bool enabled );
+
+   /*
+   This function returns the counters of the shape cache.
+   */
+   const ShapeCacheStatistics& getShapeCacheStatistics();
+
+   /*
+   This function times dskx02_c and dskxv_c against the shape model of a
+   body for a number of random rays, and getRayIntercepts on up to
+   MAXSHAPETHREADS threads, and reports the results. It then checks the
+   silhouette cache against casting every line of sight.
+   */
+   void benchmarkShapeModel(
+      const std::string& bodyName,
+      const SpiceInt     rays );
+
+   /*
+   This function times how long it takes, after a body's DSKs are loaded,
+   to build its shape model and find the first intercept, with segments
+   read through CSPICE and through a mapping, and reports the results.
+   */
+   void benchmarkShapeLoad(
+      const std::string& bodyName,
+      const SpiceInt     rounds );
+
+   /*
+   This function times the rebuilding of a body's shape model as its DSKs
+   are unloaded and loaded again, with the shape cache disabled and at its
+   configured capacity, and reports the results.
+   */
+   void benchmarkShapeCache(
+      const std::string& bodyName,
+      const SpiceInt     rounds );
+}   // namespace cppspice
+    /* End ShapeUtils.hpp */
@@ -0,0 +1,1235 @@
+// clang-format off
+/*
+
+- Source_File StarUtils.cpp (Star utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (StarUtils.hpp).
+
+   The triangles of the mesh are numbered as in the HTM: the eight roots
+   are numbered 0 to 7, and the children of triangle n are 4n to 4n + 3,
+   so the leaves below a triangle form one range of numbers. A triangle
+   with corners v0, v1, and v2, and with w0, w1, and w2 the midpoints of
+   the sides opposite them, has the children (v0, w2, w1), (v1, w0, w2),
+   (v2, w1, w0), and (w0, w1, w2).
+
+   A triangle is bounded by the smallest circle about its centroid which
+   holds its corners. The triangle is clear of a query's circle if the two
+   circles are apart, and within it if all of its corners are, since the
+   circles are smaller than a hemisphere.
+
+   Seen from the observer, with the occulter's equatorial radius a and
+   polar radius c, stretching every vector along the occulter's pole by
+   a / c turns the occulter into a sphere of radius a, and leaves straight
+   lines straight. So a line of sight towards a star passes through the
+   occulter exactly when, once stretched, it is closer to the occulter's
+   center than the sphere's angular radius. The measure of a star is the
+   difference, which is negative while the star is occulted.
+
+   Within a step, the occulter's position is interpolated from its states
+   at the ends of the step with a cubic Hermite polynomial, and its pole is
+   taken at the middle of the step. Every candidate is measured through
+   these, which needs no further ephemeris lookups. A star's distance from
+   the occulter's path, less the largest angular radius, bounds its
+   measure from below, which dismisses most of the candidates which are
+   clear at both ends of the step. For the others, the minimum is found by
+   golden section. Each ingress and egress is bracketed and found on the
+   interpolation, then polished with the exact measure until it moves by
+   less than the tolerance.
+
+- Literature_References
+
+   Kunszt, P.Z., Szalay, A.S., and Thakar, A.R., "The Hierarchical
+   Triangular Mesh", Mining the Sky, Springer, 2001.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, algorithm and cmath for the arithmetic,
+chrono for timing, the stream headers for the catalog and the output file,
+map for the stars which are occulted, and the ephemeris, frame, and kernel
+utilities to place the occulter.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "EphemerisUtils.hpp"
+#include "FrameUtils.hpp"
+#include "KernelUtils.hpp"
+#include "StarUtils.hpp"
+
+/*
+The corners of the octahedron, and the corners of its eight faces, which
+are the roots of the mesh, each counterclockwise as seen from outside.
+*/
+static const SpiceDouble octahedronCorners[6][3] = {
+   { 0.0, 0.0, 1.0 },
+   { 1.0, 0.0, 0.0 },
+   { 0.0, 1.0, 0.0 },
+   { -1.0, 0.0, 0.0 },
+   { 0.0, -1.0, 0.0 },
+   { 0.0, 0.0, -1.0 } };
+
+static const SpiceInt octahedronFaces[8][3] = {
+   { 1, 5, 2 },
+   { 2, 5, 3 },
+   { 3, 5, 4 },
+   { 4, 5, 1 },
+   { 1, 0, 4 },
+   { 4, 0, 3 },
+   { 3, 0, 2 },
+   { 2, 0, 1 } };
+
+/*
+A circle on the sky, by its J2000 center, its radius, and the cosine of
+its radius.
+*/
+struct SkyCircle {
+   SpiceDouble Center[3];
+   SpiceDouble Radius;
+   SpiceDouble CosRadius;
+};
+
+/*
+The occulter within one step: its light time corrected positions and
+velocities relative to the observer at the ends of the step, and its pole
+at the middle, all in J2000.
+*/
+struct OcculterStep {
+   SpiceDouble Epochs[2];
+   SpiceDouble Positions[2][3];
+   SpiceDouble Velocities[2][3];
+   SpiceDouble Pole[3];
+};
+
+/*
+The occulter's shape: its equatorial radius, the larger of its radii,
+which bounds it, and the stretch along its pole, a / c - 1, which makes it
+a sphere.
+*/
+struct OcculterShape {
+   SpiceDouble Radius;
+   SpiceDouble Bound;
+   SpiceDouble Stretch;
+};
+
+/*
+This is a helper which determines whether a direction lies on the inner
+side of the great circle from one corner of a triangle to the next.
+*/
+static inline bool isInsideEdge(
+   const SpiceDouble from[3],
+   const SpiceDouble to[3],
+   const SpiceDouble direction[3] ) {
+   return ( from[1] * to[2] - from[2] * to[1] ) * direction[0] +
+             ( from[2] * to[0] - from[0] * to[2] ) * direction[1] +
+             ( from[0] * to[1] - from[1] * to[0] ) * direction[2] >=
+          0.0;
+}
+
+/*
+This is a helper which finds the corners of the children of a triangle.
+*/
+static void getChildTriangles(
+   const SpiceDouble corners[3][3],
+   SpiceDouble       children[4][3][3] ) {
+   SpiceDouble midpoints[3][3];
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      const SpiceDouble* a = corners[( k + 1 ) % 3];
+      const SpiceDouble* b = corners[( k + 2 ) % 3];
+      SpiceDouble        scale =
+         1.0 / sqrt( ( a[0] + b[0] ) * ( a[0] + b[0] ) +
+                     ( a[1] + b[1] ) * ( a[1] + b[1] ) +
+                     ( a[2] + b[2] ) * ( a[2] + b[2] ) );
+      for ( SpiceInt j = 0; j < 3; j++ ) {
+         midpoints[k][j] = ( a[j] + b[j] ) * scale;
+      }
+   }
+   const SpiceDouble* layout[4][3] = {
+      { corners[0], midpoints[2], midpoints[1] },
+      { corners[1], midpoints[0], midpoints[2] },
+      { corners[2], midpoints[1], midpoints[0] },
+      { midpoints[0], midpoints[1], midpoints[2] } };
+   for ( SpiceInt child = 0; child < 4; child++ ) {
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         vequ_c( layout[child][k], children[child][k] );
+      }
+   }
+}
+
+/*
+This is a helper which finds the leaf triangle of the mesh which holds a
+direction.
+*/
+static std::uint64_t getTrixel( const SpiceDouble direction[3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      SpiceDouble   I   The J2000 unit vector.
+      uint64_t      O   The number of the leaf.
+
+   - Detailed_Input
+
+      direction   a J2000 unit vector.
+
+   - Detailed_Output
+
+      The function returns the number of the leaf at STARINDEXDEPTH which
+   holds the direction.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      A direction on the side shared by two triangles goes to the first
+   which holds it. If rounding leaves it in none of the children, it goes
+   to the middle one, which is nearest.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::STARINDEXDEPTH;
+   SpiceInt root{ 7 };
+   for ( SpiceInt face = 0; face < 8; face++ ) {
+      const SpiceDouble* a = octahedronCorners[octahedronFaces[face][0]];
+      const SpiceDouble* b = octahedronCorners[octahedronFaces[face][1]];
+      const SpiceDouble* c = octahedronCorners[octahedronFaces[face][2]];
+      if ( isInsideEdge( a, b, direction ) &&
+           isInsideEdge( b, c, direction ) &&
+           isInsideEdge( c, a, direction ) )
+      {
+         root = face;
+         break;
+      }
+   }
+
+   SpiceDouble corners[3][3];
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      vequ_c( octahedronCorners[octahedronFaces[root][k]], corners[k] );
+   }
+   std::uint64_t trixel = root;
+   for ( SpiceInt level = 0; level < STARINDEXDEPTH; level++ ) {
+      SpiceDouble children[4][3][3];
+      getChildTriangles( corners, children );
+      SpiceInt chosen{ 3 };
+      for ( SpiceInt child = 0; child < 3; child++ ) {
+         const auto& t = children[child];
+         if ( isInsideEdge( t[0], t[1], direction ) &&
+              isInsideEdge( t[1], t[2], direction ) &&
+              isInsideEdge( t[2], t[0], direction ) )
+         {
+            chosen = child;
+            break;
+         }
+      }
+      trixel = trixel * 4 + chosen;
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         vequ_c( children[chosen][k], corners[k] );
+      }
+   }
+   return trixel;
+}
+
+/*
+This is a helper which gathers the stars of the triangles below one
+triangle of the mesh which may lie within a circle.
+*/
+static void collectStars(
+   const cppspice::StarCatalog& catalog,
+   const SkyCircle&             circle,
+   const SpiceDouble            corners[3][3],
+   const SpiceInt               level,
+   const std::uint64_t          trixel,
+   std::vector<SpiceInt>&       stars ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      StarCatalog   I   The catalog.
+      SkyCircle     I   The circle.
+      SpiceDouble   I   The corners of the triangle.
+      SpiceInt      I   The level of the triangle, where the roots are 0.
+      uint64_t      I   The number of the triangle.
+      vector       I/O  The indices of the stars found.
+
+   - Detailed_Input
+
+      catalog     the catalog.
+      circle      the circle on the sky.
+      corners     the J2000 unit vectors of the triangle's corners.
+      level       the level of the triangle.
+      trixel      the number of the triangle within its level.
+      stars       the indices of the stars found so far.
+
+   - Detailed_Output
+
+      stars       the indices of the stars found so far, with those of the
+                  triangle appended.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The stars of the triangle are found by searching the sorted leaf
+   numbers for the range of its leaves, so a triangle without stars is
+   dropped at once. A triangle within the circle gives all of its stars,
+   and a leaf which the circle crosses gives those of its stars which are
+   within it.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   using cppspice::STARINDEXDEPTH;
+   SpiceInt      shift = 2 * ( STARINDEXDEPTH - level );
+   std::uint64_t lowerLeaf = trixel << shift;
+   std::uint64_t upperLeaf = ( trixel + 1 ) << shift;
+   auto          first     = std::lower_bound(
+      catalog.Trixels.begin(),
+      catalog.Trixels.end(),
+      lowerLeaf );
+   auto last = std::lower_bound( first, catalog.Trixels.end(), upperLeaf );
+   if ( first == last ) {
+      return;
+   }
+
+   /*
+   Bound the triangle by a circle about its centroid, and drop it if that
+   circle and the query's are apart.
+   */
+   SpiceDouble centroid[3];
+   vadd_c( corners[0], corners[1], centroid );
+   vadd_c( centroid, corners[2], centroid );
+   vhat_c( centroid, centroid );
+   SpiceDouble bound{ 0.0 };
+   SpiceInt    inside{ 0 };
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      bound = std::max( bound, vsep_c( centroid, corners[k] ) );
+      if ( vdot_c( circle.Center, corners[k] ) >= circle.CosRadius ) {
+         inside++;
+      }
+   }
+   if ( vsep_c( circle.Center, centroid ) >
+        circle.Radius + bound + cppspice::SHAPEEDGEMARGIN )
+   {
+      return;
+   }
+
+   SpiceInt firstStar =
+      static_cast<SpiceInt>( first - catalog.Trixels.begin() );
+   SpiceInt lastStar =
+      static_cast<SpiceInt>( last - catalog.Trixels.begin() );
+   if ( inside == 3 ) {
+      for ( SpiceInt star = firstStar; star < lastStar; star++ ) {
+         stars.push_back( star );
+      }
+      return;
+   }
+
+   if ( level == STARINDEXDEPTH ) {
+      for ( SpiceInt star = firstStar; star < lastStar; star++ ) {
+         if ( vdot_c( circle.Center, catalog.Directions[star].data() ) >=
+              circle.CosRadius )
+         {
+            stars.push_back( star );
+         }
+      }
+      return;
+   }
+
+   SpiceDouble children[4][3][3];
+   getChildTriangles( corners, children );
+   for ( SpiceInt child = 0; child < 4; child++ ) {
+      collectStars(
+         catalog,
+         circle,
+         children[child],
+         level + 1,
+         trixel * 4 + child,
+         stars );
+   }
+}
+
+/*
+This function reads a star catalog and builds its index.
+*/
+bool cppspice::loadStarCatalog(
+   const std::string& path,
+   const SpiceDouble  epoch,
+   StarCatalog&       catalog ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      string        I   The path of the catalog.
+      SpiceDouble   I   The epoch of the catalog's positions.
+      StarCatalog   O   The catalog and its index.
+
+   - Detailed_Input
+
+      path        the path of a text file with one star per line, as its
+                  name, right ascension and declination in degrees, and
+                  optionally its proper motion in right ascension (times
+                  the cosine of its declination) and in declination, in
+                  milliarcseconds per year. The fields are separated by
+                  spaces or commas. Blank lines and lines which begin with
+                  '#' are skipped.
+      epoch       the epoch of the positions, in seconds past J2000 TDB.
+
+   - Detailed_Output
+
+      catalog     the catalog, sorted by its index.
+
+   - Error Handling
+
+      If the file can't be read, or a line can't be parsed, an error is
+   reported and false is returned.
+
+   - Particulars
+
+      The positions are taken as J2000, which the ICRS agrees with to well
+   within the accuracy of the search.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::ifstream in( path );
+   if ( !in ) {
+      std::cout << "Error: unable to read the star catalog '" << path
+                << "'." << std::endl;
+      return false;
+   }
+
+   StarCatalog unsorted;
+   unsorted.Epoch = epoch;
+   SpiceDouble masToRadians = rpd_c() / 3600000.0;
+   std::string line;
+   SpiceInt    lineNumber{ 0 };
+   while ( std::getline( in, line ) ) {
+      lineNumber++;
+      std::replace( line.begin(), line.end(), ',', ' ' );
+      std::istringstream fields( line );
+      std::string        name;
+      if ( !( fields >> name ) || name[0] == '#' ) {
+         continue;
+      }
+
+      SpiceDouble rightAscension{ 0.0 };
+      SpiceDouble declination{ 0.0 };
+      SpiceDouble motionRA{ 0.0 };
+      SpiceDouble motionDec{ 0.0 };
+      if ( !( fields >> rightAscension >> declination ) ||
+           std::abs( declination ) > 90.0 )
+      {
+         std::cout << "Error: line " << lineNumber << " of the star catalog '"
+                   << path << "' is invalid." << std::endl;
+         return false;
+      }
+      if ( fields >> motionRA && !( fields >> motionDec ) ) {
+         std::cout << "Error: line " << lineNumber << " of the star catalog '"
+                   << path << "' is invalid." << std::endl;
+         return false;
+      }
+
+      /*
+      The proper motion is along the local east and north.
+      */
+      SpiceDouble alpha = rightAscension * rpd_c();
+      SpiceDouble delta = declination * rpd_c();
+      std::array<SpiceDouble, 3> direction;
+      radrec_c( 1.0, alpha, delta, direction.data() );
+      SpiceDouble east[3] = { -sin( alpha ), cos( alpha ), 0.0 };
+      SpiceDouble north[3] = {
+         -sin( delta ) * cos( alpha ),
+         -sin( delta ) * sin( alpha ),
+         cos( delta ) };
+      std::array<SpiceDouble, 3> motion;
+      vlcom_c(
+         motionRA * masToRadians,
+         east,
+         motionDec * masToRadians,
+         north,
+         motion.data() );
+
+      unsorted.Names.push_back( name );
+      unsorted.Trixels.push_back( getTrixel( direction.data() ) );
+      unsorted.Directions.push_back( direction );
+      unsorted.Motions.push_back( motion );
+      unsorted.MaxMotion =
+         std::max( unsorted.MaxMotion, vnorm_c( motion.data() ) );
+   }
+
+   /*
+   Sort the stars by their leaves, so that every triangle of the mesh holds
+   a range of them.
+   */
+   std::vector<SpiceInt> order( unsorted.Names.size() );
+   for ( size_t i = 0; i < order.size(); i++ ) {
+      order[i] = static_cast<SpiceInt>( i );
+   }
+   std::stable_sort(
+      order.begin(),
+      order.end(),
+      [&unsorted]( const SpiceInt left, const SpiceInt right ) {
+         return unsorted.Trixels[left] < unsorted.Trixels[right];
+      } );
+
+   catalog           = StarCatalog();
+   catalog.Epoch     = unsorted.Epoch;
+   catalog.MaxMotion = unsorted.MaxMotion;
+   catalog.Names.reserve( order.size() );
+   catalog.Trixels.reserve( order.size() );
+   catalog.Directions.reserve( order.size() );
+   catalog.Motions.reserve( order.size() );
+   for ( SpiceInt i : order ) {
+      catalog.Names.push_back( std::move( unsorted.Names[i] ) );
+      catalog.Trixels.push_back( unsorted.Trixels[i] );
+      catalog.Directions.push_back( unsorted.Directions[i] );
+      catalog.Motions.push_back( unsorted.Motions[i] );
+   }
+   return true;
+}
+
+/*
+This function finds the stars of a catalog which may lie within a circle.
+*/
+void cppspice::queryStarCatalog(
+   const StarCatalog&     catalog,
+   const SpiceDouble      center[3],
+   const SpiceDouble      radius,
+   const SpiceDouble      epoch,
+   std::vector<SpiceInt>& stars ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      StarCatalog   I   The catalog.
+      SpiceDouble   I   The J2000 center of the circle.
+      SpiceDouble   I   The radius of the circle, in radians.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      vector        O   The indices of the stars found.
+
+   - Detailed_Input
+
+      catalog     the catalog, as loaded by loadStarCatalog.
+      center      the J2000 unit vector of the circle's center.
+      radius      the radius of the circle, in radians, which must be less
+                  than a right angle.
+      epoch       the epoch at which the stars are to be within the circle.
+
+   - Detailed_Output
+
+      stars       the indices of the stars found, in the order of the
+                  index.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      The index holds the stars where they were at the catalog's epoch, so
+   the circle is widened by the farthest that the fastest of them could
+   have moved since. The stars in the triangles which lie entirely within
+   the circle are returned without being tested, which is why a few of
+   them may lie just outside of it, by up to this margin.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   stars.clear();
+   SkyCircle circle;
+   vhat_c( center, circle.Center );
+   circle.Radius = radius + catalog.MaxMotion *
+                               std::abs( epoch - catalog.Epoch ) /
+                               jyear_c();
+   circle.Radius    = std::min( circle.Radius, halfpi_c() );
+   circle.CosRadius = cos( circle.Radius );
+   for ( SpiceInt root = 0; root < 8; root++ ) {
+      SpiceDouble corners[3][3];
+      for ( SpiceInt k = 0; k < 3; k++ ) {
+         vequ_c( octahedronCorners[octahedronFaces[root][k]], corners[k] );
+      }
+      collectStars( catalog, circle, corners, 0, root, stars );
+   }
+}
+
+/*
+This function returns the direction of a star at an epoch.
+*/
+void cppspice::getStarDirection(
+   const StarCatalog& catalog,
+   const SpiceInt     star,
+   const SpiceDouble  epoch,
+   SpiceDouble        direction[3] ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      StarCatalog   I   The catalog.
+      SpiceInt      I   The index of the star.
+      SpiceDouble   I   The epoch, in seconds past J2000 TDB.
+      SpiceDouble   O   The J2000 unit vector of the star.
+
+   - Detailed_Input
+
+      catalog     the catalog, as loaded by loadStarCatalog.
+      star        the index of the star in the catalog.
+      epoch       the epoch.
+
+   - Detailed_Output
+
+      direction   the J2000 unit vector of the star at the epoch.
+
+   - Error Handling
+
+      None.
+
+   - Particulars
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   vlcom_c(
+      1.0,
+      catalog.Directions[star].data(),
+      ( epoch - catalog.Epoch ) / jyear_c(),
+      catalog.Motions[star].data(),
+      direction );
+   vhat_c( direction, direction );
+}
+
+/*
+This is a helper which interpolates the occulter's position within a step.
+*/
+static void interpolateOcculter(
+   const OcculterStep& step,
+   const SpiceDouble   epoch,
+   SpiceDouble         position[3] ) {
+   SpiceDouble h  = step.Epochs[1] - step.Epochs[0];
+   SpiceDouble s  = ( epoch - step.Epochs[0] ) / h;
+   SpiceDouble s2 = s * s;
+   SpiceDouble s3 = s2 * s;
+   SpiceDouble weights[4] = {
+      2.0 * s3 - 3.0 * s2 + 1.0,
+      ( s3 - 2.0 * s2 + s ) * h,
+      -2.0 * s3 + 3.0 * s2,
+      ( s3 - s2 ) * h };
+   for ( SpiceInt k = 0; k < 3; k++ ) {
+      position[k] = weights[0] * step.Positions[0][k] +
+                    weights[1] * step.Velocities[0][k] +
+                    weights[2] * step.Positions[1][k] +
+                    weights[3] * step.Velocities[1][k];
+   }
+}
+
+/*
+This is a helper which stretches a vector along the occulter's pole, which
+turns the occulter into a sphere.
+*/
+static inline void stretchAlongPole(
+   const OcculterShape& shape,
+   const SpiceDouble    pole[3],
+   const SpiceDouble    vector[3],
+   SpiceDouble          stretched[3] ) {
+   vlcom_c(
+      1.0,
+      vector,
+      shape.Stretch * vdot_c( pole, vector ),
+      pole,
+      stretched );
+}
+
+/*
+This is a helper which measures a star against the occulter: the angle
+between the star and the occulter's center, less the occulter's angular
+radius, once both are stretched along the pole.
+*/
+static SpiceDouble getStarMeasure(
+   const OcculterShape& shape,
+   const SpiceDouble    pole[3],
+   const SpiceDouble    occulter[3],
+   const SpiceDouble    star[3] ) {
+   SpiceDouble stretchedOcculter[3];
+   SpiceDouble stretchedStar[3];
+   stretchAlongPole( shape, pole, occulter, stretchedOcculter );
+   stretchAlongPole( shape, pole, star, stretchedStar );
+   SpiceDouble distance = vnorm_c( stretchedOcculter );
+   return vsep_c( stretchedOcculter, stretchedStar ) -
+          asin( std::min( 1.0, shape.Radius / distance ) );
+}
+
+/*
+This is a helper which finds the angular distance from a direction to a
+path of great circle arcs between unit vectors.
+*/
+static SpiceDouble getPathDistance(
+   const SpiceDouble path[][3],
+   const SpiceInt    count,
+   const SpiceDouble direction[3] ) {
+   SpiceDouble distance = vsep_c( path[0], direction );
+   for ( SpiceInt k = 1; k < count; k++ ) {
+      distance = std::min( distance, vsep_c( path[k], direction ) );
+
+      /*
+      Within the arc, the distance is that from its great circle.
+      */
+      SpiceDouble normal[3];
+      SpiceDouble projected[3];
+      ucrss_c( path[k - 1], path[k], normal );
+      vperp_c( direction, normal, projected );
+      SpiceDouble fromStart[3];
+      SpiceDouble toEnd[3];
+      vcrss_c( path[k - 1], projected, fromStart );
+      vcrss_c( projected, path[k], toEnd );
+      if ( vdot_c( fromStart, normal ) >= 0.0 &&
+           vdot_c( toEnd, normal ) >= 0.0 )
+      {
+         distance = std::min(
+            distance,
+            std::abs( halfpi_c() - vsep_c( normal, direction ) ) );
+      }
+   }
+   return distance;
+}
+
+/*
+This function searches for occultations of the stars of a catalog.
+*/
+bool cppspice::findStarOccultations( const SimulationData& data ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      data       I   The simulation data.
+
+   - Detailed_Input
+
+      data     the simulation data, of which the occulter, the observer,
+               the span, the tolerance, and the star settings are used:
+
+                  StarCatalog       The path of the catalog, as read by
+                                    loadStarCatalog.
+                  StarCatalogEpoch  The epoch of the catalog's positions,
+                                    as a Julian year.
+                  StarStep          The coarse step in seconds, STARSTEP
+                                    if zero.
+                  StarOutput        The path of the file to write, or
+                                    empty to report to the console.
+
+   - Detailed_Output
+
+      The function returns true if no errors are encountered. Each
+   occultation is reported with its star and its ingress and egress, in
+   order of ingress, and a summary of the search follows.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      The occulter is placed with light time corrected states from the
+   center of the observer. The stars' catalog directions need no such
+   correction, and neither is corrected for stellar aberration, which
+   shifts both alike. An occultation which is under way at either end of
+   the span is cut off there.
+
+      Each step queries the catalog with the circle about the occulter's
+   position at the middle of the step which holds its positions at five
+   points of the step, widened by its largest angular radius. Stars which
+   are occulted at the start of a step are always measured, so that their
+   egress is found even if the occulter's path bends out of the circle.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceInt     occulterID{ 0 };
+   SpiceInt     observerID{ 0 };
+   SpiceBoolean occulterFound{ SPICEFALSE };
+   SpiceBoolean observerFound{ SPICEFALSE };
+   const std::string& occulterName = std::get<0>( data.OcculterDetails );
+   bodn2c_c( occulterName.c_str(), &occulterID, &occulterFound );
+   bodn2c_c( data.ObserverName.c_str(), &observerID, &observerFound );
+   if ( !occulterFound || !observerFound ) {
+      std::cout << "Error: the participants of the star occultation search "
+                   "could not be resolved."
+                << std::endl;
+      return false;
+   }
+   if ( std::get<1>( data.OcculterDetails ) != "ELLIPSOID" ) {
+      std::cout << "Error: the star occultation search needs an ELLIPSOID "
+                   "occulter."
+                << std::endl;
+      return false;
+   }
+
+   SpiceDouble radii[3];
+   SpiceInt    n{ 0 };
+   PoolHandle  radiiHandle = getBodyConstantHandle( occulterName, "RADII" );
+   if ( radiiHandle < 0 || !readPoolHandle( radiiHandle, 3, n, radii ) ||
+        n != 3 )
+   {
+      std::cout << "Error: unable to read the radii of '" << occulterName
+                << "'." << std::endl;
+      return false;
+   }
+   OcculterShape shape;
+   shape.Radius  = radii[0];
+   shape.Bound   = std::max( radii[0], radii[2] );
+   shape.Stretch = radii[0] / radii[2] - 1.0;
+
+   FramePlanHandle plan =
+      getFramePlan( "J2000", std::get<2>( data.OcculterDetails ) );
+   if ( plan < 0 ) {
+      return false;
+   }
+
+   SpiceDouble lowerEpoch{ 0.0 };
+   SpiceDouble upperEpoch{ 0.0 };
+   str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpoch );
+   str2et_c( data.UpperBoundEpoch.c_str(), &upperEpoch );
+   SpiceDouble stepSize = data.StarStep > 0.0 ? data.StarStep : STARSTEP;
+   SpiceDouble tolerance = data.Tolerance;
+
+   auto        loadStart = std::chrono::steady_clock::now();
+   StarCatalog catalog;
+   if ( !loadStarCatalog(
+           data.StarCatalog,
+           ( data.StarCatalogEpoch - 2000.0 ) * jyear_c(),
+           catalog ) )
+   {
+      return false;
+   }
+   std::chrono::duration<double> loadTime =
+      std::chrono::steady_clock::now() - loadStart;
+
+   auto                            start = std::chrono::steady_clock::now();
+   LightTimeCache                  lightTimes;
+   OcculterStep                    step;
+   StateVector                     state;
+   SpiceDouble                     rotate[3][3];
+   std::vector<SpiceInt>           candidates;
+   std::map<SpiceInt, SpiceDouble> occulted;
+   std::vector<StarOccultation>    occultations;
+   long long                       steps{ 0 };
+   long long                       candidateCount{ 0 };
+   long long                       crossings{ 0 };
+   long long                       exactMeasures{ 0 };
+
+   /*
+   This finds the occulter's state at an epoch.
+   */
+   auto getOcculterState = [&]( const SpiceDouble epoch ) -> bool {
+      std::vector<BodyState> states;
+      if ( !getMultiBodyStates(
+              { occulterID },
+              epoch,
+              observerID,
+              lightTimes,
+              states ) )
+      {
+         return false;
+      }
+      state = states[0].State;
+      return true;
+   };
+
+   if ( !getOcculterState( lowerEpoch ) ) {
+      return false;
+   }
+   for ( SpiceDouble epoch = lowerEpoch; epoch < upperEpoch;
+         epoch += stepSize )
+   {
+      /*
+      The start of this step is the end of the last.
+      */
+      step.Epochs[0] = epoch;
+      step.Epochs[1] = std::min( upperEpoch, epoch + stepSize );
+      vequ_c( &state[0], step.Positions[0] );
+      vequ_c( &state[3], step.Velocities[0] );
+      SpiceDouble middle = 0.5 * ( step.Epochs[0] + step.Epochs[1] );
+      if ( !getMemoRotation( plan, middle, rotate ) ||
+           !getOcculterState( step.Epochs[1] ) )
+      {
+         return false;
+      }
+      vequ_c( rotate[2], step.Pole );
+      vequ_c( &state[0], step.Positions[1] );
+      vequ_c( &state[3], step.Velocities[1] );
+      steps++;
+
+      /*
+      Trace the occulter's path through the step. On the sky, it is held
+      by the circle about its middle which reaches its farthest sample,
+      widened by its largest angular radius. Once stretched, the distance
+      of a star from the path, less the largest angular radius of the
+      sphere, bounds its measure from below.
+      */
+      SpiceDouble directions[5][3];
+      SpiceDouble path[5][3];
+      SpiceDouble largestRadius{ 0.0 };
+      SpiceDouble largestSphere{ 0.0 };
+      for ( SpiceInt k = 0; k < 5; k++ ) {
+         SpiceDouble position[3];
+         interpolateOcculter(
+            step,
+            step.Epochs[0] + 0.25 * k * ( step.Epochs[1] - step.Epochs[0] ),
+            position );
+         stretchAlongPole( shape, step.Pole, position, path[k] );
+         vhat_c( position, directions[k] );
+         largestRadius = std::max(
+            largestRadius,
+            asin( std::min( 1.0, shape.Bound / vnorm_c( position ) ) ) );
+         largestSphere = std::max(
+            largestSphere,
+            asin( std::min( 1.0, shape.Radius / vnorm_c( path[k] ) ) ) );
+         vhat_c( path[k], path[k] );
+      }
+      SpiceDouble reach{ 0.0 };
+      SpiceDouble pathLength{ 0.0 };
+      for ( SpiceInt k = 0; k < 5; k++ ) {
+         reach = std::max( reach, vsep_c( directions[2], directions[k] ) );
+         if ( k > 0 ) {
+            pathLength += vsep_c( path[k - 1], path[k] );
+         }
+      }
+      SpiceDouble margin = ( STARPATHPAD - 1.0 ) * pathLength;
+      queryStarCatalog(
+         catalog,
+         directions[2],
+         STARPATHPAD * reach + largestRadius,
+         middle,
+         candidates );
+      size_t queried = candidates.size();
+      for ( const auto& star : occulted ) {
+         if ( !std::binary_search(
+                 candidates.begin(),
+                 candidates.begin() + queried,
+                 star.first ) )
+         {
+            candidates.push_back( star.first );
+         }
+      }
+      candidateCount += candidates.size();
+
+      for ( SpiceInt candidate : candidates ) {
+         SpiceDouble star[3];
+         getStarDirection( catalog, candidate, middle, star );
+         auto measure = [&]( const SpiceDouble at ) -> SpiceDouble {
+            SpiceDouble position[3];
+            interpolateOcculter( step, at, position );
+            return getStarMeasure( shape, step.Pole, position, star );
+         };
+
+         /*
+         Dismiss the candidates which the occulter passes too far from. A
+         star which is already occulted stays so until its measure rises
+         above zero.
+         */
+         SpiceDouble lower   = measure( step.Epochs[0] );
+         SpiceDouble upper   = measure( step.Epochs[1] );
+         auto        ingress = occulted.find( candidate );
+         bool        startIn = ingress != occulted.end() || lower < 0.0;
+         bool        endIn   = upper < 0.0;
+         if ( !startIn && !endIn ) {
+            SpiceDouble stretchedStar[3];
+            stretchAlongPole( shape, step.Pole, star, stretchedStar );
+            vhat_c( stretchedStar, stretchedStar );
+            if ( getPathDistance( path, 5, stretchedStar ) - largestSphere >
+                 margin )
+            {
+               continue;
+            }
+         }
+
+         /*
+         This finds a crossing within a bracket on the interpolation, with
+         the Illinois method, and then polishes it with the exact measure,
+         with Newton steps on the interpolation's slope.
+         */
+         auto findCrossing = [&]( SpiceDouble  a,
+                                  SpiceDouble  fa,
+                                  SpiceDouble  b,
+                                  SpiceDouble  fb,
+                                  SpiceDouble& crossing ) -> bool {
+            SpiceInt side{ 0 };
+            crossing = a;
+            crossings++;
+            for ( SpiceInt i = 0; i < ITERLIMIT && b - a > tolerance; i++ )
+            {
+               crossing       = ( a * fb - b * fa ) / ( fb - fa );
+               SpiceDouble fc = measure( crossing );
+               if ( ( fc < 0.0 ) == ( fa < 0.0 ) ) {
+                  a  = crossing;
+                  fa = fc;
+                  if ( side == -1 ) {
+                     fb *= 0.5;
+                  }
+                  side = -1;
+               }
+               else {
+                  b  = crossing;
+                  fb = fc;
+                  if ( side == 1 ) {
+                     fa *= 0.5;
+                  }
+                  side = 1;
+               }
+            }
+            SpiceDouble span = STARSLOPESPAN * ( step.Epochs[1] -
+                                                 step.Epochs[0] );
+            SpiceDouble slope = ( measure( crossing + 0.5 * span ) -
+                                  measure( crossing - 0.5 * span ) ) /
+                                span;
+            for ( SpiceInt i = 0; i < STARPOLISHLIMIT; i++ ) {
+               std::vector<BodyState> states;
+               SpiceDouble            exactRotate[3][3];
+               if ( !getMultiBodyStates(
+                       { occulterID },
+                       crossing,
+                       observerID,
+                       lightTimes,
+                       states ) ||
+                    !getMemoRotation( plan, crossing, exactRotate ) )
+               {
+                  return false;
+               }
+               exactMeasures++;
+               SpiceDouble correction =
+                  -getStarMeasure(
+                     shape,
+                     exactRotate[2],
+                     states[0].State.data(),
+                     star ) /
+                  slope;
+               crossing = std::min(
+                  step.Epochs[1],
+                  std::max( step.Epochs[0], crossing + correction ) );
+               if ( std::abs( correction ) < tolerance ) {
+                  break;
+               }
+            }
+            return true;
+         };
+
+         /*
+         Where the star is clear at both ends of the step, the measure's one
+         minimum within the step, found by golden section, tells whether it
+         was occulted in between.
+         */
+         if ( !startIn && !endIn ) {
+            SpiceDouble ratio = 0.5 * ( sqrt( 5.0 ) - 1.0 );
+            SpiceDouble left  = step.Epochs[0];
+            SpiceDouble right = step.Epochs[1];
+            SpiceDouble inner = right - ratio * ( right - left );
+            SpiceDouble outer = left + ratio * ( right - left );
+            SpiceDouble innerMeasure = measure( inner );
+            SpiceDouble outerMeasure = measure( outer );
+            for ( SpiceInt i = 0; i < STARMINIMUMSTEPS; i++ ) {
+               if ( innerMeasure < outerMeasure ) {
+                  right        = outer;
+                  outer        = inner;
+                  outerMeasure = innerMeasure;
+                  inner        = right - ratio * ( right - left );
+                  innerMeasure = measure( inner );
+               }
+               else {
+                  left         = inner;
+                  inner        = outer;
+                  innerMeasure = outerMeasure;
+                  outer        = left + ratio * ( right - left );
+                  outerMeasure = measure( outer );
+               }
+            }
+            SpiceDouble lowest        = 0.5 * ( left + right );
+            SpiceDouble lowestMeasure = measure( lowest );
+            StarOccultation occultation{ candidate, 0.0, 0.0 };
+            if ( lowestMeasure < 0.0 ) {
+               if ( !findCrossing(
+                       step.Epochs[0],
+                       lower,
+                       lowest,
+                       lowestMeasure,
+                       occultation.Ingress ) ||
+                    !findCrossing(
+                       lowest,
+                       lowestMeasure,
+                       step.Epochs[1],
+                       upper,
+                       occultation.Egress ) )
+               {
+                  return false;
+               }
+               occultations.push_back( occultation );
+            }
+         }
+         else if ( !startIn ) {
+            SpiceDouble crossing{ 0.0 };
+            if ( !findCrossing(
+                    step.Epochs[0],
+                    lower,
+                    step.Epochs[1],
+                    upper,
+                    crossing ) )
+            {
+               return false;
+            }
+            occulted[candidate] = crossing;
+         }
+         else if ( !endIn ) {
+            /*
+            A star which the last step left occulted, but whose measure
+            has risen above zero by the start of this one, left at the
+            start.
+            */
+            SpiceDouble crossing{ step.Epochs[0] };
+            if ( lower < 0.0 && !findCrossing(
+                                   step.Epochs[0],
+                                   lower,
+                                   step.Epochs[1],
+                                   upper,
+                                   crossing ) )
+            {
+               return false;
+            }
+            SpiceDouble entered =
+               ingress != occulted.end() ? ingress->second : step.Epochs[0];
+            occultations.push_back( { candidate, entered, crossing } );
+            if ( ingress != occulted.end() ) {
+               occulted.erase( ingress );
+            }
+         }
+         else if ( ingress == occulted.end() ) {
+            occulted[candidate] = step.Epochs[0];
+         }
+      }
+   }
+
+   /*
+   The stars which are still occulted are cut off at the end of the span.
+   */
+   for ( const auto& star : occulted ) {
+      occultations.push_back( { star.first, star.second, upperEpoch } );
+   }
+   std::sort(
+      occultations.begin(),
+      occultations.end(),
+      []( const StarOccultation& left, const StarOccultation& right ) {
+         return left.Ingress < right.Ingress;
+      } );
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   std::ofstream file;
+   if ( !data.StarOutput.empty() ) {
+      file.open( data.StarOutput );
+      if ( !file ) {
+         std::cout << "Error: unable to open '" << data.StarOutput
+                   << "' for the star occultations." << std::endl;
+         return false;
+      }
+   }
+   std::ostream& out = data.StarOutput.empty() ? std::cout : file;
+   SpiceChar     beginEpoch[TIMELEN];
+   SpiceChar     endEpoch[TIMELEN];
+   for ( const auto& occultation : occultations ) {
+      timout_c( occultation.Ingress, TIMEFORMAT, TIMELEN, beginEpoch );
+      timout_c( occultation.Egress, TIMEFORMAT, TIMELEN, endEpoch );
+      out << "Star " << catalog.Names[occultation.Star] << std::endl;
+      out << "   Start time: " << beginEpoch << std::endl;
+      out << "   Stop time:  " << endEpoch << std::endl;
+   }
+
+   std::cout << "Star occultations: " << occultations.size()
+             << " occultations of a " << catalog.Names.size()
+             << " star catalog over " << steps << " steps, with "
+             << candidateCount << " candidates, " << crossings
+             << " crossings, and " << exactMeasures << " exact measures, in "
+             << elapsed.count() << " s (" << loadTime.count()
+             << " s loading the catalog)." << std::endl;
+   return true;
+}
+/* End StarUtils.cpp */
@@ -0,0 +1,151 @@
+// clang-format off
+/*
+
+- Header_File StarUtils.hpp (Star utility code)
+
+- Abstract
+
+   Define utility functions which search for occultations of the stars of
+   a catalog by the occulter, through a spatial index of the sky.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   FRAMES
+   NAIF_IDS
+   SPK
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   search for stellar occultations. A star is a point at infinity, so it
+   has no ephemeris and no radii, and it is occulted whenever the line of
+   sight towards it passes through the occulter.
+
+   The catalog is indexed with a hierarchical triangular mesh: the sky is
+   divided into the eight triangles of an octahedron, and each triangle
+   into four, down to STARINDEXDEPTH levels. The stars are sorted by the
+   triangle which holds them, so that every triangle of the mesh, at any
+   level, holds a contiguous range of them. A query for the stars within a
+   circle on the sky descends only the triangles which the circle touches,
+   so its cost follows the circle's area rather than the catalog's size.
+
+   The span is crossed in coarse steps. For each step, the catalog is
+   queried for the stars within the path which the occulter's disk sweeps
+   across the sky, and only these candidates are tested against the
+   occulter, with the exact point-target test.
+
+- Literature_References
+
+   Kunszt, P.Z., Szalay, A.S., and Thakar, A.R., "The Hierarchical
+   Triangular Mesh", Mining the Sky, Springer, 2001.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   The occulter must be an ellipsoid, with equal equatorial radii. The
+   stars' parallaxes are neglected, and their proper motions are taken as
+   linear on the sky.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes, plus array, cstdint, and vector for the
+catalog.
+*/
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   A star catalog and its index. The stars are sorted by the leaf triangle
+   of the mesh which holds them, and each has a J2000 unit vector at the
+   catalog's epoch and a proper motion in radians per Julian year. The
+   fastest of the proper motions bounds how far any star can wander from
+   its place in the index.
+   */
+   struct StarCatalog {
+      std::vector<std::string>                Names;
+      std::vector<std::uint64_t>              Trixels;
+      std::vector<std::array<SpiceDouble, 3>> Directions;
+      std::vector<std::array<SpiceDouble, 3>> Motions;
+      SpiceDouble                             Epoch{ 0.0 };
+      SpiceDouble                             MaxMotion{ 0.0 };
+   };
+
+   /*
+   An occultation of a star, from its ingress to its egress.
+   */
+   struct StarOccultation {
+      SpiceInt    Star;
+      SpiceDouble Ingress;
+      SpiceDouble Egress;
+   };
+
+   /*
+   This function reads a star catalog from a text file, one star per line,
+   and builds its index. The epoch is that of the catalog's positions, in
+   seconds past J2000 TDB.
+   */
+   bool loadStarCatalog(
+      const std::string& path,
+      const SpiceDouble  epoch,
+      StarCatalog&       catalog );
+
+   /*
+   This function finds the stars of a catalog whose directions at an epoch
+   may lie within a circle on the sky, given by its J2000 center and its
+   radius in radians. A few stars just outside of the circle may be
+   included as well.
+   */
+   void queryStarCatalog(
+      const StarCatalog&     catalog,
+      const SpiceDouble      center[3],
+      const SpiceDouble      radius,
+      const SpiceDouble      epoch,
+      std::vector<SpiceInt>& stars );
+
+   /*
+   This function returns the J2000 unit vector of a star at an epoch, with
+   its proper motion applied.
+   */
+   void getStarDirection(
+      const StarCatalog& catalog,
+      const SpiceInt     star,
+      const SpiceDouble  epoch,
+      SpiceDouble        direction[3] );
+
+   /*
+   This function searches the simulation's span for occultations of the
+   stars of its StarCatalog by the occulter, and reports them, or writes
+   them to its StarOutput file.
+   */
+   bool findStarOccultations( const SimulationData& data );
+}   // namespace cppspice
+    /* End StarUtils.hpp */
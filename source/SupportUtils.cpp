@@ -52,10 +52,12 @@
 // clang-format on
 
 /*
-In addition to the corresponding header file, we also need fstream.
+In addition to the corresponding header file, we also need fstream and the
+kernel utilities.
 */
 #include <fstream>
 
+#include "KernelUtils.hpp"
 #include "SupportUtils.hpp"
 
 /*
@@ -523,9 +525,9 @@ bool cppspice::furnishSPICEKernel( const std::string& kernelName ) {
    }
 
    /*
-   Finally, call the CSPICE furnsh function.
+   Finally, furnish the kernel.
    */
-   furnsh_c( path.c_str() );
+   furnishKernel( path );
    return true;
 }
 
@@ -835,7 +837,8 @@ SimulationData object, which is then used in the occulation analysis.
 */
 bool cppspice::parseConfigFile(
    const std::string& filename,
-   SimulationData&    data ) {
+   SimulationData&    data,
+   AlgorithmChoice&   choice ) {
    /*
    - Brief I/O
 
@@ -844,12 +847,16 @@ bool cppspice::parseConfigFile(
       string     I   A string containing the name of the file to parse.
       struct     O   A SimulationData struct containing the data used in
                      occultation analysis.
+      enum       I   The algorithm which the search will use.
 
    - Detailed_Input
 
       filename       a string containing the filename of the configuration
                      file which will be parsed to populate the
                      SimulationData struct we'll use elsewhere.
+      choice         the AlgorithmChoice of the search. The custom algorithm
+                     always treats the target as a sphere, so it doesn't
+                     accept a DSK target shape.
 
    - Detailed_Output
 
@@ -1093,13 +1100,39 @@ bool cppspice::parseConfigFile(
       fileContents.push_back( line );
    }
 
+   /*
+   If a pool snapshot has been requested, the text kernels need to be loaded
+   together before anything else, so make a first pass to gather them.
+   */
+   std::string              identifier{ "" };
+   std::string              content{ "" };
+   char                     delimiter{ ':' };
+   std::string              snapshotPath{ "" };
+   std::vector<std::string> textKernels;
+   for ( auto& c : fileContents ) {
+      identifier = c.substr( 0, c.find( delimiter ) );
+      content    = c.substr( c.find( delimiter ) + 1, c.length() );
+      trim( identifier );
+      trim( content );
+      if ( identifier == "PoolSnapshot" ) {
+         disambigRelPath( content );
+         snapshotPath = content;
+      }
+      else if ( identifier == "PConstants" || identifier == "Timespan" ) {
+         disambigRelPath( content );
+         textKernels.push_back( content );
+      }
+   }
+   if ( !snapshotPath.empty() &&
+        !furnishTextKernels( textKernels, snapshotPath ) )
+   {
+      return false;
+   }
+
    /*
    This is a little ugly, but we need to now iterate through each member in
    the fileContents vector so we can populate the SimulationData.
    */
-   std::string identifier{ "" };
-   std::string content{ "" };
-   char        delimiter{ ':' };
    for ( auto& c : fileContents ) {
       identifier = c.substr( 0, c.find( delimiter ) );
       content    = c.substr( c.find( delimiter ) + 1, c.length() );
@@ -1108,18 +1141,24 @@ bool cppspice::parseConfigFile(
       if ( identifier == "PConstants" ) {
          /*
          For each of the kernels, make sure we can disambiguate the
-         relative paths and then attempt to furnish the kernel.
+         relative paths and then attempt to furnish the kernel. If we're
+         using a pool snapshot, this has already been taken care of.
          */
-         disambigRelPath( content );
-         furnsh_c( content.c_str() );
+         if ( snapshotPath.empty() ) {
+            disambigRelPath( content );
+            furnishKernel( content );
+         }
       }
       else if ( identifier == "Timespan" ) {
          /*
          For each of the kernels, make sure we can disambiguate the
-         relative paths and then attempt to furnish the kernel.
+         relative paths and then attempt to furnish the kernel. If we're
+         using a pool snapshot, this has already been taken care of.
          */
-         disambigRelPath( content );
-         furnsh_c( content.c_str() );
+         if ( snapshotPath.empty() ) {
+            disambigRelPath( content );
+            furnishKernel( content );
+         }
       }
       else if ( identifier == "PlanetaryEphemerides" ) {
          /*
@@ -1127,7 +1166,24 @@ bool cppspice::parseConfigFile(
          relative paths and then attempt to furnish the kernel.
          */
          disambigRelPath( content );
-         furnsh_c( content.c_str() );
+         furnishKernel( content );
+      }
+      else if ( identifier == "ShapeModel" ) {
+         /*
+         This is a DSK holding the plates of a body, which are used when
+         the body's shape is DSK/UNPRIORITIZED. As with the ephemerides, it
+         isn't part of a pool snapshot, so it's always furnished.
+         */
+         disambigRelPath( content );
+         furnishKernel( content );
+      }
+      else if ( identifier == "SubsetKernel" ) {
+         /*
+         This is the path of a compact SPK to write for this simulation, so
+         we only need to disambiguate it here.
+         */
+         disambigRelPath( content );
+         data.SubsetKernel = content;
       }
       else if ( identifier == "LowerBoundEpoch" ) {
          /*
@@ -1182,6 +1238,86 @@ bool cppspice::parseConfigFile(
          };
          data.OccultationType = content;
       }
+      else if ( identifier == "StepMode" ) {
+         /*
+         Retrieve the step mode and ensure that it is valid.
+         */
+         auto mode_it = std::find(
+            validStepModes.begin(),
+            validStepModes.end(),
+            content );
+
+         if ( mode_it == validStepModes.end() ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         };
+         data.StepMode = content;
+      }
+      else if ( identifier == "RefineMode" ) {
+         /*
+         Retrieve the refine mode and ensure that it is valid.
+         */
+         auto mode_it = std::find(
+            validRefineModes.begin(),
+            validRefineModes.end(),
+            content );
+
+         if ( mode_it == validRefineModes.end() ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         };
+         data.RefineMode = content;
+      }
+      else if ( identifier == "SearchMonitor" ) {
+         /*
+         Retrieve the search monitor and ensure that it is valid.
+         */
+         auto monitor_it = std::find(
+            validSearchMonitors.begin(),
+            validSearchMonitors.end(),
+            content );
+
+         if ( monitor_it == validSearchMonitors.end() ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         };
+         data.SearchMonitor = content;
+      }
+      else if ( identifier == "EventDetail" ) {
+         /*
+         Retrieve the event detail and ensure that it is valid.
+         */
+         auto detail_it = std::find(
+            validEventDetails.begin(),
+            validEventDetails.end(),
+            content );
+
+         if ( detail_it == validEventDetails.end() ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         };
+         data.EventDetail = content;
+      }
+      else if ( identifier == "LimbDarkening" ) {
+         /*
+         Retrieve the limb darkening and ensure that it is valid.
+         */
+         auto darkening_it = std::find(
+            validLimbDarkenings.begin(),
+            validLimbDarkenings.end(),
+            content );
+
+         if ( darkening_it == validLimbDarkenings.end() ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         };
+         data.LimbDarkening = content;
+      }
       else if ( identifier == "OccultingBodyShape" ) {
          /*
          For now, we just need to ensure that we have a valid body shape.
@@ -1214,11 +1350,21 @@ bool cppspice::parseConfigFile(
       }
       else if ( identifier == "TargetBodyShape" ) {
          /*
-         For now, we just need to ensure that we have a valid body shape.
+         We need to ensure that we have a valid body shape. The custom
+         algorithm only models a DSK occulter, so refuse a DSK target
+         rather than quietly treating it as a sphere.
          */
          if ( !isValidShapeType( content ) ) {
             return false;
          }
+         if ( choice == AlgorithmChoice::CUSTOM &&
+              content == "DSK/UNPRIORITIZED" )
+         {
+            std::cout << "Error: the custom algorithm doesn't support the "
+                         "target body shape '"
+                      << content << "'." << std::endl;
+            return false;
+         }
          std::get<1>( data.TargetDetails ) = content;
       }
       else if ( identifier == "TargetBodyFrame" ) {
@@ -1266,6 +1412,219 @@ bool cppspice::parseConfigFile(
             return false;
          }
       }
+      else if ( identifier == "Benchmark" ) {
+         /*
+         This names a benchmark followed by the size of its run, which
+         just needs to be positive. The key may be repeated, once for each
+         benchmark, and they are run in the order given.
+         */
+         size_t      split = content.find_first_of( " \t" );
+         std::string name  = content.substr( 0, split );
+         SpiceInt    count{ 0 };
+         if ( split != std::string::npos ) {
+            count = std::atoi( content.substr( split ).c_str() );
+         }
+
+         auto bench_it = std::find(
+            validBenchmarks.begin(),
+            validBenchmarks.end(),
+            name );
+
+         if ( bench_it == validBenchmarks.end() || count <= 0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         };
+         for ( const auto& run : data.Benchmarks ) {
+            if ( run.first == name ) {
+               std::cout << "Error: the benchmark '" << name
+                         << "' is listed more than once in '" << identifier
+                         << "'." << std::endl;
+               return false;
+            }
+         }
+         data.Benchmarks.emplace_back( name, count );
+      }
+      else if ( identifier == "RotationErrorBound" ) {
+         /*
+         This enables the quasi-static rotation mode, and the bound (in
+         radians) just needs to be positive.
+         */
+         data.RotationErrorBound = std::atof( content.c_str() );
+         if ( data.RotationErrorBound <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "ShapeCacheSize" ) {
+         /*
+         This is the number of plates the shape cache may hold. Zero
+         disables the cache, so it only needs to be non-negative.
+         */
+         data.ShapeCacheSize = std::atoi( content.c_str() );
+         if ( data.ShapeCacheSize < 0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "FootprintOutput" ) {
+         /*
+         This is the path of the shadow footprint file to write for this
+         simulation, so we only need to disambiguate it here.
+         */
+         disambigRelPath( content );
+         data.FootprintOutput = content;
+      }
+      else if ( identifier == "FootprintResolution" ) {
+         /*
+         This is the spacing of the footprint's grid in degrees, which just
+         needs to be positive.
+         */
+         data.FootprintResolution = std::atof( content.c_str() );
+         if ( data.FootprintResolution <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "FootprintStep" ) {
+         /*
+         This is the step through each eclipse of the footprint in seconds,
+         which just needs to be positive.
+         */
+         data.FootprintStep = std::atof( content.c_str() );
+         if ( data.FootprintStep <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "ObscurationOutput" ) {
+         /*
+         This is the path of the obscuration series to write for this
+         simulation, so we only need to disambiguate it here.
+         */
+         disambigRelPath( content );
+         data.ObscurationOutput = content;
+      }
+      else if ( identifier == "ObscurationStep" ) {
+         /*
+         This is the step of the obscuration series in seconds, which just
+         needs to be positive.
+         */
+         data.ObscurationStep = std::atof( content.c_str() );
+         if ( data.ObscurationStep <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "StarCatalog" ) {
+         /*
+         This is the path of a star catalog, whose stars become the targets,
+         so we only need to disambiguate it here.
+         */
+         disambigRelPath( content );
+         data.StarCatalog = content;
+      }
+      else if ( identifier == "StarCatalogEpoch" ) {
+         /*
+         This is the epoch of the catalog's positions as a Julian year,
+         which just needs to be positive.
+         */
+         data.StarCatalogEpoch = std::atof( content.c_str() );
+         if ( data.StarCatalogEpoch <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "StarStep" ) {
+         /*
+         This is the coarse step of the star occultation search in seconds,
+         which just needs to be positive.
+         */
+         data.StarStep = std::atof( content.c_str() );
+         if ( data.StarStep <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "StarOutput" ) {
+         /*
+         This is the path of the star occultations to write, so we only need
+         to disambiguate it here.
+         */
+         disambigRelPath( content );
+         data.StarOutput = content;
+      }
+      else if ( identifier == "MutualBodies" ) {
+         /*
+         This is a comma separated list of the bodies of a satellite
+         system. Each of them must be a valid NAIF object, listed once,
+         and there must be at least two of them.
+         */
+         data.MutualBodies.clear();
+         size_t begin{ 0 };
+         while ( begin <= content.size() ) {
+            size_t end = content.find( ',', begin );
+            if ( end == std::string::npos ) {
+               end = content.size();
+            }
+            std::string name  = content.substr( begin, end - begin );
+            size_t      first = name.find_first_not_of( " \t" );
+            if ( first != std::string::npos ) {
+               size_t last = name.find_last_not_of( " \t" );
+               name        = name.substr( first, last - first + 1 );
+            }
+            if ( getNAIFIDFromName( name ) == -1 ) {
+               std::cout << "Error: the specified body name '" << name
+                         << "' does not correspond to a valid NAIF object."
+                         << std::endl;
+               return false;
+            }
+            if ( std::find(
+                    data.MutualBodies.begin(),
+                    data.MutualBodies.end(),
+                    name ) != data.MutualBodies.end() )
+            {
+               std::cout << "Error: the body '" << name
+                         << "' is listed more than once in '" << identifier
+                         << "'." << std::endl;
+               return false;
+            }
+            data.MutualBodies.push_back( name );
+            begin = end + 1;
+         }
+         if ( data.MutualBodies.size() < 2 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "MutualStep" ) {
+         /*
+         This is the coarse step of the mutual event search in seconds,
+         which just needs to be positive.
+         */
+         data.MutualStep = std::atof( content.c_str() );
+         if ( data.MutualStep <= 0.0 ) {
+            std::cout << "Error: the value specified for '" << identifier
+                      << "' is invalid." << std::endl;
+            return false;
+         }
+      }
+      else if ( identifier == "MutualOutput" ) {
+         /*
+         This is the path of the mutual events to write, so we only need to
+         disambiguate it here.
+         */
+         disambigRelPath( content );
+         data.MutualOutput = content;
+      }
       else {
          /*
          If we don't have a match, just ignore it and move on.
@@ -114,7 +114,10 @@ namespace cppspice {
    parsed. The data retrieved from the configuration file are fed into a
    SimulationData object, which is then used in the occulation analysis.
    */
-   bool parseConfigFile( const std::string& filename, SimulationData& data );
+   bool parseConfigFile(
+      const std::string& filename,
+      SimulationData&    data,
+      AlgorithmChoice&   choice );
 
    /*
    This is a simple utility to take relative paths and ensure that they are
@@ -53,16 +53,79 @@
 // clang-format on
 
 /*
-Include the two support headers.
+Include the support headers.
 */
+#include "FrameUtils.hpp"
+#include "IntervalUtils.hpp"
+#include "KernelUtils.hpp"
+#include "MutualUtils.hpp"
+#include "ObscurationUtils.hpp"
 #include "OccultationUtils.hpp"
+#include "ShadowUtils.hpp"
+#include "ShapeUtils.hpp"
+#include "StarUtils.hpp"
 #include "SupportUtils.hpp"
+#include "TimeUtils.hpp"
+
+/*
+Include the standard headers.
+*/
+#include <map>
 
 /*
 Additionally, we want to use the cppspice namespace.
 */
 using namespace cppspice;
 
+/*
+Each benchmark is run by one entry of this table, keyed by its name in
+validBenchmarks and given the simulation and the size of its run.
+*/
+using BenchmarkRunner = void ( * )( const SimulationData&, const SpiceInt );
+static const std::map<std::string, BenchmarkRunner> benchmarkRunners = {
+   { "FRAMES",
+     []( const SimulationData& data, const SpiceInt count ) {
+        /*
+        Alternate between the frames which the simulation uses.
+        */
+        const auto& occulterFrame = std::get<2>( data.OcculterDetails );
+        const auto& targetFrame   = std::get<2>( data.TargetDetails );
+        benchmarkFramePlans(
+           { { "J2000", occulterFrame },
+             { "J2000", targetFrame },
+             { occulterFrame, targetFrame },
+             { targetFrame, "ECLIPJ2000" } },
+           count );
+     } },
+   { "TIMES",
+     []( const SimulationData&, const SpiceInt count ) {
+        benchmarkEpochConversion( count );
+     } },
+   { "EPOCHS",
+     []( const SimulationData&, const SpiceInt count ) {
+        benchmarkFixedEpochs( count );
+     } },
+   { "INTERVALS",
+     []( const SimulationData&, const SpiceInt count ) {
+        benchmarkIntervalSets( count );
+     } },
+   { "SHAPE",
+     []( const SimulationData& data, const SpiceInt count ) {
+        benchmarkShapeModel( std::get<0>( data.OcculterDetails ), count );
+     } },
+   { "SHAPECACHE",
+     []( const SimulationData& data, const SpiceInt count ) {
+        benchmarkShapeCache( std::get<0>( data.OcculterDetails ), count );
+     } },
+   { "SHAPELOAD",
+     []( const SimulationData& data, const SpiceInt count ) {
+        benchmarkShapeLoad( std::get<0>( data.OcculterDetails ), count );
+     } },
+   { "SPHERES",
+     []( const SimulationData&, const SpiceInt count ) {
+        benchmarkOccultationSpheres( count );
+     } } };
+
 /*
 This is the main function of this program.
 */
@@ -222,19 +285,102 @@ int main() {
       At this point, we're confident the file exists, so let's drop into
       parseConfigFile to configure our SimulationData.
       */
-      if ( !cppspice::parseConfigFile( input, data ) )
+      if ( !cppspice::parseConfigFile( input, data, algorithmChoice ) )
+         return 1;
+   }
+
+   /*
+   If a subset kernel was requested, write it now while the full kernels are
+   still furnished, and make sure it agrees with them. From then on, the
+   simulation reads its states from the subset alone.
+   */
+   if ( !data.SubsetKernel.empty() ) {
+      if ( !writeSubsetKernel( data, data.SubsetKernel ) ||
+           !validateSubsetKernel( data, data.SubsetKernel ) )
+      {
          return 1;
+      }
+      furnishSubsetKernel( data.SubsetKernel );
+   }
+
+   /*
+   If a shape cache capacity was given, set it before any model is built.
+   */
+   if ( data.ShapeCacheSize >= 0 ) {
+      setShapeCacheSize( data.ShapeCacheSize );
+   }
+
+   /*
+   If benchmarks were requested, run them in the order given in place of
+   the search, so that their timings stay out of its report.
+   */
+   if ( !data.Benchmarks.empty() ) {
+      for ( const auto& run : data.Benchmarks ) {
+         benchmarkRunners.at( run.first )( data, run.second );
+      }
+      return 0;
+   }
+
+   /*
+   If the quasi-static rotation mode was requested, enable it and make sure
+   it meets its error bound for the occulter over the simulation's span.
+   */
+   if ( data.RotationErrorBound > 0.0 ) {
+      SpiceDouble lowerEpoch{ 0.0 };
+      SpiceDouble upperEpoch{ 0.0 };
+      str2et_c( data.LowerBoundEpoch.c_str(), &lowerEpoch );
+      str2et_c( data.UpperBoundEpoch.c_str(), &upperEpoch );
+      setQuasiStaticRotation( data.RotationErrorBound );
+      FramePlanHandle plan =
+         getFramePlan( "J2000", std::get<2>( data.OcculterDetails ) );
+      if ( plan < 0 ||
+           !validateMemoRotation(
+              plan,
+              lowerEpoch,
+              upperEpoch,
+              SUBSETSAMPLES ) )
+      {
+         return 1;
+      }
+   }
+
+   /*
+   If a shadow footprint was requested, map it over the simulation's span
+   ahead of the search.
+   */
+   if ( !data.FootprintOutput.empty() && !mapShadowFootprint( data ) ) {
+      return 1;
+   }
+
+   /*
+   If a star catalog was given, its stars are the targets rather than the
+   target body, so search for their occultations instead.
+   */
+   if ( !data.StarCatalog.empty() ) {
+      return findStarOccultations( data ) ? 0 : 1;
+   }
+
+   /*
+   Likewise, if the bodies of a satellite system were given, search for the
+   mutual events among them instead.
+   */
+   if ( !data.MutualBodies.empty() ) {
+      return findMutualEvents( data ) ? 0 : 1;
    }
 
    /*
    Finally, the moment we've all been waiting for: let's perform our search.
    */
+   SPICEDOUBLE_CELL( events, CELLSIZE );
+   SpiceCell* results = &events;
    if ( algorithmChoice == AlgorithmChoice::CUSTOM ) {
-      cppspice::performCustOccSrch( data );
+      cppspice::performCustOccSrch( data, &events );
    }
    else {
-      SpiceCell* results;
       results = cppspice::performCSPICEOccSrch( data );
+      if ( results == nullptr ) {
+         return 1;
+      }
 
       /*
       Now that we have our results, we can go ahead and report the data.
@@ -242,6 +388,25 @@ int main() {
       cppspice::reportSearchSummary( results );
    }
 
+   /*
+   If the contacts of each event were requested, find them from the
+   intervals.
+   */
+   if ( data.EventDetail == "CONTACTS" &&
+        !cppspice::reportEventContacts( data, results ) )
+   {
+      return 1;
+   }
+
+   /*
+   If an obscuration series was requested, write it across each event.
+   */
+   if ( !data.ObscurationOutput.empty() &&
+        !cppspice::writeObscurationSeries( data, results ) )
+   {
+      return 1;
+   }
+
    return 0;
 }
 /* End SymmetricalEnigma.cpp */
\ No newline at end of file
@@ -0,0 +1,1105 @@
+// clang-format off
+/*
+
+- Source_File TimeUtils.cpp (Time utility code)
+
+- Abstract
+
+   Implement the functions defined in the corresponding header file.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   KERNEL
+   POOL
+   TIME
+
+- Particulars
+
+   This file contains the implementations of the functions defined in the
+   corresponding header file (TimeUtils.hpp). The conversions follow the
+   arithmetic performed by the CSPICE routines str2et, ttrans and unitim,
+   step for step, so that the results are identical rather than merely
+   close:
+
+      TDB strings are formal seconds past J2000, which are exact integers.
+
+      UTC strings are converted to TAI using the leapsecond table, then to
+      TDT by adding DELTA_T_A, and finally to TDB by adding the periodic
+      term K*sin( E ), where E = M0 + M1*TDT + EB*sin( M0 + M1*TDT ).
+
+- Literature_References
+
+   CSPICE's documentation for str2et, ttrans, unitim, and the TIME required
+   reading.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   None.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+/*
+We need the corresponding header, algorithm for the table searches, cmath
+for the periodic term, cstdio to write the benchmark's epochs, and the
+kernel utilities so that the leapsecond table can tell when the loaded
+kernels have changed.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "KernelUtils.hpp"
+#include "TimeUtils.hpp"
+
+/*
+The periodic TDB-TDT term is evaluated two epochs at a time with SSE2
+wherever it is available, which is every x64 target.
+*/
+#if defined( __SSE2__ ) || defined( _M_X64 ) || \
+   ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define SE_SSE2_KERNEL
+#include <emmintrin.h>
+#endif
+
+/*
+The number of seconds in a day, and the number of days from 1 JAN 1 to
+1 JAN 2000 on the Gregorian calendar.
+*/
+static const SpiceDouble secondsPerDay = 86400.0;
+static const SpiceInt    daysTo2000    = 730119;
+
+/*
+Constants for the sine approximation used by the batch conversions. The
+argument is reduced to [-pi/2, pi/2], where the Taylor series summed to the
+x**15 term is accurate to better than 1e-9. Since the periodic term is
+scaled by K (about 1.7e-3 seconds), that is far below a nanosecond.
+*/
+static const SpiceDouble twoPi        = 2.0 * cppspice::PI;
+static const SpiceDouble inverseTwoPi = 1.0 / twoPi;
+static const SpiceDouble sineTerms[8] = {
+   1.0,
+   -1.0 / 6.0,
+   1.0 / 120.0,
+   -1.0 / 5040.0,
+   1.0 / 362880.0,
+   -1.0 / 39916800.0,
+   1.0 / 6227020800.0,
+   -1.0 / 1307674368000.0 };
+
+/*
+The number of days before the start of each month in a common year.
+*/
+static const SpiceInt daysBeforeMonth[12] =
+   { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+/*
+The leapsecond table and TDB-TDT constants, as ttrans and unitim hold them.
+TAITable holds pairs of TAI epochs at the start of the UTC day before each
+change in TAI-UTC and the start of the day after it, and DayTable holds the
+day numbers (past 1 JAN 1) of those same days. For the batch conversions,
+the same changes are also held as a step table: StepOffsets[i] is TAI-UTC
+from UTCSteps[i] onwards, which is ETSteps[i] in TDB as deltet_c finds it.
+*/
+struct LeapsecondTable {
+   long long                Generation{ -1 };
+   bool                     Loaded{ false };
+   bool                     DefaultSettings{ false };
+   std::vector<SpiceDouble> TAITable;
+   std::vector<SpiceInt>    DayTable;
+   std::vector<SpiceDouble> UTCSteps;
+   std::vector<SpiceDouble> ETSteps;
+   std::vector<SpiceDouble> StepOffsets;
+   SpiceDouble              DeltaTA{ 0.0 };
+   SpiceDouble              K{ 0.0 };
+   SpiceDouble              EB{ 0.0 };
+   SpiceDouble              M[2]{ 0.0, 0.0 };
+};
+static LeapsecondTable leapsecondTable;
+
+/*
+The outcome of reading a single epoch string.
+*/
+enum class ParseResult : int {
+   PARSED,
+   FALLBACK,
+   MALFORMED
+};
+
+/*
+This is a helper which checks whether the time settings which str2et_c uses
+have been changed from their defaults through timdef_c.
+*/
+static bool hasDefaultTimeSettings() {
+   SpiceChar system[cppspice::TIMELEN];
+   SpiceChar calendar[cppspice::TIMELEN];
+   SpiceChar zone[cppspice::TIMELEN];
+   timdef_c( "GET", "SYSTEM", cppspice::TIMELEN, system );
+   timdef_c( "GET", "CALENDAR", cppspice::TIMELEN, calendar );
+   timdef_c( "GET", "ZONE", cppspice::TIMELEN, zone );
+   return std::string( system ) == "UTC" &&
+          std::string( calendar ) != "JULIAN" && std::string( zone ).empty();
+}
+
+/*
+This is a helper which rebuilds the leapsecond table if the loaded kernels
+have changed since it was last built.
+*/
+static void refreshLeapsecondTable() {
+   /*
+   - Brief I/O
+
+      None.
+
+   - Detailed_Output
+
+      None. leapsecondTable is updated in place. If the leapseconds kernel
+   isn't loaded, the table is marked as not loaded and UTC strings are left
+   to str2et_c.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+
+   - Particulars
+
+      The table is transformed in the same way as ttrans transforms
+   DELTET/DELTA_AT, which holds pairs of ( TAI-UTC, formal epoch at which
+   it takes effect ).
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   auto&     table      = leapsecondTable;
+   long long generation = cppspice::getKernelGeneration();
+   if ( table.Generation == generation ) {
+      return;
+   }
+
+   table.Generation      = generation;
+   table.Loaded          = false;
+   table.DefaultSettings = hasDefaultTimeSettings();
+   table.TAITable.clear();
+   table.DayTable.clear();
+   table.UTCSteps.clear();
+   table.ETSteps.clear();
+   table.StepOffsets.clear();
+
+   SpiceDouble  values[cppspice::MAXLEAPSECONDS];
+   SpiceInt     n{ 0 };
+   SpiceBoolean found{ false };
+   gdpool_c(
+      "DELTET/DELTA_AT",
+      0,
+      cppspice::MAXLEAPSECONDS,
+      &n,
+      values,
+      &found );
+   if ( !found || n < 2 ) {
+      return;
+   }
+
+   SpiceInt     count{ 0 };
+   SpiceBoolean allFound{ true };
+   gdpool_c( "DELTET/DELTA_T_A", 0, 1, &count, &table.DeltaTA, &found );
+   allFound = allFound && found;
+   gdpool_c( "DELTET/K", 0, 1, &count, &table.K, &found );
+   allFound = allFound && found;
+   gdpool_c( "DELTET/EB", 0, 1, &count, &table.EB, &found );
+   allFound = allFound && found;
+   gdpool_c( "DELTET/M", 0, 2, &count, table.M, &found );
+   allFound = allFound && found && count == 2;
+   if ( !allFound ) {
+      return;
+   }
+
+   SpiceDouble lastDelta = values[0] - 1.0;
+   for ( SpiceInt i = 0; i + 1 < n; i += 2 ) {
+      SpiceDouble delta  = values[i];
+      SpiceDouble formal = values[i + 1];
+      table.TAITable.push_back( formal - secondsPerDay + lastDelta );
+      table.TAITable.push_back( formal + delta );
+
+      auto dayNumber = static_cast<SpiceInt>(
+                          ( formal + secondsPerDay / 2.0 ) / secondsPerDay ) +
+                       daysTo2000;
+      table.DayTable.push_back( dayNumber - 1 );
+      table.DayTable.push_back( dayNumber );
+
+      SpiceDouble stepTDT = std::round( formal + table.DeltaTA + delta );
+      SpiceDouble anomaly = table.M[0] + table.M[1] * stepTDT;
+      SpiceDouble periodicTerm =
+         table.K * sin( anomaly + table.EB * sin( anomaly ) );
+      table.UTCSteps.push_back( formal );
+      table.ETSteps.push_back(
+         formal + table.DeltaTA + delta + periodicTerm );
+      table.StepOffsets.push_back( delta );
+      lastDelta = delta;
+   }
+
+   /*
+   ttrans refuses tables which aren't increasing, so leave those to it.
+   */
+   for ( size_t i = 1; i < table.TAITable.size(); i++ ) {
+      if ( table.TAITable[i - 1] >= table.TAITable[i] ) {
+         return;
+      }
+   }
+
+   table.Loaded = true;
+}
+
+/*
+This is a helper which reads a run of decimal digits from fixed columns.
+*/
+static bool readDigits(
+   const char* text,
+   const int   count,
+   SpiceInt&   value ) {
+   value = 0;
+   for ( int i = 0; i < count; i++ ) {
+      if ( text[i] < '0' || text[i] > '9' ) {
+         return false;
+      }
+      value = value * 10 + ( text[i] - '0' );
+   }
+   return true;
+}
+
+/*
+This is a helper which converts a single string in the fixed date format,
+using a leapsecond table which is already current.
+*/
+static ParseResult parseWithTable(
+   const std::string&     epochString,
+   const LeapsecondTable& table,
+   SpiceDouble&           epoch ) {
+   /*
+   - Brief I/O
+
+      Variable         I/O  DESCRIPTION
+      --------         ---  --------------------------------------------------
+      string            I   The epoch string.
+      LeapsecondTable   I   The current leapsecond table.
+      SpiceDouble       O   The epoch, in seconds past J2000 TDB.
+
+   - Detailed_Input
+
+      epochString  a string in the fixed date format, matching
+   dateFormatRegex.
+      table        the leapsecond table, which must have been refreshed.
+
+   - Detailed_Output
+
+      epoch   the ephemeris time of the string. It is only set if PARSED is
+   returned.
+
+      The function returns PARSED if the string was converted, FALLBACK if
+   it matches the format but must be converted by str2et_c, and MALFORMED
+   if it doesn't match the format.
+
+   - Error Handling
+
+      None.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   /*
+   Check the layout, column by column, exactly as dateFormatRegex would.
+   */
+   auto        length = epochString.size();
+   const char* text   = epochString.c_str();
+   if ( length != 20 && length != 24 ) {
+      return ParseResult::MALFORMED;
+   }
+
+   bool isTDB = length == 24;
+   if ( isTDB && epochString.compare( 20, 4, " TDB" ) != 0 ) {
+      return ParseResult::MALFORMED;
+   }
+
+   if ( text[4] != ' ' || text[8] != ' ' || text[11] != ' ' ||
+        text[14] != ':' || text[17] != ':' )
+   {
+      return ParseResult::MALFORMED;
+   }
+
+   for ( int i = 5; i < 8; i++ ) {
+      if ( text[i] < 'A' || text[i] > 'Z' ) {
+         return ParseResult::MALFORMED;
+      }
+   }
+
+   SpiceInt year, day, hour, minute, second;
+   if ( !readDigits( text, 4, year ) || !readDigits( text + 9, 2, day ) ||
+        !readDigits( text + 12, 2, hour ) ||
+        !readDigits( text + 15, 2, minute ) ||
+        !readDigits( text + 18, 2, second ) )
+   {
+      return ParseResult::MALFORMED;
+   }
+
+   /*
+   From here on the string matches the format, and anything unusual is left
+   to str2et_c. That includes month names it may know of that we don't,
+   leap seconds, and dates which might be on the Julian calendar.
+   */
+   SpiceInt month{ -1 };
+   const auto& months = cppspice::validMonths;
+   for ( size_t i = 0; i < months.size(); i++ ) {
+      if ( months[i].first.compare( 0, 3, text + 5, 3 ) == 0 ) {
+         month = static_cast<SpiceInt>( i );
+         break;
+      }
+   }
+
+   bool isLeapYear =
+      ( year % 4 == 0 && year % 100 != 0 ) || ( year % 400 == 0 );
+   if ( month < 0 || year < 1600 || !table.DefaultSettings ) {
+      return ParseResult::FALLBACK;
+   }
+
+   SpiceInt maxDay = months[month].second + ( month == 1 && isLeapYear );
+   if ( day < 1 || day > maxDay || hour > 23 || minute > 59 ||
+        second > 59 )
+   {
+      return ParseResult::FALLBACK;
+   }
+
+   if ( !isTDB && !table.Loaded ) {
+      return ParseResult::FALLBACK;
+   }
+
+   /*
+   The day number past 1 JAN 1, and the seconds into the day.
+   */
+   SpiceInt dayNumber = ( year - 1 ) * 365 + ( year - 1 ) / 4 -
+                        ( year - 1 ) / 100 + ( year - 1 ) / 400 +
+                        daysBeforeMonth[month] +
+                        ( month > 1 && isLeapYear ) + day - 1;
+   SpiceDouble seconds = static_cast<SpiceDouble>( hour ) * 3600.0 +
+                         static_cast<SpiceDouble>( minute ) * 60.0 +
+                         static_cast<SpiceDouble>( second );
+
+   if ( isTDB ) {
+      epoch = static_cast<SpiceDouble>( dayNumber - daysTo2000 ) *
+                 secondsPerDay -
+              secondsPerDay / 2.0 + seconds;
+      return ParseResult::PARSED;
+   }
+
+   /*
+   Find the last day in the table at or before this one, and count the
+   seconds from the TAI epoch at its start.
+   */
+   auto dayIndex = std::upper_bound(
+                      table.DayTable.begin(),
+                      table.DayTable.end(),
+                      dayNumber ) -
+                   table.DayTable.begin();
+   dayIndex = std::max<decltype( dayIndex )>( dayIndex, 1 ) - 1;
+
+   seconds +=
+      static_cast<SpiceDouble>( dayNumber - table.DayTable[dayIndex] ) *
+      secondsPerDay;
+   SpiceDouble tai = table.TAITable[dayIndex] + seconds;
+
+   /*
+   Finally, TAI to TDT to TDB, as unitim does it.
+   */
+   SpiceDouble tdt = tai + table.DeltaTA;
+   epoch           = tdt + table.K * sin(
+                                  table.M[0] + table.M[1] * tdt +
+                                  table.EB * sin(
+                                     table.M[0] + table.M[1] * tdt ) );
+   return ParseResult::PARSED;
+}
+
+/*
+This function converts an epoch in the fixed date format to ephemeris time,
+giving the same result as str2et_c.
+*/
+bool cppspice::parseFixedEpoch(
+   const std::string& epochString,
+   SpiceDouble&       epoch ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      string        I   The epoch string.
+      SpiceDouble   O   The epoch, in seconds past J2000 TDB.
+
+   - Detailed_Input
+
+      epochString  a string in the fixed date format, such as
+   "2024 APR 08 18:17:00" (UTC) or "2024 APR 08 18:18:09 TDB".
+
+   - Detailed_Output
+
+      epoch   the ephemeris time of the string, as would be returned by
+   str2et_c( epochString, &epoch ).
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Strings which match the format but fall outside of the range handled
+   here are passed to str2et_c, as are all strings while the timdef_c
+   settings differ from their defaults. The settings are checked on every
+   call, since changing them doesn't change the kernel generation.
+
+   - Literature_References
+
+      CSPICE's documentation for str2et_c.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   refreshLeapsecondTable();
+   leapsecondTable.DefaultSettings = hasDefaultTimeSettings();
+
+   auto result = parseWithTable( epochString, leapsecondTable, epoch );
+   if ( result == ParseResult::MALFORMED ) {
+      std::cout << "Error: epoch '" << epochString
+                << "' does not match the required format." << std::endl;
+      return false;
+   }
+
+   if ( result == ParseResult::FALLBACK ) {
+      str2et_c( epochString.c_str(), &epoch );
+   }
+
+   return true;
+}
+
+/*
+This function converts an array of epochs in the fixed date format to
+ephemeris time.
+*/
+bool cppspice::parseFixedEpochs(
+   const std::vector<std::string>& epochStrings,
+   std::vector<SpiceDouble>&       epochs ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      vector        I   The epoch strings.
+      vector        O   The epochs, in seconds past J2000 TDB.
+
+   - Detailed_Input
+
+      epochStrings  strings in the fixed date format. UTC and TDB strings
+   may be mixed freely.
+
+   - Detailed_Output
+
+      epochs   the ephemeris times of the strings, in the same order.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned. The first string
+   which doesn't match the format is reported, and the contents of epochs
+   are then unspecified.
+
+   - Particulars
+
+      The leapsecond table and the timdef_c settings are checked once for
+   the whole array rather than once per string.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   refreshLeapsecondTable();
+   leapsecondTable.DefaultSettings = hasDefaultTimeSettings();
+
+   epochs.resize( epochStrings.size() );
+   for ( size_t i = 0; i < epochStrings.size(); i++ ) {
+      auto result =
+         parseWithTable( epochStrings[i], leapsecondTable, epochs[i] );
+      if ( result == ParseResult::MALFORMED ) {
+         std::cout << "Error: epoch '" << epochStrings[i] << "' (number "
+                   << i + 1 << ") does not match the required format."
+                   << std::endl;
+         return false;
+      }
+
+      if ( result == ParseResult::FALLBACK ) {
+         str2et_c( epochStrings[i].c_str(), &epochs[i] );
+      }
+   }
+
+   return true;
+}
+
+/*
+This is a helper which approximates sin( x ) for the batch conversions.
+*/
+static SpiceDouble approximateSine( const SpiceDouble x ) {
+   SpiceDouble n = std::nearbyint( x * inverseTwoPi );
+   SpiceDouble y = x - n * twoPi;
+   y             = std::min( y, cppspice::PI - y );
+   y             = std::max( y, -cppspice::PI - y );
+
+   SpiceDouble y2  = y * y;
+   SpiceDouble sum = sineTerms[7];
+   for ( int i = 6; i >= 0; i-- ) {
+      sum = sum * y2 + sineTerms[i];
+   }
+   return sum * y;
+}
+
+#ifdef SE_SSE2_KERNEL
+/*
+This is the same approximation, for two arguments at once. Every operation
+matches the scalar version, so the results don't depend on which is used.
+*/
+static __m128d approximateSine( const __m128d x ) {
+   __m128d n = _mm_cvtepi32_pd(
+      _mm_cvtpd_epi32( _mm_mul_pd( x, _mm_set1_pd( inverseTwoPi ) ) ) );
+   __m128d y = _mm_sub_pd( x, _mm_mul_pd( n, _mm_set1_pd( twoPi ) ) );
+   y = _mm_min_pd( y, _mm_sub_pd( _mm_set1_pd( cppspice::PI ), y ) );
+   y = _mm_max_pd( y, _mm_sub_pd( _mm_set1_pd( -cppspice::PI ), y ) );
+
+   __m128d y2  = _mm_mul_pd( y, y );
+   __m128d sum = _mm_set1_pd( sineTerms[7] );
+   for ( int i = 6; i >= 0; i-- ) {
+      sum = _mm_add_pd( _mm_mul_pd( sum, y2 ), _mm_set1_pd( sineTerms[i] ) );
+   }
+   return _mm_mul_pd( sum, y );
+}
+#endif
+
+/*
+This is a helper which evaluates the periodic term of TDB-TDT,
+K*sin( M0 + M1*t + EB*sin( M0 + M1*t ) ), for an array of epochs.
+*/
+static void evaluatePeriodicTerm(
+   const LeapsecondTable& table,
+   const SpiceInt         count,
+   const SpiceDouble*     epochs,
+   SpiceDouble*           terms ) {
+   SpiceInt i{ 0 };
+#ifdef SE_SSE2_KERNEL
+   const __m128d m0 = _mm_set1_pd( table.M[0] );
+   const __m128d m1 = _mm_set1_pd( table.M[1] );
+   const __m128d eb = _mm_set1_pd( table.EB );
+   const __m128d k  = _mm_set1_pd( table.K );
+   for ( ; i + 1 < count; i += 2 ) {
+      __m128d anomaly =
+         _mm_add_pd( m0, _mm_mul_pd( m1, _mm_loadu_pd( epochs + i ) ) );
+      __m128d eccentric =
+         _mm_add_pd( anomaly, _mm_mul_pd( eb, approximateSine( anomaly ) ) );
+      _mm_storeu_pd(
+         terms + i,
+         _mm_mul_pd( k, approximateSine( eccentric ) ) );
+   }
+#endif
+   for ( ; i < count; i++ ) {
+      SpiceDouble anomaly   = table.M[0] + table.M[1] * epochs[i];
+      SpiceDouble eccentric = anomaly + table.EB * approximateSine( anomaly );
+      terms[i]              = table.K * approximateSine( eccentric );
+   }
+}
+
+/*
+This is a helper which looks up TAI-UTC in the step table, for an epoch
+given either in UTC (against UTCSteps) or in TDB (against ETSteps). Before
+the first step, deltet_c's convention of one second less is followed.
+*/
+static SpiceDouble getStepOffset(
+   const LeapsecondTable&          table,
+   const std::vector<SpiceDouble>& steps,
+   const SpiceDouble               epoch ) {
+   auto index = std::upper_bound( steps.begin(), steps.end(), epoch ) -
+                steps.begin();
+   if ( index == 0 ) {
+      return table.StepOffsets[0] - 1.0;
+   }
+   return table.StepOffsets[index - 1];
+}
+
+/*
+This function converts an array of epochs from one time system to another.
+*/
+bool cppspice::convertEpochs(
+   const TimeSystem   fromSystem,
+   const TimeSystem   toSystem,
+   const SpiceInt     count,
+   const SpiceDouble* epochs,
+   SpiceDouble*       converted ) {
+   /*
+   - Brief I/O
+
+      Variable     I/O  DESCRIPTION
+      --------     ---  --------------------------------------------------
+      TimeSystem    I   The time system of the input epochs.
+      TimeSystem    I   The time system to convert to.
+      SpiceInt      I   The number of epochs.
+      SpiceDouble   I   The epochs, in seconds past J2000.
+      SpiceDouble   O   The converted epochs, in seconds past J2000.
+
+   - Detailed_Input
+
+      fromSystem  the time system of epochs.
+      toSystem    the time system to convert to.
+      count       the number of epochs.
+      epochs      the epochs to convert.
+
+   - Detailed_Output
+
+      converted   the converted epochs. This may be the same array as
+   epochs, in which case the conversion is done in place.
+
+      The function returns true if no errors are encountered.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported and false is returned.
+
+   - Particulars
+
+      Between TAI, TDT and TDB this is the same arithmetic as unitim, apart
+   from the approximation of the sine function in the periodic term, and
+   agrees with it to well within a nanosecond. UTC is converted to and from
+   TDB with the same arithmetic as deltet_c, using the leapsecond step
+   table.
+
+      The epochs are worked through in chunks of EPOCHCHUNK, so that the
+   intermediate values stay in cache without allocating any memory.
+
+   - Literature_References
+
+      CSPICE's documentation for unitim_c, deltet_c, and the TIME required
+   reading.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Credits
+
+      This file references the CSPICE API, which was developed by the NAIF at
+      JPL.
+
+   - Restrictions
+
+      None.
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   refreshLeapsecondTable();
+   const auto& table = leapsecondTable;
+   if ( !table.Loaded ) {
+      std::cout << "Error: time systems can't be converted without a "
+                << "leapseconds kernel." << std::endl;
+      return false;
+   }
+
+   /*
+   TAI and TDT differ by a constant, so those are converted directly. Every
+   other conversion passes through TDB.
+   */
+   auto isAtomic = []( const TimeSystem system ) {
+      return system == TimeSystem::TAI || system == TimeSystem::TDT;
+   };
+   bool direct = fromSystem == toSystem ||
+                 ( isAtomic( fromSystem ) && isAtomic( toSystem ) );
+
+   SpiceDouble tdb[EPOCHCHUNK];
+   SpiceDouble work[EPOCHCHUNK];
+   SpiceDouble terms[EPOCHCHUNK];
+   SpiceDouble offsets[EPOCHCHUNK];
+   for ( SpiceInt start = 0; start < count; start += EPOCHCHUNK ) {
+      SpiceInt           n      = std::min( EPOCHCHUNK, count - start );
+      const SpiceDouble* input  = epochs + start;
+      SpiceDouble*       output = converted + start;
+      if ( direct ) {
+         SpiceDouble offset{ 0.0 };
+         if ( fromSystem == TimeSystem::TAI && toSystem == TimeSystem::TDT ) {
+            offset = table.DeltaTA;
+         }
+         else if ( fromSystem != toSystem ) {
+            offset = -table.DeltaTA;
+         }
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            output[i] = input[i] + offset;
+         }
+         continue;
+      }
+
+      /*
+      First bring the chunk to TDB...
+      */
+      if ( fromSystem == TimeSystem::UTC ) {
+         /*
+         As in deltet_c, the periodic term is evaluated at the nearest
+         whole second.
+         */
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            offsets[i] = table.DeltaTA +
+                         getStepOffset( table, table.UTCSteps, input[i] );
+            work[i]    = std::round( input[i] + offsets[i] );
+         }
+         evaluatePeriodicTerm( table, n, work, terms );
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            tdb[i] = input[i] + ( offsets[i] + terms[i] );
+         }
+      }
+      else if ( fromSystem == TimeSystem::TDB ) {
+         std::copy( input, input + n, tdb );
+      }
+      else {
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            work[i] = fromSystem == TimeSystem::TAI
+                         ? input[i] + table.DeltaTA
+                         : input[i];
+         }
+         evaluatePeriodicTerm( table, n, work, terms );
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            tdb[i] = work[i] + terms[i];
+         }
+      }
+
+      /*
+      ...and then on to the requested system.
+      */
+      if ( toSystem == TimeSystem::UTC ) {
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            offsets[i] = table.DeltaTA +
+                         getStepOffset( table, table.ETSteps, tdb[i] );
+            work[i]    = std::round( tdb[i] );
+         }
+         evaluatePeriodicTerm( table, n, work, terms );
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            output[i] = tdb[i] - ( offsets[i] + terms[i] );
+         }
+      }
+      else if ( toSystem == TimeSystem::TDB ) {
+         std::copy( tdb, tdb + n, output );
+      }
+      else {
+         /*
+         TDB to TDT has no closed form, so unitim's three fixed point
+         iterations are used.
+         */
+         std::copy( tdb, tdb + n, work );
+         for ( int iteration = 0; iteration < 3; iteration++ ) {
+            evaluatePeriodicTerm( table, n, work, terms );
+            for ( SpiceInt i = 0; i < n; i++ ) {
+               work[i] = tdb[i] - terms[i];
+            }
+         }
+         for ( SpiceInt i = 0; i < n; i++ ) {
+            output[i] = toSystem == TimeSystem::TAI
+                           ? work[i] - table.DeltaTA
+                           : work[i];
+         }
+      }
+   }
+
+   return true;
+}
+
+/*
+This function times the CSPICE time conversions against the batch
+conversions, and reports the results.
+*/
+void cppspice::benchmarkEpochConversion( const SpiceInt count ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      SpiceInt   I   The number of epochs to convert.
+
+   - Detailed_Input
+
+      count   the number of epochs to convert with each approach. They are
+   spread evenly from 1980 to 2050.
+
+   - Detailed_Output
+
+      None. For each conversion, the rate of the CSPICE routine and of the
+   batch conversion are reported, along with the largest difference between
+   them.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   SpiceDouble lowerEpoch{ 0.0 };
+   SpiceDouble upperEpoch{ 0.0 };
+   str2et_c( "1980 JAN 01 00:00:00 TDB", &lowerEpoch );
+   str2et_c( "2050 JAN 01 00:00:00 TDB", &upperEpoch );
+
+   std::vector<SpiceDouble> epochs( count );
+   for ( SpiceInt i = 0; i < count; i++ ) {
+      epochs[i] = lowerEpoch + ( upperEpoch - lowerEpoch ) * i / count;
+   }
+
+   struct Conversion {
+      std::string Label;
+      TimeSystem  From;
+      TimeSystem  To;
+   };
+   const std::vector<Conversion> conversions = {
+      { "TDT -> TDB", TimeSystem::TDT, TimeSystem::TDB },
+      { "TDB -> TDT", TimeSystem::TDB, TimeSystem::TDT },
+      { "TDB -> UTC", TimeSystem::TDB, TimeSystem::UTC },
+      { "UTC -> TDB", TimeSystem::UTC, TimeSystem::TDB } };
+
+   /*
+   The CSPICE equivalent of each conversion, for a single epoch.
+   */
+   auto convertOne = []( const Conversion& conversion, SpiceDouble epoch ) {
+      SpiceDouble delta{ 0.0 };
+      if ( conversion.To == TimeSystem::UTC ) {
+         deltet_c( epoch, "ET", &delta );
+         return epoch - delta;
+      }
+      if ( conversion.From == TimeSystem::UTC ) {
+         deltet_c( epoch, "UTC", &delta );
+         return epoch + delta;
+      }
+      return unitim_c(
+         epoch,
+         conversion.From == TimeSystem::TDT ? "TDT" : "TDB",
+         conversion.To == TimeSystem::TDT ? "TDT" : "TDB" );
+   };
+
+   std::vector<SpiceDouble> expected( count );
+   std::vector<SpiceDouble> converted( count );
+   std::cout << "Time conversion benchmark over " << count
+             << " epochs (millions per second):" << std::endl;
+   for ( const auto& conversion : conversions ) {
+      auto start = std::chrono::steady_clock::now();
+      for ( SpiceInt i = 0; i < count; i++ ) {
+         expected[i] = convertOne( conversion, epochs[i] );
+      }
+      std::chrono::duration<double, std::micro> cspiceTime =
+         std::chrono::steady_clock::now() - start;
+
+      start = std::chrono::steady_clock::now();
+      if ( !convertEpochs(
+              conversion.From,
+              conversion.To,
+              count,
+              epochs.data(),
+              converted.data() ) )
+      {
+         return;
+      }
+      std::chrono::duration<double, std::micro> batchTime =
+         std::chrono::steady_clock::now() - start;
+
+      SpiceDouble maxDifference{ 0.0 };
+      for ( SpiceInt i = 0; i < count; i++ ) {
+         maxDifference =
+            std::max( maxDifference, std::abs( converted[i] - expected[i] ) );
+      }
+
+      std::cout << "   " << conversion.Label << ": CSPICE "
+                << count / cspiceTime.count() << ", batch "
+                << count / batchTime.count() << ", max difference "
+                << maxDifference * 1.0e9 << " ns" << std::endl;
+   }
+}
+/*
+A function which times str2et_c against the fixed format parser, and checks
+that they agree.
+*/
+void cppspice::benchmarkFixedEpochs( const SpiceInt count ) {
+   /*
+   - Brief I/O
+
+      Variable  I/O  DESCRIPTION
+      --------  ---  --------------------------------------------------
+      SpiceInt   I   The number of random epochs to parse.
+
+   - Detailed_Input
+
+      count   the number of random epochs to parse with each approach.
+   They are drawn from a fixed pseudorandom sequence between 1600 and 9999,
+   and half of them are TDB.
+
+   - Detailed_Output
+
+      None. The time per string of str2et_c and of parseFixedEpochs is
+   reported, along with the number of epochs for which they differ at all.
+
+   - Error Handling
+
+      CSPICE components are handled using the native error handling.
+   Otherwise, errors are reported.
+
+   - Particulars
+
+      The two seconds either side of every leap second in the loaded
+   leapseconds kernel are added to the random epochs, since those are where
+   the parser's table lookups and its hand-off to str2et_c meet. The
+   results are compared bit for bit, so this check is worth rerunning
+   whenever CSPICE or the leapseconds kernel is updated.
+
+   - Author
+
+      C.P. Westphal     (self)
+
+   - Version
+
+      Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+   */
+   std::vector<std::string> epochStrings;
+   epochStrings.reserve( count );
+   unsigned long long seed = 88172645463325252ULL;
+   auto               next = [&seed]( SpiceInt range ) {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      return static_cast<SpiceInt>( seed % range );
+   };
+   for ( SpiceInt i = 0; i < count; i++ ) {
+      SpiceInt year  = 1600 + next( 8400 );
+      SpiceInt month = next( 12 );
+      bool     isLeapYear =
+         ( year % 4 == 0 && year % 100 != 0 ) || ( year % 400 == 0 );
+      SpiceInt maxDay =
+         validMonths[month].second + ( month == 1 && isLeapYear );
+      SpiceChar text[TIMELEN];
+      snprintf(
+         text,
+         TIMELEN,
+         "%04d %s %02d %02d:%02d:%02d%s",
+         static_cast<int>( year ),
+         validMonths[month].first.c_str(),
+         static_cast<int>( 1 + next( maxDay ) ),
+         static_cast<int>( next( 24 ) ),
+         static_cast<int>( next( 60 ) ),
+         static_cast<int>( next( 60 ) ),
+         i % 2 == 0 ? "" : " TDB" );
+      epochStrings.push_back( text );
+   }
+
+   SpiceDouble  values[MAXLEAPSECONDS];
+   SpiceInt     n{ 0 };
+   SpiceBoolean found{ false };
+   SpiceInt     leapSeconds{ 0 };
+   gdpool_c( "DELTET/DELTA_AT", 0, MAXLEAPSECONDS, &n, values, &found );
+   for ( SpiceInt i = 1; found && i < n; i += 2 ) {
+      SpiceDouble delta{ 0.0 };
+      deltet_c( values[i], "UTC", &delta );
+      for ( SpiceInt offset = -2; offset < 2; offset++ ) {
+         SpiceChar text[TIMELEN];
+         et2utc_c( values[i] + delta + offset, "C", 0, TIMELEN, text );
+         epochStrings.push_back( text );
+      }
+      leapSeconds++;
+   }
+
+   auto                     total = epochStrings.size();
+   std::vector<SpiceDouble> expected( total );
+   auto                     start = std::chrono::steady_clock::now();
+   for ( size_t i = 0; i < total; i++ ) {
+      str2et_c( epochStrings[i].c_str(), &expected[i] );
+   }
+   std::chrono::duration<double, std::nano> cspiceTime =
+      std::chrono::steady_clock::now() - start;
+
+   std::vector<SpiceDouble> parsed;
+   start = std::chrono::steady_clock::now();
+   if ( !parseFixedEpochs( epochStrings, parsed ) ) {
+      return;
+   }
+   std::chrono::duration<double, std::nano> parseTime =
+      std::chrono::steady_clock::now() - start;
+
+   size_t differences{ 0 };
+   for ( size_t i = 0; i < total; i++ ) {
+      if ( parsed[i] != expected[i] ) {
+         if ( differences == 0 ) {
+            std::cout << "Error: epoch '" << epochStrings[i]
+                      << "' is parsed as " << parsed[i]
+                      << " rather than " << expected[i] << "."
+                      << std::endl;
+         }
+         differences++;
+      }
+   }
+
+   std::cout << "Fixed epoch benchmark over " << total << " epochs ("
+             << leapSeconds << " leap seconds, nanoseconds per string):"
+             << std::endl
+             << "   str2et_c: " << cspiceTime.count() / total
+             << ", parseFixedEpochs: " << parseTime.count() / total << ", "
+             << differences << " differ" << std::endl;
+}
+/* End TimeUtils.cpp */
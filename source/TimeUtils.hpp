@@ -0,0 +1,133 @@
+// clang-format off
+/*
+
+- Header_File TimeUtils.hpp (Time utility code)
+
+- Abstract
+
+   Define utility functions which convert epoch strings to ephemeris time
+   without going through the general CSPICE time string parser.
+
+- Disclaimer
+
+   This code was created by me and is provided as-is.
+
+- Required_Reading
+
+   KERNEL
+   POOL
+   TIME
+
+- Particulars
+
+   This file is a header which defines the functions which are offered to
+   parse epochs written in this program's fixed date format,
+
+      YYYY MON DD HR:MN:SC
+      YYYY MON DD HR:MN:SC TDB
+
+   where the first form is UTC. str2et_c tokenizes every string and matches
+   it against its list of time pictures before any conversion is done. Since
+   the layout of these strings is known in advance, the fields can be read
+   straight from their columns, and the conversion to ephemeris time can be
+   carried out with integer day arithmetic and a leapsecond table which is
+   only built when the loaded kernels change.
+
+   The same table supports converting whole arrays of epochs between UTC,
+   TAI, TDT and TDB, with the periodic term of TDB-TDT evaluated two epochs
+   at a time.
+
+- Literature_References
+
+   None.
+
+- Author
+
+   C.P. Westphal     (self)
+
+- Credits
+
+   This file references the CSPICE API, which was developed by the NAIF at
+   JPL.
+
+- Restrictions
+
+   The conversion assumes the default time settings of timdef_c. If they
+   have been changed, or a string falls outside of the range which the fast
+   path handles (such as a leap second or a year before 1600), str2et_c is
+   used instead. The settings are checked on every call of the batch
+   function, but only when the loaded kernels change for single epochs.
+
+- Version
+
+   -Symmetrical-Enigma Version 1.X.X, 18-OCT-2026 (CPW)
+
+*/
+// clang-format on
+
+#pragma once
+
+/*
+We need the common includes and the vector header for this file.
+*/
+#include <vector>
+
+#include "IncludesCommon.hpp"
+
+/*
+All of our non-program functionality lives within the cppspice namespace. This
+will ensure that everything is made available appropriately.
+*/
+namespace cppspice {
+   /*
+   This function converts an epoch in the fixed date format to ephemeris
+   time, giving the same result as str2et_c.
+   */
+   bool parseFixedEpoch(
+      const std::string& epochString,
+      SpiceDouble&       epoch );
+
+   /*
+   This function converts an array of epochs in the fixed date format to
+   ephemeris time.
+   */
+   bool parseFixedEpochs(
+      const std::vector<std::string>& epochStrings,
+      std::vector<SpiceDouble>&       epochs );
+
+   /*
+   The time systems which epochs can be converted between. UTC epochs are
+   seconds past J2000 UTC, as used by deltet_c.
+   */
+   enum class TimeSystem : int {
+      UTC,
+      TAI,
+      TDT,
+      TDB
+   };
+
+   /*
+   This function converts an array of epochs from one time system to
+   another, using a leapsecond step table which is only built when the
+   loaded kernels change.
+   */
+   bool convertEpochs(
+      const TimeSystem   fromSystem,
+      const TimeSystem   toSystem,
+      const SpiceInt     count,
+      const SpiceDouble* epochs,
+      SpiceDouble*       converted );
+
+   /*
+   This function times unitim_c and deltet_c against the batch conversions,
+   and reports the results.
+   */
+   void benchmarkEpochConversion( const SpiceInt count );
+
+   /*
+   This function times str2et_c against parseFixedEpochs on random epochs
+   and the epochs around each leap second, and reports any differences.
+   */
+   void benchmarkFixedEpochs( const SpiceInt count );
+}   // namespace cppspice
+    /* End TimeUtils.hpp */